@@ -2,62 +2,95 @@
 #include <esp_now.h>
 #include <esp_wifi.h>
 #include <ArduinoJson.h>
+#include <esp_timer.h>
+#include <esp_attr.h>
+#include <Preferences.h>
+#include <atomic>
+#include "espnow_protocol.h"
+#include "lightboard_rules.h"
+#include "clock_sync.h"
+#include "arbitration.h"
+#include "telemetry.h"
 
 #define LED_PIN 2
 
 // ===================== USER CONFIG =====================
 // ESP-NOW Bridge: communicates between Raspberry Pi and other ESP32s
 static const unsigned long HEARTBEAT_INTERVAL_MS = 1000;   // heartbeat to players
+static const unsigned long LIVENESS_IDLE_MS = HEARTBEAT_INTERVAL_MS / 2; // skip a heartbeat if we sent anything this recently
+static const unsigned long SYNC_MAX_DEFER_MS = 10000;      // longest a round may hold off sync probes
 static const unsigned long SERIAL_TIMEOUT_MS = 100;        // serial read timeout
+static const uint16_t AWARD_STEP_INTERVAL_MS = 100;        // lightboard animation step per awarded point
+// Bridge->Pi encoding until the Pi negotiates: false = JSON lines, true = binary frames
+static const bool PI_BINARY_DEFAULT = false;
+static const size_t PI_RX_BUFFER_SIZE = 2048; // UART driver RX ring (bytes)
+static const size_t PI_LINE_MAX = 1024;        // longest JSON command line; longer lines are dropped
+static const size_t PI_TX_BUFFER_SIZE = 1024; // UART driver TX ring so writes don't wait on the FIFO
+// Dispatcher: every ESP-NOW packet, timer tick and Pi command is handled in
+// order on one task; callbacks only enqueue
+static const UBaseType_t EVENT_QUEUE_LEN = 32;
+static const BaseType_t DISPATCH_TASK_CORE = 1;  // away from the Wi-Fi task on core 0
+static const UBaseType_t DISPATCH_TASK_PRIO = 5;
+static const int ESPNOW_TX_QUEUE_LEN = 8;        // reliable packets awaiting an ACK
+static const int64_t ROUND_START_LEAD_US = 20000; // round control goes out this far ahead of the start
+static const int ROUND_CONTROL_COPIES = 2;        // broadcasts get no MAC retries: send it twice
+// Arbitration: after the first hit of a round, wait until every player's hit
+// from that moment could have arrived (largest measured hit latency + guard)
+static const uint32_t SETTLE_DEFAULT_US = 15000;  // before any latency has been measured
+static const uint32_t SETTLE_GUARD_US = 1000;
+static const uint32_t SETTLE_MIN_US = 2000;
+static const uint32_t SETTLE_MAX_US = 50000;
+static const float SYNC_UNCERTAINTY_SIGMAS = 3.0f; // per-player uncertainty = 3x sync jitter
+// Persistence: changes are coalesced into one NVS write once they have
+// settled, bounded so a busy game still gets checkpointed
+static const unsigned long CHECKPOINT_IDLE_MS = 2000;
+static const unsigned long CHECKPOINT_MAX_DELAY_MS = 10000;
 // =======================================================
 
 // ===================== ESP-NOW Configuration =====================
-// Player 1 MAC address (hardcoded for reliability)
-uint8_t player1Address[] = {0x6C, 0xC8, 0x40, 0x4E, 0xEC, 0x2C}; // Player 1 STA MAC
-// Player 2 MAC address (hardcoded for reliability)
-uint8_t player2Address[] = {0x80, 0xF3, 0xDA, 0x5E, 0x14, 0xC8}; // Player 2 STA MAC
+// Player MAC addresses by player id (hardcoded for reliability). All-zero
+// entries are learned from the first packet that player sends.
+static const uint8_t PLAYER_MACS[ESPNOW_MAX_PLAYERS][6] = {
+  {0x6C, 0xC8, 0x40, 0x4E, 0xEC, 0x2C}, // Player 1 STA MAC
+  {0x80, 0xF3, 0xDA, 0x5E, 0x14, 0xC8}, // Player 2 STA MAC
+};
 // Lightboard MAC address (will be learned dynamically)
 uint8_t lightboardAddress[] = {0x78, 0x1C, 0x3C, 0xB8, 0xD5, 0xA8}; // Lightboard STA MAC
-const uint8_t ESPNOW_BROADCAST_ADDR[6] = {0xFF,0xFF,0xFF,0xFF,0xFF,0xFF};
-
-typedef struct struct_message {
-  uint8_t  playerId;   // 1=Player1, 2=Player2
-  uint8_t  action;     // 1=heartbeat, 2=hit-detected, 3=reset-request, 4=clock-sync
-  uint32_t hitTime;    // micros() timestamp of hit
-  uint16_t hitStrength; // impact strength
-  uint32_t syncTime;   // for clock synchronization
-  uint32_t roundTripTime; // for latency measurement
-} struct_message;
-
-typedef struct struct_lightboard_message {
-  uint8_t  deviceId;     // 1=Bridge, 3=Lightboard
-  uint8_t  action;       // 1=heartbeat, 2=game-state, 3=score-update, 4=mode-change, 5=reset, 6=state-restore, 7=state-request
-  uint8_t  gameMode;     // 1-6 (Territory, Swap Sides, Split Scoring, Score Order, Race, Tug O War)
-  uint8_t  p1ColorIndex; // Player 1 color index
-  uint8_t  p2ColorIndex; // Player 2 color index
-  int8_t   p1Pos;        // Player 1 position (-1 to NUM_LEDS)
-  int8_t   p2Pos;        // Player 2 position (-1 to NUM_LEDS)
-  uint8_t  nextLedPos;   // For Score Order mode
-  uint8_t  tugBoundary;  // For Tug O War mode
-  uint8_t  p1RacePos;    // For Race mode
-  uint8_t  p2RacePos;    // For Race mode
-  uint8_t  celebrating;  // Celebration state
-  uint8_t  winner;       // 0=none, 1=Player1, 2=Player2
-} struct_lightboard_message;
-
-struct_message myData;
-struct_message player1Data;
-struct_message player2Data;
-struct_lightboard_message lightboardData;
+
+// Packet format, types and payloads: espnow_protocol.h
+// Per-peer link state. EspNowHeader.seq runs per link so each receiver sees
+// a gap-free sequence; the counters feed the status message.
+struct PeerLink {
+  uint16_t txSeq;
+  uint32_t txPackets;     // including retransmits and ACKs
+  uint32_t rxPackets;     // valid packets from this peer
+  uint64_t airtimeUs;     // estimated, both directions
+  unsigned long lastTxMs; // any packet to this peer doubles as a heartbeat
+};
+uint16_t bootId = 0;               // EspNowHeader.boot, random per boot
+PeerLink lightboardLink = {};
+PeerLink broadcastLink = {};       // MSG_ROUND_CONTROL to ESPNOW_BROADCAST_ADDR
+EspNowSeqStats lightboardSeq = {}; // loss accounting + duplicate suppression per sender
+EspNowTxQueue<ESPNOW_TX_QUEUE_LEN> espNowTx = {}; // hits, resets and lightboard updates until acked
+
+// MAC -> peer lookup for every send (sequence, counters): open addressing
+// on the low MAC bytes, so the cost does not grow with the player count
+static const int MAC_INDEX_SIZE = 16; // power of two, > 2x the number of peers
+enum : int8_t {
+  PEER_NONE       = -1,
+  PEER_TOMBSTONE  = -2,
+  PEER_LIGHTBOARD = ESPNOW_MAX_PLAYERS, // 0..ESPNOW_MAX_PLAYERS-1 are player slots
+  PEER_BROADCAST
+};
+
+struct MacIndex {
+  uint8_t mac[MAC_INDEX_SIZE][6];
+  int8_t  peer[MAC_INDEX_SIZE];
+};
+MacIndex macIndex;
 
 // Connection tracking
-bool player1Connected = false;
-bool player2Connected = false;
-unsigned long lastHeartbeat = 0;
-unsigned long lastPlayer2Heartbeat = 0;
 const unsigned long heartbeatTimeout = 2000; // 2 seconds
-bool player1MacLearned = false;
-bool player2MacLearned = false;
 
 // Lightboard connection tracking
 bool lightboardConnected = false;
@@ -65,36 +98,127 @@ bool lightboardWasConnected = false; // Track previous connection state for reco
 unsigned long lastLightboardHeartbeat = 0;
 bool lightboardMacLearned = false;
 
-// Clock synchronization
-bool clockSynced = false;
-bool player2ClockSynced = false;
-int32_t clockOffset = 0; // Player1 time - Bridge time
-int32_t player2ClockOffset = 0; // Player2 time - Bridge time
-uint32_t lastSyncTime = 0;
-uint32_t lastPlayer2SyncTime = 0;
-const unsigned long SYNC_INTERVAL = 1000; // Sync at most once per second
+// Clock synchronization: clock_sync.h
+
+// Player peer table: struct-of-arrays indexed by slot (player id - 1), so the
+// per-tick loops only walk the arrays they use
+struct PlayerTable {
+  uint8_t  mac[ESPNOW_MAX_PLAYERS][6];
+  bool     hasMac[ESPNOW_MAX_PLAYERS];      // configured or learned: we can send to it
+  bool     macLearned[ESPNOW_MAX_PLAYERS];  // confirmed by the player's own packets
+  bool     connected[ESPNOW_MAX_PLAYERS];
+  bool     synced[ESPNOW_MAX_PLAYERS];
+  unsigned long lastSeenMs[ESPNOW_MAX_PLAYERS];
+  int64_t  hitTime[ESPNOW_MAX_PLAYERS];     // bridge esp_timer_get_time() timebase, 0 = no hit
+  int64_t  hitRxUs[ESPNOW_MAX_PLAYERS];     // when that hit arrived (fallback for unsynced players)
+  uint32_t hitLatencyUs[ESPNOW_MAX_PLAYERS]; // recent peak of hit time -> arrival, synced hits only
+  PeerLink link[ESPNOW_MAX_PLAYERS];
+  EspNowSeqStats rxSeq[ESPNOW_MAX_PLAYERS];
+  ClockSync sync[ESPNOW_MAX_PLAYERS];
+};
+PlayerTable players;
+
+// Warm start. NVS holds what survives any reboot; the bridge's esp_timer
+// restarts at zero, so clock offsets themselves can't carry over, but each
+// player's crystal drift does and seeds the first fit after a single probe.
+static const uint8_t CHECKPOINT_LAYOUT = 1; // bump when BridgeCheckpoint changes
+struct BridgeCheckpoint {
+  uint8_t  layout;
+  MsgLightboardSnapshot board;
+  uint8_t  macLearned;                   // bit per player slot: mac[] came from discovery
+  uint8_t  mac[ESPNOW_MAX_PLAYERS][6];
+  float    driftPpm[ESPNOW_MAX_PLAYERS]; // last full-window fit (0 = never measured)
+};
+Preferences checkpointStore;
+BridgeCheckpoint checkpointSaved = {};   // what NVS holds
+BridgeCheckpoint checkpointPending = {}; // last capture, not yet written
+unsigned long checkpointChangedMs = 0;   // when checkpointPending last changed
+unsigned long checkpointDirtyMs = 0;     // first unsaved change (0 = clean)
+bool lbBoardFromFlash = false; // board came from NVS: the Pi's copy may be newer
+
+// Board copy in RTC memory: kept through a crash, watchdog or software reset
+// (not a power cycle), so those lose nothing since the last NVS write
+static const uint32_t RTC_BOARD_MAGIC = 0x4C42524Eu;
+struct RtcBoard {
+  uint32_t magic;
+  MsgLightboardSnapshot board;
+  uint16_t crc; // CRC-16 over magic and board
+};
+RTC_NOINIT_ATTR RtcBoard rtcBoard;
 // =======================================================
 
 // ===================== Game State =====================
 // Serial communication with Raspberry Pi
-String serialBuffer = "";
+char piLine[PI_LINE_MAX + 1];    // JSON command being assembled (parsed in place)
+size_t piLineLen = 0;
+bool piLineOverflow = false;     // current line exceeded PI_LINE_MAX, discard to newline
+uint32_t piLineOverflows = 0;
 bool piConnected = false;
 unsigned long lastPiHeartbeat = 0;
 const unsigned long PI_HEARTBEAT_TIMEOUT = 5000; // 5 seconds
 
+// Dispatcher events
+enum BridgeEventKind : uint8_t {
+  EVT_ESPNOW = 1, // packet copied out of the receive callback
+  EVT_TICK,       // HEARTBEAT_INTERVAL_MS esp_timer: heartbeats, sync, timeouts
+  EVT_SERIAL,     // UART has Pi bytes waiting
+  EVT_SEND_STATUS,// send callback results waiting in sendStatusRing (wake-up only)
+  EVT_RETRY,      // retransmit timer: a reliable packet is due
+  EVT_SETTLE      // arbitration settle window closed
+};
+
+struct BridgeEvent {
+  uint8_t  kind;
+  uint8_t  len;
+  uint8_t  srcMac[6];
+  int8_t   rssi;
+  int64_t  rxUs;      // esp_timer_get_time() when the packet arrived (clock sync uses this)
+  uint8_t  data[ESPNOW_MAX_PACKET]; // largest ESP-NOW message we understand
+};
+
+QueueHandle_t eventQueue = nullptr;
+TaskHandle_t dispatchTask = nullptr;
+esp_timer_handle_t tickTimer = nullptr;
+esp_timer_handle_t retryTimer = nullptr;
+esp_timer_handle_t settleTimer = nullptr;
+volatile uint32_t eventQueueDrops = 0;  // packets/ticks lost because the queue was full
+
+// Send callback results in callback order, so they pair with espNowTx's
+// inflight FIFO. The Wi-Fi task appends and the dispatcher drains; they don't
+// go through eventQueue, where a dropped one would shift every later result
+// onto the wrong send.
+static const uint32_t SEND_STATUS_RING = 32; // power of two, > ESPNOW_INFLIGHT_MAX
+bool sendStatusRing[SEND_STATUS_RING];
+std::atomic<uint32_t> sendStatusHead{0};     // written by the Wi-Fi task
+std::atomic<uint32_t> sendStatusTail{0};     // written by the dispatcher
+std::atomic<bool> sendStatusLost{false};     // ring was full: resync the FIFO
+volatile uint32_t oversizePackets = 0;  // ESP-NOW packets too long for BridgeEvent
+uint32_t malformedPackets = 0;          // bad magic/version/length (e.g. old firmware)
+
 // Function declarations
 void resetGame();
 void resetGameForQuiz();
 void determineWinner();
+void setWinner(uint8_t id, uint32_t marginUs = 0, uint32_t uncertaintyUs = 0);
 void syncClock();
-void sendLightboardUpdate(uint8_t action);
-void updateLightboardGameState();
-void sendLightboardPointUpdate(uint8_t scoringPlayer);
 void sendLightboardStateRestore();
+void lbPublish(const MsgLightboardAward *award = nullptr);
 void awardPointToPlayer(uint8_t playerId);
 void awardMultiplePointsToPlayer(uint8_t playerId, int multiplier);
-void sendToPi(String message);
-void processPiCommand(String command);
+void sendToPi(const char *line, size_t len);
+void processPiCommand(const char *command, size_t len);
+void processPiFrame(uint8_t type, const uint8_t *payload, uint8_t len);
+void piSendHit(uint8_t player, int64_t time, uint16_t strength);
+void piSendWinner();
+void piSendStatus();
+void piSendReset();
+void piSendLightboardStateRequest();
+void piSendLightboardState();
+void piSendError(uint8_t code);
+void piSendHitLocation(uint8_t player, uint8_t mode, uint8_t sensors, int64_t time, int16_t xMm, int16_t yMm);
+void piSendQuizAction(uint8_t action);
+void piSendTelemetry(uint8_t device, const MsgTelemetryStage &m);
+void piSendTelemetryCounters(uint8_t device, const MsgTelemetryCounters &c);
 
 // Local result tracking removed (host-only)
 unsigned long g_lastBroadcastMs = 0;
@@ -103,33 +227,50 @@ unsigned long g_lastBroadcastMs = 0;
 
 // Game state
 bool gameActive = true;  // Start with game active
+bool roundOpen = false;  // a reset opened a round and no winner yet: hit packets may be in the air
+uint16_t roundId = 0;       // MsgRoundControl.roundId of the current round
+int64_t roundStartUs = 0;   // scheduled start (our esp_timer); earlier hits belong to the last round
+uint32_t earlyHits = 0;
 String winner = "none";
-// Bridge is host-only, no local hit time needed
-uint32_t player1HitTime = 0;
-uint32_t player2HitTime = 0;
-
-// Lightboard game state (for LED strip display)
-int lightboardGameMode = 1; // Default to Territory mode
-int lightboardP1ColorIndex = 0; // Red
-int lightboardP2ColorIndex = 1; // Blue
-int lightboardP1Pos = -1;
-int lightboardP2Pos = 38; // NUM_LEDS
-int lightboardNextLedPos = 0;
-int lightboardTugBoundary = 18; // CENTER_LEFT
-int lightboardP1RacePos = -1;
-int lightboardP2RacePos = -1;
-bool lightboardCelebrating = false;
-uint8_t lightboardWinner = 0; // 0=none, 1=Player1, 2=Player2
+uint8_t winnerId = 0;    // 0 = none, player id, or WINNER_TIE
+uint32_t winnerMarginUs = 0;      // lead over the runner-up (0 = uncontested or awarded)
+uint32_t winnerUncertaintyUs = 0; // combined sync uncertainty the margin was judged against
+static const uint8_t WINNER_TIE = 0xFF;
+static const int64_t TIE_WINDOW_US = 100; // hits closer than this are always a tie
+bool settling = false;   // first hit arrived, collecting the rest until settleTimer fires
+int64_t settleFirstRxUs = 0; // arrival of the hit that opened the settle window
+
+// Trace points (telemetry.h): our own, and the latest report from each board,
+// forwarded to the Pi every TELEMETRY_REPORT_MS while no round is open. A
+// report goes out TELEMETRY_LINES_PER_TICK lines per tick: a whole one in
+// JSON is several KB, far more than PI_TX_BUFFER_SIZE, and Serial.write would
+// block the dispatcher until it drained
+Telemetry bridgeTelem = {};
+static const int TELEM_DEVICES = ESPNOW_MAX_PLAYERS + 1; // players by slot, then the lightboard
+struct DeviceTelemetry {
+  MsgTelemetryStage stage[TELEM_STAGE_COUNT];
+  uint16_t staleStages;          // bit per stage received since the last forward
+  bool countersStale;
+  MsgTelemetryCounters counters;
+} deviceTelem[TELEM_DEVICES] = {};
+DeviceTelemetry bridgeReport = {}; // our own, snapshotted when a report starts
+static const int TELEMETRY_LINES_PER_TICK = 6; // JSON lines are ~130 bytes
+unsigned long lastTelemetryMs = 0;
+bool telemetryReporting = false;   // a report started and has lines left to send
+
+// Lightboard board (lightboard_rules.h). The Bridge owns it: points, resets
+// and settings change it here and the result is replicated to the
+// lightboard, which only renders. version 0 = defaults, not yet restored
+// from the Pi.
+MsgLightboardSnapshot lbBoard = {};
+MsgLightboardSnapshot lbSent = {}; // last board the lightboard was sent
+bool lbSentValid = false;          // lbSent is what the lightboard holds
+unsigned long lbCelebrationEndMs = 0; // board resets after the win animation (0 = none)
+static const unsigned long LB_CELEBRATION_MS = 3500; // longest lightboard celebration + margin
 
 // Quiz action debouncing
 unsigned long lastQuizActionTime = 0;
 const unsigned long QUIZ_ACTION_DEBOUNCE_MS = 500; // 500ms debounce period
-
-// Hit deduplication to prevent processing duplicate ESP-NOW messages
-uint32_t lastProcessedHitTime = 0;
-uint8_t lastProcessedHitPlayer = 0;
-const unsigned long HIT_DEBOUNCE_MS = 100; // 100ms debounce period
-unsigned long lastHitProcessTime = 0;
 // =======================================================
 
 // ===================== Serial Protocol =====================
@@ -144,275 +285,621 @@ unsigned long lastHitProcessTime = 0;
 // {"type":"status","player1Connected":true,"player2Connected":true,"lightboardConnected":true}
 // {"type":"winner","winner":"Player 1"}
 // {"type":"hit","player":1,"time":1234567890,"strength":100}
+// {"type":"hitLocation","player":1,"time":1234567890,"x":212,"y":98,"mode":"tdoa","sensors":4}
 // {"type":"error","message":"Player 1 disconnected"}
+// {"type":"telemetry","device":1,"stage":"capture","samples":64,"total":310,"p50Us":1012,"p99Us":1090,"maxUs":1104}
+// {"type":"telemetry","device":1,"sendFailed":0,"retries":3,"gaveUp":0,"freeHeap":201344,"minFreeHeap":187220}
+//   device: 0 = Bridge, 1-6 = player, 240 = lightboard; one line per stage, then the counters
+//
+// Binary framing (negotiated): the Pi sends {"cmd":"hello","proto":3}, the
+// bridge answers {"type":"hello","proto":3} and from then on sends binary
+// frames instead of JSON lines. {"cmd":"hello","proto":0} goes back to JSON.
+// Both directions always accept either encoding, and debug text keeps
+// flowing between frames.
+//   [0xA5][0x5A][type][len][payload: len bytes][crc16 lo][crc16 hi]
+//   crc16 = CRC-16/CCITT-FALSE over type, len and payload
+// Multi-byte fields are little-endian; payload layouts are the PiFrame* structs.
+// =======================================================
+
+// ===================== Binary Framing =====================
+static const uint8_t PI_FRAME_SOF1 = 0xA5;
+static const uint8_t PI_FRAME_SOF2 = 0x5A;
+static const uint8_t PI_FRAME_MAX_PAYLOAD = 32;
+static const uint8_t PI_PROTO_VERSION = 3; // 3: N players (winner id, tie = 0xFF)
+
+// Bridge -> Pi
+enum PiFrameType : uint8_t {
+  PI_FRAME_HIT           = 0x01, // PiFrameHit
+  PI_FRAME_WINNER        = 0x02, // PiFrameWinner
+  PI_FRAME_STATUS        = 0x03, // PiFrameStatus (older bridges: u8 flags only)
+  PI_FRAME_RESET         = 0x04, // no payload
+  PI_FRAME_HIT_LOCATION  = 0x05, // PiFrameHitLocation
+  PI_FRAME_LB_STATE_REQ  = 0x06, // no payload
+  PI_FRAME_ERROR         = 0x07, // u8 code: PI_ERROR_* (PI_ERROR_PLAYER_DISCONNECTED: + u8 player)
+  PI_FRAME_QUIZ_ACTION   = 0x08, // u8 action: 1=next, 2=prev, 3=toggle
+  PI_FRAME_LB_STATE      = 0x09, // PiFrameLightboardState, after every board change
+  PI_FRAME_TELEM_STAGE   = 0x0A, // PiFrameTelemetryStage
+  PI_FRAME_TELEM_COUNTERS = 0x0B, // PiFrameTelemetryCounters
+  PI_FRAME_PLAYER_STATUS = 0x0C, // PiFramePlayerStatus, players 3 and up (PI_FRAME_STATUS has 1 and 2)
+
+  // Pi -> Bridge
+  PI_CMD_HEARTBEAT       = 0x81, // no payload
+  PI_CMD_RESET           = 0x82, // no payload
+  PI_CMD_AWARD           = 0x83, // PiFrameAward
+  PI_CMD_LB_SETTINGS     = 0x84, // PiFrameLightboardSettings
+  PI_CMD_LB_STATE        = 0x85, // PiFrameLightboardState
+  PI_CMD_QUIZ_ACTION     = 0x86  // u8 action: 1=next, 2=prev, 3=toggle
+};
+
+enum : uint8_t {
+  PI_STATUS_P1_CONNECTED  = 0x01,
+  PI_STATUS_P2_CONNECTED  = 0x02,
+  PI_STATUS_LB_CONNECTED  = 0x04,
+  PI_STATUS_P1_SYNCED     = 0x08,
+  PI_STATUS_P2_SYNCED     = 0x10
+};
+
+enum : uint8_t {
+  PI_PLAYER_CONNECTED = 0x01,
+  PI_PLAYER_SYNCED    = 0x02
+};
+
+enum : uint8_t {
+  PI_ERROR_P1_DISCONNECTED = 1,
+  PI_ERROR_P2_DISCONNECTED = 2,
+  PI_ERROR_LB_DISCONNECTED = 3,
+  PI_ERROR_LINE_OVERFLOW   = 4, // a Pi command line exceeded PI_LINE_MAX
+  PI_ERROR_PLAYER_DISCONNECTED = 5 // players 3 and up
+};
+
+typedef struct __attribute__((packed)) {
+  uint8_t  player;
+  int64_t  time;       // bridge-adjusted hit time (esp_timer µs)
+  uint16_t strength;
+} PiFrameHit;
+
+typedef struct __attribute__((packed)) {
+  uint8_t  winner;        // 0=none, player id, 0xFF=Tie
+  uint32_t marginUs;      // lead over the runner-up, 0 = no contest (or awarded by the Pi)
+  uint16_t uncertaintyUs; // tie threshold the margin was judged against
+} PiFrameWinner;
+
+typedef struct __attribute__((packed)) {
+  uint8_t  player;
+  uint8_t  mode;       // 0=none, 1=tdoa, 2=partial, 3=nearest
+  uint8_t  sensors;
+  int64_t  time;
+  int16_t  xMm;
+  int16_t  yMm;
+} PiFrameHitLocation;
+
+typedef struct __attribute__((packed)) {
+  uint16_t rttUs;      // minimum round trip in the sync window
+  uint16_t jitterUs10; // RMS offset residual, 0.1 µs units
+  int16_t  driftPpm100; // player crystal vs bridge, 0.01 ppm units
+} PiSyncQuality;
+
+// Free-running counters, wrap at 16 bits: the Pi diffs successive reports
+typedef struct __attribute__((packed)) {
+  uint16_t txPackets;
+  uint16_t rxPackets;
+  uint16_t airtimeMs;  // estimated, both directions
+} PiPeerTraffic;
+
+typedef struct __attribute__((packed)) {
+  uint8_t       flags; // PI_STATUS_*
+  PiSyncQuality sync[2];    // Players 1 and 2 (the Pi UI is two-player)
+  PiPeerTraffic traffic[3]; // Player 1, Player 2, lightboard
+} PiFrameStatus;
+
+typedef struct __attribute__((packed)) {
+  uint8_t       player;
+  uint8_t       flags; // PI_PLAYER_*
+  PiSyncQuality sync;
+  PiPeerTraffic traffic;
+} PiFramePlayerStatus;
+
+typedef struct __attribute__((packed)) {
+  uint8_t player;
+  uint8_t multiplier;
+} PiFrameAward;
+
+typedef struct __attribute__((packed)) {
+  uint8_t mode;
+  uint8_t p1Color;
+  uint8_t p2Color;
+} PiFrameLightboardSettings;
+
+typedef struct __attribute__((packed)) {
+  uint8_t mode;
+  uint8_t p1ColorIndex;
+  uint8_t p2ColorIndex;
+  int8_t  p1Pos;
+  int8_t  p2Pos;
+  uint8_t nextLedPos;
+  int8_t  tugBoundary;
+  int8_t  p1RacePos;
+  int8_t  p2RacePos;
+  uint8_t celebrating;
+  uint8_t winner;
+  uint8_t sequence[ESPNOW_LB_SEQ_BYTES]; // Score Order, 2 bits per LED (absent from older Pis)
+} PiFrameLightboardState;
+// Same layout as the board, so it copies straight in and out of lbBoard
+static_assert(sizeof(PiFrameLightboardState) == sizeof(MsgLightboardState) + ESPNOW_LB_SEQ_BYTES,
+              "PiFrameLightboardState must mirror MsgLightboardState");
+
+// Telemetry reports as the boards sent them, behind the reporting device's id
+typedef struct __attribute__((packed)) {
+  uint8_t           device; // ESPNOW_ID_*: 0 = Bridge, player id, 0xF0 = lightboard
+  MsgTelemetryStage stage;
+} PiFrameTelemetryStage;
+
+typedef struct __attribute__((packed)) {
+  uint8_t              device;
+  MsgTelemetryCounters counters;
+} PiFrameTelemetryCounters;
+
+bool piBinary = PI_BINARY_DEFAULT; // Bridge->Pi encoding (Pi->Bridge accepts both)
+
+// Incoming frame decoder state (bytes outside frames are JSON/text lines)
+enum PiRxState : uint8_t { PI_RX_TEXT, PI_RX_SOF2, PI_RX_TYPE, PI_RX_LEN, PI_RX_PAYLOAD, PI_RX_CRC_LO, PI_RX_CRC_HI };
+PiRxState piRxState = PI_RX_TEXT;
+uint8_t piRxType = 0;
+uint8_t piRxLen = 0;
+uint8_t piRxPos = 0;
+uint8_t piRxPayload[PI_FRAME_MAX_PAYLOAD];
+uint16_t piRxCrc = 0;
+uint32_t piRxCrcErrors = 0;
+
+static uint16_t crc16Update(uint16_t crc, uint8_t b) {
+  crc ^= (uint16_t)b << 8;
+  for (int i = 0; i < 8; i++) crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+  return crc;
+}
+
+void sendPiFrame(uint8_t type, const void *payload, uint8_t len) {
+  uint8_t frame[4 + PI_FRAME_MAX_PAYLOAD + 2];
+  if (len > PI_FRAME_MAX_PAYLOAD) return;
+  frame[0] = PI_FRAME_SOF1;
+  frame[1] = PI_FRAME_SOF2;
+  frame[2] = type;
+  frame[3] = len;
+  if (len) memcpy(&frame[4], payload, len);
+  uint16_t crc = 0xFFFF;
+  for (int i = 2; i < 4 + len; i++) crc = crc16Update(crc, frame[i]);
+  frame[4 + len] = crc & 0xFF;
+  frame[5 + len] = crc >> 8;
+  Serial.write(frame, 6 + len); // one write so frames are never split by debug prints
+}
 // =======================================================
 
 // ===================== ESP-NOW Callbacks =====================
+void postEvent(uint8_t kind, uint8_t len = 0);
+
+// Runs in the Wi-Fi task; the retransmit queue lives on the dispatcher
 void OnDataSent(const wifi_tx_info_t *info, esp_now_send_status_t status) {
-  // Debug: Serial.print("Send Status: ");
-  // Debug: Serial.println(status == ESP_NOW_SEND_SUCCESS ? "Success" : "Fail");
+  const uint32_t head = sendStatusHead.load(std::memory_order_relaxed);
+  if (head - sendStatusTail.load(std::memory_order_acquire) >= SEND_STATUS_RING) {
+    sendStatusLost = true;
+  } else {
+    sendStatusRing[head % SEND_STATUS_RING] = status == ESP_NOW_SEND_SUCCESS;
+    sendStatusHead.store(head + 1, std::memory_order_release);
+  }
+  postEvent(EVT_SEND_STATUS); // if this is dropped, the next event drains the ring
 }
 
+// Runs in the Wi-Fi task: copy the packet and its metadata, nothing else
 void OnDataRecv(const esp_now_recv_info_t *info, const uint8_t *data, int len) {
-  // Handle different message types based on length
-  if (len == sizeof(struct_message)) {
-    // Player 1 or Player 2 message
-    memcpy(&player1Data, data, sizeof(player1Data));
-    
-    if (player1Data.playerId == 1) {
-    // Learn Player 1 MAC dynamically to avoid manual entry issues
-    if (info && !player1MacLearned) {
-      memcpy(player1Address, info->src_addr, 6);
-      char macStr[18];
-      sprintf(macStr, "%02X:%02X:%02X:%02X:%02X:%02X", player1Address[0],player1Address[1],player1Address[2],player1Address[3],player1Address[4],player1Address[5]);
-      // Debug: Serial.printf("Discovered Player 1 MAC: %s\r\n", macStr);
-      esp_now_del_peer(player1Address); // ignore result
-      esp_now_peer_info_t p = {};
-      memcpy(p.peer_addr, player1Address, 6);
-      p.channel = 0;
-      p.encrypt = false;
-      if (esp_now_add_peer(&p) == ESP_OK) {
-        player1MacLearned = true;
-        // Debug: Serial.println("Player 1 peer added after discovery");
-      } else {
-        // Debug: Serial.println("Failed to add discovered Player 1 peer");
-      }
-    }
-    player1Connected = true;
-    lastHeartbeat = millis();
-
-    if (player1Data.action == 1) {
-      // Heartbeat - just update connection status (no need to send to Pi)
-    } else if (player1Data.action == 2) {
-      // Hit detected by Player 1
-      // Convert Player 1's timestamp to our time reference
-      uint32_t adjustedTime = player1Data.hitTime + clockOffset;
-      
-      // Deduplication: check if this is a duplicate hit
-      unsigned long now = millis();
-      if (adjustedTime == lastProcessedHitTime && player1Data.playerId == lastProcessedHitPlayer && 
-          (now - lastHitProcessTime) < HIT_DEBOUNCE_MS) {
-        Serial.printf("Duplicate hit from Player 1 ignored (time: %lu)\n", adjustedTime);
-        return;
-      }
-      
-      // Update deduplication tracking
-      lastProcessedHitTime = adjustedTime;
-      lastProcessedHitPlayer = player1Data.playerId;
-      lastHitProcessTime = now;
-      
-      player1HitTime = adjustedTime;
-      Serial.printf("Player 1 hit detected at %lu (adjusted from %lu) with strength %d\n", 
-                   adjustedTime, player1Data.hitTime, player1Data.hitStrength);
-      
-      // Send hit notification to Pi
-      sendToPi("{\"type\":\"hit\",\"player\":1,\"time\":" + String(adjustedTime) + ",\"strength\":" + String(player1Data.hitStrength) + "}");
-      
-      // Declare winner immediately if round active
-      if (gameActive) {
-        winner = "Player 1";
-        gameActive = false;
-        sendToPi("{\"type\":\"winner\",\"winner\":\"Player 1\"}");
-        // Debug: Serial.println("Winner declared: Player 1");
-      }
-    } else if (player1Data.action == 3) {
-      // Reset request from Player 1
-      resetGame();
-    } else if (player1Data.action == 4) {
-      // Clock synchronization response
-      uint32_t now = micros();
-      uint32_t roundTrip = now - player1Data.syncTime;
-      uint32_t player1Time = player1Data.roundTripTime;
-      
-      // Calculate clock offset: (Player1 time + roundTrip/2) - Bridge time
-      clockOffset = (player1Time + roundTrip/2) - now;
-      clockSynced = true;
-      lastSyncTime = millis();
-      
-      // Clock sync complete - no need to send to Pi
-      // Debug: Serial.printf("Clock sync: offset=%ld us, roundTrip=%lu us\n", clockOffset, roundTrip);
-    }
-    } else if (player1Data.playerId == 2) {
-    // Learn Player 2 MAC dynamically to avoid manual entry issues
-    if (info && !player2MacLearned) {
-      memcpy(player2Address, info->src_addr, 6);
-      char macStr[18];
-      sprintf(macStr, "%02X:%02X:%02X:%02X:%02X:%02X", player2Address[0],player2Address[1],player2Address[2],player2Address[3],player2Address[4],player2Address[5]);
-      // Debug: Serial.printf("Discovered Player 2 MAC: %s\r\n", macStr);
-      esp_now_del_peer(player2Address); // ignore result
-      esp_now_peer_info_t p = {};
-      memcpy(p.peer_addr, player2Address, 6);
-      p.channel = 0;
-      p.encrypt = false;
-      if (esp_now_add_peer(&p) == ESP_OK) {
-        player2MacLearned = true;
-        // Debug: Serial.println("Player 2 peer added after discovery");
-      } else {
-        // Debug: Serial.println("Failed to add discovered Player 2 peer");
-      }
-    }
-    player2Connected = true;
-    lastPlayer2Heartbeat = millis();
-    
-    // Copy to player2Data for consistency
-    memcpy(&player2Data, &player1Data, sizeof(player1Data));
-
-    if (player2Data.action == 1) {
-      // Heartbeat - just update connection status (no need to send to Pi)
-    } else if (player2Data.action == 2) {
-      // Hit detected by Player 2
-      // Convert Player 2's timestamp to our time reference
-      uint32_t adjustedTime = player2Data.hitTime + player2ClockOffset;
-      
-      // Deduplication: check if this is a duplicate hit
-      unsigned long now = millis();
-      if (adjustedTime == lastProcessedHitTime && player2Data.playerId == lastProcessedHitPlayer && 
-          (now - lastHitProcessTime) < HIT_DEBOUNCE_MS) {
-        Serial.printf("Duplicate hit from Player 2 ignored (time: %lu)\n", adjustedTime);
-        return;
-      }
-      
-      // Update deduplication tracking
-      lastProcessedHitTime = adjustedTime;
-      lastProcessedHitPlayer = player2Data.playerId;
-      lastHitProcessTime = now;
-      
-      player2HitTime = adjustedTime;
-      Serial.printf("Player 2 hit detected at %lu (adjusted from %lu) with strength %d\n", 
-                   adjustedTime, player2Data.hitTime, player2Data.hitStrength);
-      
-      // Send hit notification to Pi
-      sendToPi("{\"type\":\"hit\",\"player\":2,\"time\":" + String(adjustedTime) + ",\"strength\":" + String(player2Data.hitStrength) + "}");
-      
-      // Declare winner immediately if round active
-      if (gameActive) {
-        winner = "Player 2";
-        gameActive = false;
-        sendToPi("{\"type\":\"winner\",\"winner\":\"Player 2\"}");
-        // Debug: Serial.println("Winner declared: Player 2");
-      }
-    } else if (player2Data.action == 3) {
-      // Reset request from Player 2
-      resetGame();
-    } else if (player2Data.action == 4) {
-      // Clock synchronization response
-      uint32_t now = micros();
-      uint32_t roundTrip = now - player2Data.syncTime;
-      uint32_t player2Time = player2Data.roundTripTime;
-      
-      // Calculate clock offset: (Player2 time + roundTrip/2) - Bridge time
-      player2ClockOffset = (player2Time + roundTrip/2) - now;
-      player2ClockSynced = true;
-      lastPlayer2SyncTime = millis();
-      
-      // Clock sync complete - no need to send to Pi
-      // Debug: Serial.printf("Player 2 Clock sync: offset=%ld us, roundTrip=%lu us\n", player2ClockOffset, roundTrip);
-    }
+  BridgeEvent ev;
+  if (len < 0 || len > (int)sizeof(ev.data)) { oversizePackets++; return; }
+  ev.kind = EVT_ESPNOW;
+  ev.len = (uint8_t)len;
+  ev.rxUs = esp_timer_get_time();
+  if (info) {
+    memcpy(ev.srcMac, info->src_addr, 6);
+    ev.rssi = info->rx_ctrl ? (int8_t)info->rx_ctrl->rssi : 0;
+  } else {
+    memset(ev.srcMac, 0, 6);
+    ev.rssi = 0;
+  }
+  memcpy(ev.data, data, len);
+  if (xQueueSend(eventQueue, &ev, 0) != pdTRUE) eventQueueDrops++;
+}
+
+void postEvent(uint8_t kind, uint8_t len) {
+  BridgeEvent ev;
+  ev.kind = kind;
+  ev.len = len;
+  if (xQueueSend(eventQueue, &ev, 0) != pdTRUE) eventQueueDrops++;
+}
+
+// esp_timer task
+void onTickTimer(void *arg) {
+  postEvent(EVT_TICK);
+}
+
+void onRetryTimer(void *arg) {
+  postEvent(EVT_RETRY);
+}
+
+void onSettleTimer(void *arg) {
+  postEvent(EVT_SETTLE);
+}
+
+// UART event task
+void onPiSerialReceive() {
+  postEvent(EVT_SERIAL);
+}
+
+// Estimated time on air for one ESP-NOW frame at the default 1 Mbps rate:
+// long preamble + PLCP header, then MAC header, vendor action element and FCS
+static const uint32_t ESPNOW_PREAMBLE_US = 192;
+static const uint32_t ESPNOW_FRAME_OVERHEAD = 43;
+
+uint32_t espNowAirtimeUs(uint8_t len) {
+  return ESPNOW_PREAMBLE_US + (ESPNOW_FRAME_OVERHEAD + len) * 8;
+}
+
+static inline int macHash(const uint8_t *mac) {
+  return (mac[3] * 7 + mac[4] * 31 + mac[5]) & (MAC_INDEX_SIZE - 1);
+}
+
+int8_t macIndexFind(const uint8_t *mac) {
+  for (int i = 0, h = macHash(mac); i < MAC_INDEX_SIZE; i++, h = (h + 1) & (MAC_INDEX_SIZE - 1)) {
+    if (macIndex.peer[h] == PEER_NONE) return PEER_NONE;
+    if (macIndex.peer[h] != PEER_TOMBSTONE && memcmp(macIndex.mac[h], mac, 6) == 0) return macIndex.peer[h];
+  }
+  return PEER_NONE;
+}
+
+void macIndexRemove(const uint8_t *mac) {
+  for (int i = 0, h = macHash(mac); i < MAC_INDEX_SIZE; i++, h = (h + 1) & (MAC_INDEX_SIZE - 1)) {
+    if (macIndex.peer[h] == PEER_NONE) return;
+    if (macIndex.peer[h] != PEER_TOMBSTONE && memcmp(macIndex.mac[h], mac, 6) == 0) {
+      macIndex.peer[h] = PEER_TOMBSTONE;
+      return;
     }
-  } else if (len == sizeof(struct_lightboard_message)) {
-    // Lightboard message
-    memcpy(&lightboardData, data, sizeof(lightboardData));
-    
-    if (lightboardData.deviceId == 3) { // Lightboard
-      // Check if this is a reconnection (was disconnected, now connected)
-      bool wasDisconnected = !lightboardConnected;
-      
-      // Lightboard MAC is already known and peer is already added
-      lightboardWasConnected = lightboardConnected; // Store previous state
-      lightboardConnected = true;
-      lastLightboardHeartbeat = millis();
-      // Debug: Serial.println("Lightboard message received - connection confirmed");
-
-      if (lightboardData.action == 1) {
-        // Heartbeat - just update connection status (no need to send to Pi)
-        
-        // If this is a reconnection or first connection, request state from Pi
-        if (wasDisconnected || !lightboardWasConnected) {
-          Serial.println("Lightboard connected - requesting state from Pi");
-          // Request lightboard state from Pi
-          sendToPi("{\"type\":\"lightboardStateRequest\"}");
-        }
-      } else if (lightboardData.action == 7) {
-        // State request from lightboard - request state from Pi
-        Serial.println("Lightboard requested state - requesting from Pi");
-        sendToPi("{\"type\":\"lightboardStateRequest\"}");
-      }
+  }
+}
+
+void macIndexPut(const uint8_t *mac, int8_t peer) {
+  macIndexRemove(mac);
+  for (int i = 0, h = macHash(mac); i < MAC_INDEX_SIZE; i++, h = (h + 1) & (MAC_INDEX_SIZE - 1)) {
+    if (macIndex.peer[h] == PEER_NONE || macIndex.peer[h] == PEER_TOMBSTONE) {
+      memcpy(macIndex.mac[h], mac, 6);
+      macIndex.peer[h] = peer;
+      return;
     }
   }
 }
 
-// ===================== Lightboard Communication =====================
-void sendLightboardUpdate(uint8_t action) {
-  // Always send heartbeats (action 1) regardless of connection status
-  // Other actions require connection
-  if (!lightboardConnected && action != 1) return;
-  
-  lightboardData.deviceId = 1; // Bridge
-  lightboardData.action = action;
-  lightboardData.gameMode = lightboardGameMode;
-  lightboardData.p1ColorIndex = lightboardP1ColorIndex;
-  lightboardData.p2ColorIndex = lightboardP2ColorIndex;
-  lightboardData.p1Pos = lightboardP1Pos;
-  lightboardData.p2Pos = lightboardP2Pos;
-  lightboardData.nextLedPos = lightboardNextLedPos;
-  lightboardData.tugBoundary = lightboardTugBoundary;
-  lightboardData.p1RacePos = lightboardP1RacePos;
-  lightboardData.p2RacePos = lightboardP2RacePos;
-  
-  // Only send winner information for specific actions
-  if (action == 2) {
-    // Game state update - no winner information, just settings
-    lightboardData.celebrating = false;
-    lightboardData.winner = 0;
+PeerLink &linkFor(const uint8_t *mac) {
+  int8_t peer = macIndexFind(mac);
+  if (peer >= 0 && peer < ESPNOW_MAX_PLAYERS) return players.link[peer];
+  if (peer == PEER_BROADCAST) return broadcastLink;
+  return lightboardLink;
+}
+
+bool espNowRawSend(const uint8_t *mac, const uint8_t *pkt, uint8_t len) {
+  PeerLink &link = linkFor(mac);
+  link.txPackets++;
+  link.airtimeUs += espNowAirtimeUs(len);
+  link.lastTxMs = millis();
+  return esp_now_send(mac, pkt, len) == ESP_OK;
+}
+
+// One-shot timer for the earliest retransmit (dispatcher task only)
+void armRetryTimer() {
+  int64_t due = espNowTx.nextDueUs();
+  esp_timer_stop(retryTimer); // ignore result (not running)
+  if (!due) return;
+  int64_t wait = due - esp_timer_get_time();
+  esp_timer_start_once(retryTimer, wait > 50 ? (uint64_t)wait : 50);
+}
+
+// Header + payload to one peer; reliable types are retransmitted until acked
+void sendEspNow(const uint8_t *mac, uint8_t type, const void *payload, uint8_t len) {
+  uint8_t pkt[ESPNOW_MAX_PACKET];
+  uint16_t seq = linkFor(mac).txSeq++;
+  uint8_t n = espNowBuild(pkt, type, ESPNOW_ID_BRIDGE, bootId, seq, payload, len);
+  bool reliable = espNowIsReliable(type);
+  espNowTx.send(espNowRawSend, mac, pkt, n, reliable, seq, esp_timer_get_time());
+  if (reliable) armRetryTimer();
+}
+
+// Learn a player's MAC dynamically to avoid manual entry issues
+void learnPlayerMac(int slot, const uint8_t *srcMac) {
+  if (players.macLearned[slot]) return;
+  if (players.hasMac[slot]) macIndexRemove(players.mac[slot]);
+  memcpy(players.mac[slot], srcMac, 6);
+  players.hasMac[slot] = true;
+  macIndexPut(srcMac, slot);
+  esp_now_del_peer(srcMac); // ignore result
+  esp_now_peer_info_t p = {};
+  memcpy(p.peer_addr, srcMac, 6);
+  p.channel = 0;
+  p.encrypt = false;
+  if (esp_now_add_peer(&p) == ESP_OK) {
+    players.macLearned[slot] = true;
+    // Debug: Serial.println("Player peer added after discovery");
   } else {
-    // Other actions (heartbeat, mode change, reset) - include winner info
-    lightboardData.celebrating = lightboardCelebrating;
-    lightboardData.winner = lightboardWinner;
+    // Debug: Serial.println("Failed to add discovered player peer");
   }
-  
-  esp_now_send(lightboardAddress, (uint8_t*)&lightboardData, sizeof(lightboardData));
-  // Debug: Serial.printf("Sent lightboard update: action=%d, mode=%d\n", action, lightboardGameMode);
 }
 
-void updateLightboardGameState() {
-  // Send game state update to lightboard (mode, colors only)
-  // Individual points are handled by sendLightboardPointUpdate()
-  sendLightboardUpdate(2); // game-state action
+// Any packet from a device counts as a heartbeat
+void notePlayerSeen(int slot, const uint8_t *srcMac) {
+  learnPlayerMac(slot, srcMac);
+  players.connected[slot] = true;
+  players.lastSeenMs[slot] = millis();
 }
 
-void sendLightboardPointUpdate(uint8_t scoringPlayer) {
-  // Send point update to lightboard with which player scored
-  if (!lightboardConnected) return;
-  
-  lightboardData.deviceId = 1; // Bridge
-  lightboardData.action = 3; // point update
-  lightboardData.winner = scoringPlayer; // Send Player 1 or Player 2 directly
-  
-  esp_now_send(lightboardAddress, (uint8_t*)&lightboardData, sizeof(lightboardData));
-  // Debug: Serial.printf("Sent lightboard point update: Player %d scored\n", scoringPlayer);
+void noteLightboardSeen() {
+  // Lightboard MAC is already known and peer is already added
+  bool wasDisconnected = !lightboardConnected;
+  lightboardWasConnected = lightboardConnected; // Store previous state
+  lightboardConnected = true;
+  lastLightboardHeartbeat = millis();
+
+  // If this is a reconnection or first connection and the board was never
+  // restored, request state from Pi (otherwise the lightboard's own state
+  // request is answered from lbBoard)
+  if ((wasDisconnected || !lightboardWasConnected) && !lbBoard.version) {
+    Serial.println("Lightboard connected - requesting state from Pi");
+    piSendLightboardStateRequest();
+  }
+}
+
+// Peak-hold with slow decay: one slow (retransmitted) hit widens the
+// window at once, it narrows again over the following hits
+void noteHitLatency(int slot, int64_t latencyUs) {
+  if (latencyUs < 0) latencyUs = 0;
+  uint32_t lat = (uint32_t)min(latencyUs, (int64_t)SETTLE_MAX_US);
+  uint32_t &peak = players.hitLatencyUs[slot];
+  if (lat >= peak) peak = lat;
+  else peak -= (peak - lat) / 8;
+}
+
+uint32_t settleWindowUs() {
+  uint32_t worst = 0;
+  for (int i = 0; i < ESPNOW_MAX_PLAYERS; i++) {
+    if (players.connected[i] && players.hitLatencyUs[i] > worst) worst = players.hitLatencyUs[i];
+  }
+  if (!worst) return SETTLE_DEFAULT_US;
+  uint32_t w = worst + SETTLE_GUARD_US;
+  return w < SETTLE_MIN_US ? SETTLE_MIN_US : (w > SETTLE_MAX_US ? SETTLE_MAX_US : w);
+}
+
+// firstUs: the first hit's time (synced) or arrival. The window runs from the
+// hit itself, so time already spent in flight counts against it.
+void openSettleWindow(int64_t firstUs, int64_t rxUs) {
+  settling = true;
+  settleFirstRxUs = rxUs;
+  int64_t closeUs = firstUs + settleWindowUs();
+  int64_t wait = closeUs - rxUs;
+  esp_timer_stop(settleTimer); // ignore result (not running)
+  esp_timer_start_once(settleTimer, wait > 500 ? (uint64_t)wait : 500);
+}
+
+void closeSettleWindow() {
+  if (!settling) return;
+  settling = false;
+  gameActive = false;
+  roundOpen = false;
+  determineWinner();
+}
+
+void onMsgHit(uint8_t sender, const uint8_t *payload, int64_t rxUs) {
+  if (!espNowIsPlayer(sender)) return;
+  const int slot = sender - 1;
+  MsgHit hit;
+  memcpy(&hit, payload, sizeof(hit));
+
+  // Convert the player's timestamp to our time reference (retransmitted
+  // copies were already dropped by sequence number)
+  const ClockSync &cs = players.sync[slot];
+  int64_t adjustedTime = clockSyncToLocal(cs, hit.hitTime);
+
+  // A hit from before the scheduled round start is left over from the last
+  // round (or an early swing); only comparable once the player is synced
+  if (cs.count && adjustedTime < roundStartUs) {
+    earlyHits++;
+    Serial.printf("Player %d hit %lld us before round %u start ignored\n",
+                  sender, (long long)(roundStartUs - adjustedTime), roundId);
+    return;
+  }
+
+  if (cs.used) noteHitLatency(slot, rxUs - adjustedTime);
+  Serial.printf("Player %d hit detected at %lld (adjusted from %lld) with strength %d\n",
+                sender, (long long)adjustedTime, (long long)hit.hitTime, hit.strength);
+
+  // Send hit notification to Pi
+  piSendHit(sender, adjustedTime, hit.strength);
+
+  // During a round keep each player's earliest hit; the first one opens the
+  // settle window and determineWinner() runs when it closes
+  if (!gameActive) return;
+  arbNoteHit(players.hitTime, players.hitRxUs, slot, adjustedTime, rxUs);
+  if (!settling) openSettleWindow(cs.used ? adjustedTime : rxUs, rxUs);
+}
+
+void onMsgResetRequest(uint8_t sender, const uint8_t *payload, int64_t rxUs) {
+  // Reset request from a player
+  if (espNowIsPlayer(sender)) resetGame();
+}
+
+void onMsgClockSync(uint8_t sender, const uint8_t *payload, int64_t rxUs) {
+  // Clock synchronization response: t1 echoed, t2/t3 player receive/send, t4 our receive time
+  MsgClockSync m;
+  memcpy(&m, payload, sizeof(m));
+  if (!espNowIsPlayer(sender)) return;
+  clockSyncAddSample(players.sync[sender - 1], m.t1, m.t2, m.t3, rxUs);
+  players.synced[sender - 1] = true;
+}
+
+void onMsgHitLocation(uint8_t sender, const uint8_t *payload, int64_t rxUs) {
+  // Solved hit position - follows the hit packet once the player's solver is done
+  if (!espNowIsPlayer(sender)) return;
+  MsgHitLocation loc;
+  memcpy(&loc, payload, sizeof(loc));
+  int64_t adjustedTime = clockSyncToLocal(players.sync[sender - 1], loc.hitTime);
+  piSendHitLocation(sender, loc.mode, loc.sensors, adjustedTime, loc.xMm, loc.yMm);
+}
+
+void onMsgLightboardStateRequest(uint8_t sender, const uint8_t *payload, int64_t rxUs) {
+  // State request from lightboard (reboot, reconnect or a version gap):
+  // answered from lbBoard in one packet
+  if (sender != ESPNOW_ID_LIGHTBOARD) return;
+  if (!lbBoard.version) {
+    // Never restored: play on from the defaults, the Pi's copy replaces them when it answers
+    Serial.println("Lightboard requested state - requesting from Pi");
+    piSendLightboardStateRequest();
+    lbCommit();
+  }
+  Serial.println("Lightboard requested state - restoring from local copy");
+  sendLightboardStateRestore();
+}
+
+// Latest report per board, forwarded to the Pi from the tick
+DeviceTelemetry *telemetryFor(uint8_t sender) {
+  if (espNowIsPlayer(sender)) return &deviceTelem[sender - 1];
+  if (sender == ESPNOW_ID_LIGHTBOARD) return &deviceTelem[ESPNOW_MAX_PLAYERS];
+  return nullptr;
+}
+
+void onMsgTelemetryStage(uint8_t sender, const uint8_t *payload, int64_t rxUs) {
+  DeviceTelemetry *d = telemetryFor(sender);
+  MsgTelemetryStage m;
+  memcpy(&m, payload, sizeof(m));
+  if (!d || m.stage >= TELEM_STAGE_COUNT) return;
+  d->stage[m.stage] = m;
+  d->staleStages |= 1u << m.stage;
+}
+
+void onMsgTelemetryCounters(uint8_t sender, const uint8_t *payload, int64_t rxUs) {
+  DeviceTelemetry *d = telemetryFor(sender);
+  if (!d) return;
+  memcpy(&d->counters, payload, sizeof(d->counters));
+  d->countersStale = true;
 }
 
+// Incoming messages by EspNowMsgType (nullptr = ignored; heartbeats only
+// refresh the connection, which happens for every packet)
+typedef void (*EspNowHandler)(uint8_t sender, const uint8_t *payload, int64_t rxUs);
+static const EspNowHandler ESPNOW_HANDLERS[MSG_TYPE_COUNT] = {
+  nullptr,                      // 0x00
+  nullptr,                      // MSG_HEARTBEAT
+  onMsgHit,                     // MSG_HIT
+  onMsgResetRequest,            // MSG_RESET_REQUEST
+  onMsgClockSync,               // MSG_CLOCK_SYNC
+  onMsgHitLocation,             // MSG_HIT_LOCATION
+  nullptr,                      // 0x06 (retired)
+  nullptr,                      // 0x07 (retired)
+  nullptr,                      // 0x08 (retired)
+  nullptr,                      // 0x09 (retired)
+  nullptr,                      // MSG_LB_RESTORE (we only send it)
+  onMsgLightboardStateRequest,  // MSG_LB_STATE_REQ
+  nullptr,                      // MSG_LB_AWARD (we only send it)
+  nullptr,                      // MSG_ACK (handled in handleEspNowPacket)
+  nullptr,                      // MSG_ROUND_CONTROL (we only send it)
+  nullptr,                      // 0x0F (retired)
+  nullptr,                      // MSG_LB_DELTA (we only send it)
+  onMsgTelemetryStage,          // MSG_TELEMETRY_STAGE
+  onMsgTelemetryCounters        // MSG_TELEMETRY_COUNTERS
+};
+
+void handleEspNowPacket(const uint8_t *srcMac, const uint8_t *data, int len, int64_t rxUs) {
+  EspNowHeader hdr;
+  if (!espNowParse(data, len, hdr)) { malformedPackets++; return; }
+
+  EspNowSeqStats *seq;
+  PeerLink *link;
+  if (espNowIsPlayer(hdr.sender)) {
+    const int slot = hdr.sender - 1;
+    notePlayerSeen(slot, srcMac);
+    seq = &players.rxSeq[slot];
+    link = &players.link[slot];
+  } else if (hdr.sender == ESPNOW_ID_LIGHTBOARD) {
+    noteLightboardSeen();
+    seq = &lightboardSeq;
+    link = &lightboardLink;
+  } else {
+    return;
+  }
+  link->rxPackets++;
+  link->airtimeUs += espNowAirtimeUs((uint8_t)len);
+  // Acknowledge every copy: the sender retransmits until one ACK gets through
+  if (espNowIsReliable(hdr.type)) {
+    MsgAck ack = {hdr.seq};
+    sendEspNow(srcMac, MSG_ACK, &ack, sizeof(ack));
+  }
+  if (!espNowTrackSeq(*seq, hdr.boot, hdr.seq)) return; // duplicate
+
+  if (hdr.type == MSG_ACK) {
+    MsgAck ack;
+    memcpy(&ack, data + sizeof(EspNowHeader), sizeof(ack));
+    espNowTx.ack(srcMac, ack.seq);
+    armRetryTimer();
+    return;
+  }
+
+  EspNowHandler h = ESPNOW_HANDLERS[hdr.type];
+  if (h) h(hdr.sender, data + sizeof(EspNowHeader), rxUs);
+}
+
+// ===================== Lightboard Communication =====================
+// The lightboard gets the whole board on request; after that every change
+// goes out as one award or delta on top of the version it holds
 void sendLightboardStateRestore() {
-  // Send full state restore to lightboard (action 6 = state restore)
   if (!lightboardConnected) return;
-  
-  lightboardData.deviceId = 1; // Bridge
-  lightboardData.action = 6; // state restore
-  lightboardData.gameMode = lightboardGameMode;
-  lightboardData.p1ColorIndex = lightboardP1ColorIndex;
-  lightboardData.p2ColorIndex = lightboardP2ColorIndex;
-  lightboardData.p1Pos = lightboardP1Pos;
-  lightboardData.p2Pos = lightboardP2Pos;
-  lightboardData.nextLedPos = lightboardNextLedPos;
-  lightboardData.tugBoundary = lightboardTugBoundary;
-  lightboardData.p1RacePos = lightboardP1RacePos;
-  lightboardData.p2RacePos = lightboardP2RacePos;
-  lightboardData.celebrating = lightboardCelebrating;
-  lightboardData.winner = lightboardWinner;
-  
-  esp_now_send(lightboardAddress, (uint8_t*)&lightboardData, sizeof(lightboardData));
-  Serial.printf("Sent lightboard state restore: mode=%d, p1Pos=%d, p2Pos=%d\n", 
-               lightboardGameMode, lightboardP1Pos, lightboardP2Pos);
+  sendEspNow(lightboardAddress, MSG_LB_RESTORE, &lbBoard, sizeof(lbBoard));
+  lbSent = lbBoard;
+  lbSentValid = true;
+  Serial.printf("Sent lightboard state restore: v%u, mode=%d, p1Pos=%d, p2Pos=%d\n",
+               lbBoard.version, lbBoard.state.gameMode, lbBoard.state.p1Pos, lbBoard.state.p2Pos);
+}
+
+// Call after every change to lbBoard
+void lbCommit() {
+  lbBoard.version = espNowLbNextVersion(lbBoard.version);
+  lbBoardFromFlash = false;
+  rtcBoardSave();
+}
+
+// Report the board to the Pi and bring the lightboard up to date: the award
+// that produced it (the lightboard replays it with the same rules), else a
+// delta, else the whole board
+void lbPublish(const MsgLightboardAward *award) {
+  piSendLightboardState();
+  if (!lightboardConnected || (lbSentValid && lbSent.version == lbBoard.version)) return;
+
+  const bool next = lbSentValid && lbBoard.version == espNowLbNextVersion(lbSent.version);
+  MsgLightboardDelta d;
+  if (next && award) {
+    sendEspNow(lightboardAddress, MSG_LB_AWARD, award, sizeof(*award));
+  } else if (next && espNowLbDiff(lbSent, lbBoard, d)) {
+    sendEspNow(lightboardAddress, MSG_LB_DELTA, &d, sizeof(d));
+  } else {
+    sendLightboardStateRestore();
+    return;
+  }
+  lbSent = lbBoard;
+}
+
+// Score on the Bridge's board; the award stops at a win
+void lbAward(uint8_t playerId, uint8_t count, uint16_t stepIntervalMs) {
+  MsgLightboardSnapshot before = lbBoard;
+  uint8_t won = 0;
+  for (uint8_t i = 0; i < count && !won && !lbBoard.state.celebrating; i++) won = lbPoint(lbBoard, playerId);
+  if (memcmp(&before.state, &lbBoard.state, sizeof(lbBoard.state)) == 0 &&
+      memcmp(before.sequence, lbBoard.sequence, sizeof(lbBoard.sequence)) == 0) return; // board full or celebrating
+  lbCommit();
+  if (won) {
+    Serial.printf("Lightboard: Player %d wins (%s)\n", won, lbRulesFor(lbBoard.state.gameMode).name);
+    lbCelebrationEndMs = millis() + (unsigned long)count * stepIntervalMs + LB_CELEBRATION_MS;
+  }
+  MsgLightboardAward award = {playerId, count, stepIntervalMs, lbBoard.version};
+  lbPublish(&award);
 }
 
 void awardPointToPlayer(uint8_t playerId) {
@@ -424,28 +911,15 @@ void awardPointToPlayer(uint8_t playerId) {
     return;
   }
   
-  if (!lightboardConnected) {
-    // Debug: Serial.println("Lightboard not connected - cannot award point");
-    return;
-  }
-  
-  // Send point update to lightboard
-  sendLightboardPointUpdate(playerId);
+  // The board scores even while the lightboard is away; it catches up on reconnect
+  lbAward(playerId, 1, 0);
   
   // Update local game state
-  if (playerId == 1) {
-    winner = "Player 1";
-    player1HitTime = micros(); // Use current time as hit time
-  } else if (playerId == 2) {
-    winner = "Player 2";
-    player2HitTime = micros(); // Use current time as hit time
-  }
+  setWinner(playerId);
+  players.hitTime[playerId - 1] = esp_timer_get_time(); // Use current time as hit time
   
   // Send winner notification to Pi
-  sendToPi("{\"type\":\"winner\",\"winner\":\"" + winner + "\"}");
-  
-  // Update lightboard game state
-  updateLightboardGameState();
+  piSendWinner();
   
   Serial.printf("Awarded point to Player %d\n", playerId);
 }
@@ -466,149 +940,589 @@ void awardMultiplePointsToPlayer(uint8_t playerId, int multiplier) {
     return;
   }
   
-  if (!lightboardConnected) {
-    // Debug: Serial.println("Lightboard not connected - cannot award points");
-    return;
-  }
-  
-  
-  // Send multiple point updates to lightboard
-  for (int i = 0; i < multiplier; i++) {
-    sendLightboardPointUpdate(playerId);
-    delay(100); // Small delay between points for visual effect
-  }
-  
-  // Update lightboard game state (needed for proper LED progression)
-  updateLightboardGameState();
+  // One packet; the lightboard animates the steps so we return immediately
+  lbAward(playerId, (uint8_t)multiplier, AWARD_STEP_INTERVAL_MS);
   
   Serial.printf("Awarded %d points to Player %d\n", multiplier, playerId);
 }
 
 // ===================== Game Logic =====================
+void setWinner(uint8_t id, uint32_t marginUs, uint32_t uncertaintyUs) {
+  winnerId = id;
+  winnerMarginUs = marginUs;
+  winnerUncertaintyUs = uncertaintyUs;
+  if (id == WINNER_TIE) winner = "Tie";
+  else if (id) winner = "Player " + String(id);
+  else winner = "none";
+}
+
+void clearHits() {
+  for (int i = 0; i < ESPNOW_MAX_PLAYERS; i++) {
+    players.hitTime[i] = 0;
+    players.hitRxUs[i] = 0;
+  }
+}
+
+// One player's share of the timing error: sync jitter, or nothing usable
+// (-1) when the player has no sync fit
+float hitUncertaintyUs(int slot) {
+  const ClockSync &cs = players.sync[slot];
+  return cs.used ? SYNC_UNCERTAINTY_SIGMAS * cs.jitterUs : -1.0f;
+}
+
+// Earliest adjusted hit across all players that hit this round wins, unless
+// the margin is within the pair's sync uncertainty (arbitration.h)
 void determineWinner() {
-  if (player1HitTime > 0 && player2HitTime > 0) {
-    // Calculate time difference in microseconds
-    int32_t timeDiff = (int32_t)player1HitTime - (int32_t)player2HitTime;
-    
-    if (timeDiff < -100) { // Player 2 hit first (with 100us tolerance)
-      winner = "Player 2";
-      Serial.printf("Player 2 wins! Time diff: %ld us\n", -timeDiff);
-      
-      
-    } else if (timeDiff > 100) { // Player 1 hit first (with 100us tolerance)
-      winner = "Player 1";
-      Serial.printf("Player 1 wins! Time diff: %ld us\n", timeDiff);
-      
-      
-    } else {
-      winner = "Tie";
-      Serial.printf("It's a tie! Time diff: %ld us\n", timeDiff);
-    }
-    
-    // Send winner notification to Pi
-    sendToPi("{\"type\":\"winner\",\"winner\":\"" + winner + "\"}");
+  float uncertainty[ESPNOW_MAX_PLAYERS];
+  for (int i = 0; i < ESPNOW_MAX_PLAYERS; i++) uncertainty[i] = hitUncertaintyUs(i);
+  ArbResult r = arbitrate(players.hitTime, players.hitRxUs, uncertainty, ESPNOW_MAX_PLAYERS, TIE_WINDOW_US);
+  if (r.first < 0) return;
+
+  if (r.second < 0) {
+    setWinner(r.first + 1);
+    Serial.printf("Player %d wins (only hit)\n", r.first + 1);
+  } else {
+    setWinner(r.tie ? WINNER_TIE : r.first + 1, (uint32_t)r.marginUs, (uint32_t)r.uncertaintyUs);
+    Serial.printf("%s: margin %lld us over Player %d, uncertainty %.0f us%s\n",
+                  winner.c_str(), (long long)r.marginUs, r.second + 1, r.uncertaintyUs,
+                  r.synced ? "" : " (unsynced: arrival order)");
+  }
+  const uint32_t decidedUs = (uint32_t)esp_timer_get_time();
+  bridgeTelem.span(TELEM_DECIDE, (uint32_t)settleFirstRxUs, decidedUs);
+
+  // Send winner notification to Pi
+  piSendWinner();
+  bridgeTelem.span(TELEM_PI_SEND, decidedUs, (uint32_t)esp_timer_get_time());
+}
+
+// One broadcast re-arms every board at the same instant, whatever the number
+// of players. Each copy carries its own send time so a board that only got the
+// second still arms on schedule; boards ignore the repeat by round id.
+void broadcastRoundControl(uint8_t flags) {
+  roundId++;
+  roundStartUs = esp_timer_get_time() + ROUND_START_LEAD_US;
+  MsgRoundControl m = {roundId, 0, roundStartUs, flags};
+  for (int i = 0; i < ROUND_CONTROL_COPIES; i++) {
+    m.sentUs = esp_timer_get_time();
+    sendEspNow(ESPNOW_BROADCAST_ADDR, MSG_ROUND_CONTROL, &m, sizeof(m));
   }
 }
 
 void resetGame() {
-  winner = "none";
+  settling = false;
+  esp_timer_stop(settleTimer); // ignore result (not running)
+  setWinner(0);
   // Bridge is host only - no need to reset bridge hit time
-  player1HitTime = 0;
-  player2HitTime = 0;
+  clearHits();
   gameActive = true;
+  roundOpen = true;
   
-  // Reset hit deduplication tracking
-  lastProcessedHitTime = 0;
-  lastProcessedHitPlayer = 0;
-  lastHitProcessTime = 0;
-  
-  // Reset lightboard state
-  lightboardWinner = 0;
-  lightboardCelebrating = false;
-  lightboardP1Pos = -1;
-  lightboardP2Pos = 38;
-  lightboardNextLedPos = 0;
-  lightboardTugBoundary = 18;
-  lightboardP1RacePos = -1;
-  lightboardP2RacePos = -1;
-  
-  // Send reset to Player 1
-  myData.action = 3; // reset request
-  esp_now_send(player1Address, (uint8_t*)&myData, sizeof(myData));
-  
-  // Send reset to Player 2
-  esp_now_send(player2Address, (uint8_t*)&myData, sizeof(myData));
-  
-  // Send reset to lightboard
-  sendLightboardUpdate(5); // reset action
+  // New board in the current mode; the lightboard gets it as one delta
+  lbReset(lbBoard);
+  lbCommit();
+  lbCelebrationEndMs = 0;
+  lbPublish();
+
+  // New round for the players, in one broadcast
+  broadcastRoundControl(ROUND_FLAG_RESET_LIGHTBOARD);
   
   // Send reset notification to Pi
-  sendToPi("{\"type\":\"reset\"}");
+  piSendReset();
   
   // Debug: Serial.println("Game reset");
 }
 
 void resetGameForQuiz() {
   // Light version of reset for quiz navigation - doesn't reset lightboard state
-  winner = "none";
+  settling = false;
+  esp_timer_stop(settleTimer); // ignore result (not running)
+  setWinner(0);
   // Bridge is host only - no need to reset bridge hit time
-  player1HitTime = 0;
-  player2HitTime = 0;
+  clearHits();
   gameActive = true;
+  roundOpen = true;
+
+  // Players re-arm for the next question; the lightboard keeps its score
+  broadcastRoundControl(0);
   
   // Send reset notification to Pi
-  sendToPi("{\"type\":\"reset\"}");
+  piSendReset();
   
   // Debug: Serial.println("Game reset for quiz navigation");
 }
 
 // ===================== Clock Synchronization =====================
+// Fresh fit for a player, starting from its last measured drift: the first
+// probe then gives a usable offset model straight away
+void clockSyncSeed(int slot) {
+  clockSyncReset(players.sync[slot]);
+  players.sync[slot].drift = checkpointSaved.driftPpm[slot] * 1e-6;
+}
+
+// While a round is open the air is left to the hit packets: probes wait
+// until the round ends, unless the player has no usable fit yet or the
+// drift model has gone SYNC_MAX_DEFER_MS without a fresh sample
+bool syncProbeDue(const ClockSync &cs) {
+  if (!(gameActive && roundOpen)) return true;
+  if (cs.used == 0) return true;
+  return millis() - cs.lastProbeMs >= SYNC_MAX_DEFER_MS;
+}
+
 void syncClock() {
-  if (player1Connected && (millis() - lastSyncTime >= SYNC_INTERVAL)) {
-    myData.action = 4; // clock sync
-    myData.syncTime = micros();
-    myData.roundTripTime = 0;
-    esp_now_send(player1Address, (uint8_t*)&myData, sizeof(myData));
-    // Debug: Serial.println("Clock sync request sent to Player 1");
+  // Paced by the heartbeat tick (once per HEARTBEAT_INTERVAL_MS)
+  for (int i = 0; i < ESPNOW_MAX_PLAYERS; i++) {
+    if (!players.connected[i] || !syncProbeDue(players.sync[i])) continue;
+    MsgClockSync m = {esp_timer_get_time(), 0, 0};
+    sendEspNow(players.mac[i], MSG_CLOCK_SYNC, &m, sizeof(m));
+    players.sync[i].lastProbeMs = millis();
+    // Debug: Serial.printf("Clock sync request sent to Player %d\n", i + 1);
   }
-  
-  if (player2Connected && (millis() - lastPlayer2SyncTime >= SYNC_INTERVAL)) {
-    myData.action = 4; // clock sync
-    myData.syncTime = micros();
-    myData.roundTripTime = 0;
-    esp_now_send(player2Address, (uint8_t*)&myData, sizeof(myData));
-    // Debug: Serial.println("Clock sync request sent to Player 2");
+}
+
+// ===================== Persistence =====================
+void checkpointCapture(BridgeCheckpoint &cp) {
+  memset(&cp, 0, sizeof(cp));
+  cp.layout = CHECKPOINT_LAYOUT;
+  cp.board = lbBoard;
+  for (int i = 0; i < ESPNOW_MAX_PLAYERS; i++) {
+    if (players.hasMac[i] && memcmp(players.mac[i], PLAYER_MACS[i], 6) != 0) {
+      cp.macLearned |= 1 << i;
+      memcpy(cp.mac[i], players.mac[i], 6);
+    }
+    // Only a full window spans enough time for a real drift estimate;
+    // otherwise keep the stored one. Whole 0.1 ppm steps, so fit noise
+    // doesn't cause a write every checkpoint.
+    const ClockSync &cs = players.sync[i];
+    cp.driftPpm[i] = (cs.count == SYNC_WINDOW) ? roundf((float)(cs.drift * 1e7)) / 10.0f
+                                               : checkpointSaved.driftPpm[i];
+  }
+}
+
+// From the tick: write once the state has stopped changing for
+// CHECKPOINT_IDLE_MS and no round is open (a flash write stalls the radio
+// while hits may be arriving), or CHECKPOINT_MAX_DELAY_MS after the first
+// unsaved change, between rounds or not. Never inside a settle window.
+void checkpointPoll() {
+  const unsigned long now = millis();
+  BridgeCheckpoint cp;
+  checkpointCapture(cp);
+  if (memcmp(&cp, &checkpointPending, sizeof(cp)) != 0) {
+    checkpointPending = cp;
+    checkpointChangedMs = now;
+  }
+  if (memcmp(&checkpointPending, &checkpointSaved, sizeof(cp)) == 0) { checkpointDirtyMs = 0; return; }
+  if (!checkpointDirtyMs) checkpointDirtyMs = now ? now : 1;
+  if (settling) return;
+  const bool overdue = now - checkpointDirtyMs >= CHECKPOINT_MAX_DELAY_MS;
+  if (!overdue && (now - checkpointChangedMs < CHECKPOINT_IDLE_MS || (gameActive && roundOpen))) return;
+  if (checkpointStore.putBytes("checkpoint", &checkpointPending, sizeof(checkpointPending)) != sizeof(checkpointPending)) {
+    Serial.println("Checkpoint write failed");
+    return;
   }
+  checkpointSaved = checkpointPending;
+  checkpointDirtyMs = 0;
+  // Debug: Serial.printf("Checkpoint saved: board v%u\n", checkpointSaved.board.version);
+}
+
+void checkpointLoad() {
+  checkpointStore.begin("bridge", false);
+  BridgeCheckpoint cp;
+  if (checkpointStore.getBytesLength("checkpoint") == sizeof(cp) &&
+      checkpointStore.getBytes("checkpoint", &cp, sizeof(cp)) == sizeof(cp) &&
+      cp.layout == CHECKPOINT_LAYOUT) {
+    checkpointSaved = cp;
+    Serial.printf("Checkpoint loaded: board v%u, learned MACs 0x%02X\n", cp.board.version, cp.macLearned);
+  } else {
+    memset(&checkpointSaved, 0, sizeof(checkpointSaved)); // first boot or older layout
+  }
+  checkpointPending = checkpointSaved;
+}
+
+uint16_t rtcBoardCrc() {
+  uint16_t crc = 0xFFFF;
+  const uint8_t *p = (const uint8_t *)&rtcBoard;
+  for (size_t i = 0; i < offsetof(RtcBoard, crc); i++) crc = crc16Update(crc, p[i]);
+  return crc;
+}
+
+void rtcBoardSave() {
+  rtcBoard.magic = RTC_BOARD_MAGIC;
+  rtcBoard.board = lbBoard;
+  rtcBoard.crc = rtcBoardCrc();
+}
+
+// Board at boot: the RTC copy if it survived (crash, software reset), else
+// the last NVS checkpoint, else the default board until the Pi restores its copy
+void restoreBoard() {
+  if (rtcBoard.magic == RTC_BOARD_MAGIC && rtcBoard.crc == rtcBoardCrc() && rtcBoard.board.version) {
+    lbBoard = rtcBoard.board;
+    Serial.printf("Board v%u restored from RTC memory\n", lbBoard.version);
+  } else if (checkpointSaved.board.version) {
+    lbBoard = checkpointSaved.board;
+    lbBoardFromFlash = true;
+    Serial.printf("Board v%u restored from NVS\n", lbBoard.version);
+  } else {
+    // Default board (Territory, red vs blue)
+    lbSetMode(lbBoard, 1);
+    lbBoard.state.p1ColorIndex = 0;
+    lbBoard.state.p2ColorIndex = 1;
+    return;
+  }
+  // A board that was mid-celebration resets after the animation would have ended
+  if (lbBoard.state.celebrating) lbCelebrationEndMs = millis() + LB_CELEBRATION_MS;
 }
 
 // ===================== Serial Communication with Pi =====================
-void sendToPi(String message) {
-  Serial.println(message);
+// One JSON line built in a caller-owned (stack) buffer: no heap traffic and
+// no shared state between callers.
+// Values are fixed identifiers and numbers, so strings are not escaped.
+class PiJsonWriter {
+public:
+  explicit PiJsonWriter(const char *type) : len(0), first(true) {
+    raw("{");
+    str("type", type);
+  }
+  PiJsonWriter &num(const char *k, long v) { key(k); fmt("%ld", v); return *this; }
+  PiJsonWriter &unum(const char *k, unsigned long v) { key(k); fmt("%lu", v); return *this; }
+  PiJsonWriter &num64(const char *k, int64_t v) { key(k); fmt("%lld", (long long)v); return *this; }
+  PiJsonWriter &real(const char *k, double v) { key(k); fmt("%.2f", v); return *this; }
+  PiJsonWriter &boolean(const char *k, bool v) { key(k); raw(v ? "true" : "false"); return *this; }
+  PiJsonWriter &str(const char *k, const char *v) { key(k); raw("\""); raw(v); raw("\""); return *this; }
+  PiJsonWriter &list(const char *k, const uint8_t *v, size_t n) {
+    key(k);
+    raw("[");
+    for (size_t i = 0; i < n; i++) fmt(i ? ",%u" : "%u", v[i]);
+    raw("]");
+    return *this;
+  }
+  void send() {
+    raw("}\n");
+    sendToPi(buf, len);
+  }
+
+private:
+  char buf[640];  // longest line (status) is ~600 bytes with every counter at max
+  size_t len;
+  bool first;
+
+  void raw(const char *s) {
+    while (*s && len < sizeof(buf) - 1) buf[len++] = *s++;
+  }
+  void fmt(const char *f, ...) {
+    va_list ap;
+    va_start(ap, f);
+    int n = vsnprintf(buf + len, sizeof(buf) - len, f, ap);
+    va_end(ap);
+    if (n > 0) len += ((size_t)n < sizeof(buf) - len) ? (size_t)n : sizeof(buf) - 1 - len;
+  }
+  void key(const char *k) {
+    if (!first) raw(",");
+    first = false;
+    raw("\"");
+    raw(k);
+    raw("\":");
+  }
+};
+
+void sendToPi(const char *line, size_t len) {
+  Serial.write((const uint8_t*)line, len);
+}
+
+void piSendHit(uint8_t player, int64_t time, uint16_t strength) {
+  if (piBinary) {
+    PiFrameHit f = {player, time, strength};
+    sendPiFrame(PI_FRAME_HIT, &f, sizeof(f));
+    return;
+  }
+  PiJsonWriter("hit").num("player", player).num64("time", time).num("strength", strength).send();
+}
+
+void piSendHitLocation(uint8_t player, uint8_t mode, uint8_t sensors, int64_t time, int16_t xMm, int16_t yMm) {
+  if (piBinary) {
+    PiFrameHitLocation f = {player, mode, sensors, time, xMm, yMm};
+    sendPiFrame(PI_FRAME_HIT_LOCATION, &f, sizeof(f));
+    return;
+  }
+  static const char *LOCATION_MODES[] = {"none", "tdoa", "partial", "nearest"};
+  PiJsonWriter("hitLocation").num("player", player).num64("time", time).num("x", xMm).num("y", yMm)
+    .str("mode", mode < 4 ? LOCATION_MODES[mode] : "none").num("sensors", sensors).send();
+}
+
+void piSendWinner() {
+  if (piBinary) {
+    PiFrameWinner f = {winnerId, winnerMarginUs, (uint16_t)min(winnerUncertaintyUs, (uint32_t)UINT16_MAX)};
+    sendPiFrame(PI_FRAME_WINNER, &f, sizeof(f));
+    return;
+  }
+  PiJsonWriter("winner").str("winner", winner.c_str())
+    .unum("marginUs", winnerMarginUs).unum("uncertaintyUs", winnerUncertaintyUs).send();
+}
+
+PiSyncQuality piSyncQuality(const ClockSync &cs) {
+  PiSyncQuality q;
+  q.rttUs = cs.count ? (uint16_t)min(cs.minRttUs, (uint32_t)UINT16_MAX) : 0;
+  q.jitterUs10 = (uint16_t)min(cs.jitterUs * 10.0f, (float)UINT16_MAX);
+  q.driftPpm100 = (int16_t)lround(cs.drift * 1e8);
+  return q;
+}
+
+PiPeerTraffic piPeerTraffic(const PeerLink &link) {
+  PiPeerTraffic t;
+  t.txPackets = (uint16_t)link.txPackets;
+  t.rxPackets = (uint16_t)link.rxPackets;
+  t.airtimeMs = (uint16_t)(link.airtimeUs / 1000);
+  return t;
+}
+
+// Players 3 and up, one message each: the status line and frame are full
+// (and the Pi UI built on them is two-player)
+void piSendPlayerStatus(int slot) {
+  if (piBinary) {
+    PiFramePlayerStatus f;
+    f.player = slot + 1;
+    f.flags = (players.connected[slot] ? PI_PLAYER_CONNECTED : 0) |
+              (players.synced[slot] ? PI_PLAYER_SYNCED : 0);
+    f.sync = piSyncQuality(players.sync[slot]);
+    f.traffic = piPeerTraffic(players.link[slot]);
+    sendPiFrame(PI_FRAME_PLAYER_STATUS, &f, sizeof(f));
+    return;
+  }
+  PiJsonWriter("playerStatus")
+    .num("player", slot + 1)
+    .boolean("connected", players.connected[slot])
+    .boolean("clockSynced", players.synced[slot])
+    .unum("syncRttUs", players.sync[slot].minRttUs)
+    .real("syncJitterUs", players.sync[slot].jitterUs)
+    .real("driftPpm", players.sync[slot].drift * 1e6)
+    .unum("txPackets", players.link[slot].txPackets)
+    .unum("rxPackets", players.link[slot].rxPackets)
+    .unum("airtimeMs", (unsigned long)(players.link[slot].airtimeUs / 1000))
+    .send();
+}
+
+void piSendStatus() {
+  // Every player the Bridge can reach, beyond the two in the status itself
+  for (int i = 2; i < ESPNOW_MAX_PLAYERS; i++) {
+    if (players.hasMac[i] || players.connected[i]) piSendPlayerStatus(i);
+  }
+  if (piBinary) {
+    uint8_t flags = (players.connected[0] ? PI_STATUS_P1_CONNECTED : 0) |
+                    (players.connected[1] ? PI_STATUS_P2_CONNECTED : 0) |
+                    (lightboardConnected ? PI_STATUS_LB_CONNECTED : 0) |
+                    (players.synced[0] ? PI_STATUS_P1_SYNCED : 0) |
+                    (players.synced[1] ? PI_STATUS_P2_SYNCED : 0);
+    PiFrameStatus f;
+    f.flags = flags;
+    for (int i = 0; i < 2; i++) f.sync[i] = piSyncQuality(players.sync[i]);
+    f.traffic[0] = piPeerTraffic(players.link[0]);
+    f.traffic[1] = piPeerTraffic(players.link[1]);
+    f.traffic[2] = piPeerTraffic(lightboardLink);
+    sendPiFrame(PI_FRAME_STATUS, &f, sizeof(f));
+    return;
+  }
+  PiJsonWriter("status")
+    .boolean("player1Connected", players.connected[0])
+    .boolean("player2Connected", players.connected[1])
+    .boolean("lightboardConnected", lightboardConnected)
+    .boolean("clockSynced", players.synced[0])
+    .boolean("player2ClockSynced", players.synced[1])
+    .unum("player1SyncRttUs", players.sync[0].minRttUs)
+    .real("player1SyncJitterUs", players.sync[0].jitterUs)
+    .real("player1DriftPpm", players.sync[0].drift * 1e6)
+    .unum("player2SyncRttUs", players.sync[1].minRttUs)
+    .real("player2SyncJitterUs", players.sync[1].jitterUs)
+    .real("player2DriftPpm", players.sync[1].drift * 1e6)
+    .unum("player1TxPackets", players.link[0].txPackets)
+    .unum("player1RxPackets", players.link[0].rxPackets)
+    .unum("player1AirtimeMs", (unsigned long)(players.link[0].airtimeUs / 1000))
+    .unum("player2TxPackets", players.link[1].txPackets)
+    .unum("player2RxPackets", players.link[1].rxPackets)
+    .unum("player2AirtimeMs", (unsigned long)(players.link[1].airtimeUs / 1000))
+    .unum("lightboardTxPackets", lightboardLink.txPackets)
+    .unum("lightboardRxPackets", lightboardLink.rxPackets)
+    .unum("lightboardAirtimeMs", (unsigned long)(lightboardLink.airtimeUs / 1000))
+    .send();
+}
+
+void piSendReset() {
+  if (piBinary) { sendPiFrame(PI_FRAME_RESET, nullptr, 0); return; }
+  PiJsonWriter("reset").send();
+}
+
+void piSendLightboardStateRequest() {
+  if (piBinary) { sendPiFrame(PI_FRAME_LB_STATE_REQ, nullptr, 0); return; }
+  PiJsonWriter("lightboardStateRequest").send();
+}
+
+// The board after every change, so the Pi's copy (lightboard.json) can't drift
+void piSendLightboardState() {
+  const MsgLightboardState &b = lbBoard.state;
+  if (piBinary) {
+    PiFrameLightboardState f;
+    memcpy(&f, &b, sizeof(b));
+    memcpy(f.sequence, lbBoard.sequence, sizeof(f.sequence));
+    sendPiFrame(PI_FRAME_LB_STATE, &f, sizeof(f));
+    return;
+  }
+  uint8_t seq[LB_NUM_LEDS];
+  for (int i = 0; i < LB_NUM_LEDS; i++) seq[i] = espNowLbSeqGet(lbBoard.sequence, i);
+  PiJsonWriter("lightboardState")
+    .num("mode", b.gameMode).num("p1ColorIndex", b.p1ColorIndex).num("p2ColorIndex", b.p2ColorIndex)
+    .num("p1Pos", b.p1Pos).num("p2Pos", b.p2Pos).num("nextLedPos", b.nextLedPos)
+    .num("tugBoundary", b.tugBoundary).num("p1RacePos", b.p1RacePos).num("p2RacePos", b.p2RacePos)
+    .boolean("celebrating", b.celebrating).num("winner", b.winner)
+    .list("scoringSequence", seq, b.nextLedPos < LB_NUM_LEDS ? b.nextLedPos : LB_NUM_LEDS)
+    .send();
+}
+
+void piSendError(uint8_t code) {
+  if (piBinary) { sendPiFrame(PI_FRAME_ERROR, &code, 1); return; }
+  static const char *ERROR_MESSAGES[] = {"", "Player 1 disconnected", "Player 2 disconnected",
+                                         "Lightboard disconnected", "Pi command too long"};
+  if (code < 1 || code > 4) return;
+  PiJsonWriter("error").str("message", ERROR_MESSAGES[code]).send();
+}
+
+void piSendPlayerDisconnected(uint8_t playerId) {
+  if (playerId == 1) { piSendError(PI_ERROR_P1_DISCONNECTED); return; }
+  if (playerId == 2) { piSendError(PI_ERROR_P2_DISCONNECTED); return; }
+  if (piBinary) {
+    uint8_t f[2] = {PI_ERROR_PLAYER_DISCONNECTED, playerId};
+    sendPiFrame(PI_FRAME_ERROR, f, sizeof(f));
+    return;
+  }
+  char msg[24];
+  snprintf(msg, sizeof(msg), "Player %u disconnected", playerId);
+  PiJsonWriter("error").str("message", msg).send();
+}
+
+void piSendQuizAction(uint8_t action) {
+  if (piBinary) { sendPiFrame(PI_FRAME_QUIZ_ACTION, &action, 1); return; }
+  static const char *QUIZ_ACTIONS[] = {"", "next", "prev", "toggle"};
+  if (action < 1 || action > 3) return;
+  PiJsonWriter("quizAction").str("action", QUIZ_ACTIONS[action]).send();
+}
+
+void piSendTelemetry(uint8_t device, const MsgTelemetryStage &m) {
+  if (piBinary) {
+    PiFrameTelemetryStage f = {device, m};
+    sendPiFrame(PI_FRAME_TELEM_STAGE, &f, sizeof(f));
+    return;
+  }
+  PiJsonWriter("telemetry").num("device", device).str("stage", TELEMETRY_STAGE_NAMES[m.stage])
+    .num("samples", m.samples).unum("total", m.total)
+    .unum("p50Us", m.p50Us).unum("p99Us", m.p99Us).unum("maxUs", m.maxUs).send();
+}
+
+void piSendTelemetryCounters(uint8_t device, const MsgTelemetryCounters &c) {
+  if (piBinary) {
+    PiFrameTelemetryCounters f = {device, c};
+    sendPiFrame(PI_FRAME_TELEM_COUNTERS, &f, sizeof(f));
+    return;
+  }
+  PiJsonWriter("telemetry").num("device", device)
+    .unum("sendFailed", c.sendFailed).unum("retries", c.retries).unum("gaveUp", c.gaveUp)
+    .unum("freeHeap", c.freeHeap).unum("minFreeHeap", c.minFreeHeap).send();
 }
 
-void processPiCommand(String command) {
-  DynamicJsonDocument doc(1024);
-  deserializeJson(doc, command);
+// Snapshot our own stages and counters; the boards' last reports are already
+// marked stale as they arrive
+void telemetryReportStart() {
+  bridgeReport.staleStages = 0;
+  for (uint8_t s = 0; s < TELEM_STAGE_COUNT; s++) {
+    if (telemetrySummary(bridgeTelem.stage[s], s, bridgeReport.stage[s])) bridgeReport.staleStages |= 1u << s;
+  }
+  bridgeReport.counters = {bridgeTelem.sendFailed, espNowTx.stats.retries, espNowTx.stats.failed,
+                           ESP.getFreeHeap(), ESP.getMinFreeHeap()};
+  bridgeReport.countersStale = true;
+}
+
+// Up to budget lines of the report, ours first, then whatever the boards
+// reported since last time. False once nothing is left.
+bool piSendTelemetryLines(int budget) {
+  for (int i = -1; i < TELEM_DEVICES; i++) {
+    DeviceTelemetry &d = i < 0 ? bridgeReport : deviceTelem[i];
+    const uint8_t device = i < 0 ? ESPNOW_ID_BRIDGE : i < ESPNOW_MAX_PLAYERS ? i + 1 : ESPNOW_ID_LIGHTBOARD;
+    for (uint8_t s = 0; s < TELEM_STAGE_COUNT; s++) {
+      if (!(d.staleStages & (1u << s))) continue;
+      if (budget-- == 0) return true;
+      piSendTelemetry(device, d.stage[s]);
+      d.staleStages &= ~(1u << s);
+    }
+    if (d.countersStale) {
+      if (budget-- == 0) return true;
+      piSendTelemetryCounters(device, d.counters);
+      d.countersStale = false;
+    }
+  }
+  return false;
+}
+
+// ----- Command handlers shared by the JSON and binary paths -----
+void handlePiHeartbeat() {
+  piConnected = true;
+  lastPiHeartbeat = millis();
+  // Debug: Serial.println("Pi heartbeat received");
+
+  // Send status back to Pi
+  piSendStatus();
+}
+
+void applyLightboardSettings(int newMode, int newP1Color, int newP2Color) {
+  if (newMode >= 1 && newMode <= LB_NUM_MODES && newP1Color >= 0 && newP1Color < LB_NUM_COLORS &&
+      newP2Color >= 0 && newP2Color < LB_NUM_COLORS) {
+    if (lbBoard.state.gameMode != newMode) {
+      // Mode changed - new board in the new mode
+      lbSetMode(lbBoard, newMode);
+      lbCelebrationEndMs = 0;
+    }
+    // Colour changes keep the positions
+    lbBoard.state.p1ColorIndex = newP1Color;
+    lbBoard.state.p2ColorIndex = newP2Color;
+    Serial.printf("Lightboard settings updated: mode=%d, p1Color=%d, p2Color=%d\n", newMode, newP1Color, newP2Color);
+    lbCommit();
+    lbPublish();
+  }
+}
+
+// The Pi's copy replaces ours (Bridge reboot); a board restored mid-celebration
+// resets once its animation would have finished
+void lightboardStateRestored() {
+  lbCommit();
+  lbCelebrationEndMs = lbBoard.state.celebrating ? millis() + LB_CELEBRATION_MS : 0;
+  Serial.printf("Lightboard state restored: mode=%d, p1Pos=%d, p2Pos=%d\n", 
+               lbBoard.state.gameMode, lbBoard.state.p1Pos, lbBoard.state.p2Pos);
+  lbPublish();
+}
+
+// Parsed into one preallocated document, reused for every command (dispatcher task only)
+StaticJsonDocument<1536> piCommandDoc;
+
+void processPiCommand(const char *command, size_t len) {
+  JsonDocument &doc = piCommandDoc;
+  if (deserializeJson(doc, command, len)) return;
   
   if (doc.containsKey("cmd")) {
-    String cmd = doc["cmd"];
+    const char *cmd = doc["cmd"] | "";
     
-    if (cmd == "heartbeat") {
-      piConnected = true;
-      lastPiHeartbeat = millis();
-      // Debug: Serial.println("Pi heartbeat received");
+    if (strcmp(cmd, "heartbeat") == 0) {
+      handlePiHeartbeat();
       
-      // Send status back to Pi
-      sendToPi("{\"type\":\"status\",\"player1Connected\":" + String(player1Connected ? "true" : "false") + 
-               ",\"player2Connected\":" + String(player2Connected ? "true" : "false") + 
-               ",\"lightboardConnected\":" + String(lightboardConnected ? "true" : "false") + 
-               ",\"clockSynced\":" + String(clockSynced ? "true" : "false") + 
-               ",\"player2ClockSynced\":" + String(player2ClockSynced ? "true" : "false") + "}");
+    } else if (strcmp(cmd, "hello") == 0) {
+      // Encoding negotiation: the reply always goes out as JSON so any Pi can read it
+      int proto = doc.containsKey("proto") ? (int)doc["proto"] : 0;
+      piBinary = (proto == PI_PROTO_VERSION);
+      PiJsonWriter("hello").num("proto", piBinary ? PI_PROTO_VERSION : 0).send();
+      Serial.printf("Pi serial protocol: %s\n", piBinary ? "binary" : "json");
+      piSendStatus();
+      // The Pi's board before anyone scores, unless ours is known current
+      if (!lbBoard.version || lbBoardFromFlash) piSendLightboardStateRequest();
+      else piSendLightboardState();
       
-    } else if (cmd == "reset") {
+    } else if (strcmp(cmd, "reset") == 0) {
       resetGame();
       
-    } else if (cmd == "awardPoint") {
+    } else if (strcmp(cmd, "awardPoint") == 0) {
       if (doc.containsKey("player") && doc.containsKey("multiplier")) {
         int player = doc["player"];
         int multiplier = doc["multiplier"];
@@ -618,67 +1532,147 @@ void processPiCommand(String command) {
         }
       }
       
-    } else if (cmd == "lightboardSettings") {
+    } else if (strcmp(cmd, "lightboardSettings") == 0) {
       if (doc.containsKey("mode") && doc.containsKey("p1Color") && doc.containsKey("p2Color")) {
-        int newMode = doc["mode"];
-        int newP1Color = doc["p1Color"];
-        int newP2Color = doc["p2Color"];
-        
-        if (newMode >= 1 && newMode <= 6 && newP1Color >= 0 && newP1Color <= 4 && newP2Color >= 0 && newP2Color <= 4) {
-          bool modeChanged = (lightboardGameMode != newMode);
-          lightboardGameMode = newMode;
-          lightboardP1ColorIndex = newP1Color;
-          lightboardP2ColorIndex = newP2Color;
-          Serial.printf("Lightboard settings updated: mode=%d, p1Color=%d, p2Color=%d\n", newMode, newP1Color, newP2Color);
-          
-          if (modeChanged) {
-            // Mode changed - reset game positions
-            sendLightboardUpdate(4); // mode-change action
-          } else {
-            // Only colors changed - preserve game positions
-            sendLightboardUpdate(2); // game-state action (preserves positions)
-          }
-        }
+        applyLightboardSettings(doc["mode"], doc["p1Color"], doc["p2Color"]);
       }
       
-    } else if (cmd == "lightboardState") {
+    } else if (strcmp(cmd, "lightboardState") == 0) {
       // Received lightboard state from Pi - restore full game state
       if (doc.containsKey("gameState")) {
         JsonObject gameState = doc["gameState"];
         
-        if (gameState.containsKey("mode")) lightboardGameMode = gameState["mode"];
-        if (gameState.containsKey("p1ColorIndex")) lightboardP1ColorIndex = gameState["p1ColorIndex"];
-        if (gameState.containsKey("p2ColorIndex")) lightboardP2ColorIndex = gameState["p2ColorIndex"];
-        if (gameState.containsKey("p1Pos")) lightboardP1Pos = gameState["p1Pos"];
-        if (gameState.containsKey("p2Pos")) lightboardP2Pos = gameState["p2Pos"];
-        if (gameState.containsKey("nextLedPos")) lightboardNextLedPos = gameState["nextLedPos"];
-        if (gameState.containsKey("tugBoundary")) lightboardTugBoundary = gameState["tugBoundary"];
-        if (gameState.containsKey("p1RacePos")) lightboardP1RacePos = gameState["p1RacePos"];
-        if (gameState.containsKey("p2RacePos")) lightboardP2RacePos = gameState["p2RacePos"];
-        if (gameState.containsKey("celebrating")) lightboardCelebrating = gameState["celebrating"];
-        if (gameState.containsKey("winner")) lightboardWinner = gameState["winner"];
-        
-        Serial.printf("Lightboard state restored: mode=%d, p1Pos=%d, p2Pos=%d\n", 
-                     lightboardGameMode, lightboardP1Pos, lightboardP2Pos);
+        MsgLightboardState &b = lbBoard.state;
+        if (gameState.containsKey("mode")) b.gameMode = gameState["mode"];
+        if (gameState.containsKey("p1ColorIndex")) b.p1ColorIndex = gameState["p1ColorIndex"];
+        if (gameState.containsKey("p2ColorIndex")) b.p2ColorIndex = gameState["p2ColorIndex"];
+        if (gameState.containsKey("p1Pos")) b.p1Pos = gameState["p1Pos"];
+        if (gameState.containsKey("p2Pos")) b.p2Pos = gameState["p2Pos"];
+        if (gameState.containsKey("nextLedPos")) b.nextLedPos = gameState["nextLedPos"];
+        if (gameState.containsKey("tugBoundary")) b.tugBoundary = gameState["tugBoundary"];
+        if (gameState.containsKey("p1RacePos")) b.p1RacePos = gameState["p1RacePos"];
+        if (gameState.containsKey("p2RacePos")) b.p2RacePos = gameState["p2RacePos"];
+        if (gameState.containsKey("celebrating")) b.celebrating = gameState["celebrating"];
+        if (gameState.containsKey("winner")) b.winner = gameState["winner"];
+        memset(lbBoard.sequence, 0, sizeof(lbBoard.sequence));
+        if (gameState.containsKey("scoringSequence")) {
+          JsonArray seq = gameState["scoringSequence"];
+          for (size_t i = 0; i < seq.size() && i < ESPNOW_LB_LEDS; i++) {
+            espNowLbSeqSet(lbBoard.sequence, i, (uint8_t)(seq[i] | 0));
+          }
+        }
         
-        // Send full state restore to lightboard (action 6 = state restore)
-        sendLightboardStateRestore();
+        lightboardStateRestored();
       }
       
-    } else if (cmd == "quizAction") {
+    } else if (strcmp(cmd, "quizAction") == 0) {
       if (doc.containsKey("action")) {
-        String action = doc["action"];
-        if (action == "next" || action == "prev" || action == "toggle") {
-          // Send quiz action notification to Pi
-          sendToPi("{\"type\":\"quizAction\",\"action\":\"" + action + "\"}");
-        }
+        const char *action = doc["action"] | "";
+        if (strcmp(action, "next") == 0) piSendQuizAction(1);
+        else if (strcmp(action, "prev") == 0) piSendQuizAction(2);
+        else if (strcmp(action, "toggle") == 0) piSendQuizAction(3);
       }
     }
   }
 }
 
+void processPiFrame(uint8_t type, const uint8_t *payload, uint8_t len) {
+  switch (type) {
+    case PI_CMD_HEARTBEAT:
+      handlePiHeartbeat();
+      break;
+    case PI_CMD_RESET:
+      resetGame();
+      break;
+    case PI_CMD_AWARD:
+      if (len == sizeof(PiFrameAward)) {
+        PiFrameAward f; memcpy(&f, payload, sizeof(f));
+        if (f.player == 1 || f.player == 2) awardMultiplePointsToPlayer(f.player, f.multiplier);
+      }
+      break;
+    case PI_CMD_LB_SETTINGS:
+      if (len == sizeof(PiFrameLightboardSettings)) {
+        PiFrameLightboardSettings f; memcpy(&f, payload, sizeof(f));
+        applyLightboardSettings(f.mode, f.p1Color, f.p2Color);
+      }
+      break;
+    case PI_CMD_LB_STATE:
+      if (len == sizeof(PiFrameLightboardState) || len == sizeof(PiFrameLightboardState) - ESPNOW_LB_SEQ_BYTES) {
+        PiFrameLightboardState f = {}; memcpy(&f, payload, len);
+        memcpy(&lbBoard.state, &f, sizeof(lbBoard.state));
+        memcpy(lbBoard.sequence, f.sequence, sizeof(lbBoard.sequence));
+        lightboardStateRestored();
+      }
+      break;
+    case PI_CMD_QUIZ_ACTION:
+      if (len == 1) piSendQuizAction(payload[0]);
+      break;
+    default:
+      Serial.printf("Unknown Pi frame type 0x%02X\n", type);
+      break;
+  }
+}
+
+// Feed one byte from the Pi: binary frames are decoded in place, anything
+// else is collected into newline-terminated JSON commands
+void piRxByte(uint8_t c) {
+  switch (piRxState) {
+    case PI_RX_TEXT:
+      if (c == PI_FRAME_SOF1) {
+        piRxState = PI_RX_SOF2;
+      } else if (c == '\n' || c == '\r') {
+        if (piLineLen > 0 && !piLineOverflow) {
+          piLine[piLineLen] = '\0';
+          processPiCommand(piLine, piLineLen);
+        }
+        piLineLen = 0;
+        piLineOverflow = false;
+      } else if (piLineLen < PI_LINE_MAX) {
+        piLine[piLineLen++] = (char)c;
+      } else if (!piLineOverflow) {
+        piLineOverflow = true;
+        piLineOverflows++;
+        Serial.printf("Pi command longer than %u bytes dropped (%lu so far)\n",
+                      (unsigned)PI_LINE_MAX, (unsigned long)piLineOverflows);
+        piSendError(PI_ERROR_LINE_OVERFLOW);
+      }
+      break;
+    case PI_RX_SOF2:
+      piRxState = (c == PI_FRAME_SOF2) ? PI_RX_TYPE : (c == PI_FRAME_SOF1 ? PI_RX_SOF2 : PI_RX_TEXT);
+      break;
+    case PI_RX_TYPE:
+      piRxType = c;
+      piRxCrc = crc16Update(0xFFFF, c);
+      piRxState = PI_RX_LEN;
+      break;
+    case PI_RX_LEN:
+      if (c > PI_FRAME_MAX_PAYLOAD) { piRxCrcErrors++; piRxState = PI_RX_TEXT; break; }
+      piRxLen = c;
+      piRxPos = 0;
+      piRxCrc = crc16Update(piRxCrc, c);
+      piRxState = c ? PI_RX_PAYLOAD : PI_RX_CRC_LO;
+      break;
+    case PI_RX_PAYLOAD:
+      piRxPayload[piRxPos++] = c;
+      piRxCrc = crc16Update(piRxCrc, c);
+      if (piRxPos >= piRxLen) piRxState = PI_RX_CRC_LO;
+      break;
+    case PI_RX_CRC_LO:
+      if (c != (piRxCrc & 0xFF)) { piRxCrcErrors++; piRxState = PI_RX_TEXT; break; }
+      piRxState = PI_RX_CRC_HI;
+      break;
+    case PI_RX_CRC_HI:
+      piRxState = PI_RX_TEXT;
+      if (c != (piRxCrc >> 8)) { piRxCrcErrors++; break; }
+      processPiFrame(piRxType, piRxPayload, piRxLen);
+      break;
+  }
+}
+
 // ===================== Setup =====================
 void setup(){
+  Serial.setRxBufferSize(PI_RX_BUFFER_SIZE); // must precede begin()
+  Serial.setTxBufferSize(PI_TX_BUFFER_SIZE);
   Serial.begin(115200);
   delay(50);
   Serial.println();
@@ -709,6 +1703,31 @@ void setup(){
     Serial.println(F("SoftAP start FAILED"));
   }
 
+  // Learned MACs, drift and board from the last checkpoint
+  checkpointLoad();
+
+  // Peer table from the configured MACs. Random starting sequence per link:
+  // a receiver that still remembers our previous boot must not take the new
+  // packets for retransmits
+  memset(macIndex.peer, PEER_NONE, sizeof(macIndex.peer));
+  for (int i = 0; i < ESPNOW_MAX_PLAYERS; i++) {
+    static const uint8_t NO_MAC[6] = {0};
+    memcpy(players.mac[i], PLAYER_MACS[i], 6);
+    players.hasMac[i] = memcmp(PLAYER_MACS[i], NO_MAC, 6) != 0;
+    if (!players.hasMac[i] && (checkpointSaved.macLearned & (1 << i))) {
+      // Learned before the reboot: add the peer now instead of waiting for discovery
+      memcpy(players.mac[i], checkpointSaved.mac[i], 6);
+      players.hasMac[i] = true;
+    }
+    if (players.hasMac[i]) macIndexPut(players.mac[i], i);
+    players.link[i].txSeq = (uint16_t)esp_random();
+  }
+  macIndexPut(lightboardAddress, PEER_LIGHTBOARD);
+  macIndexPut(ESPNOW_BROADCAST_ADDR, PEER_BROADCAST);
+  lightboardLink.txSeq = (uint16_t)esp_random();
+  broadcastLink.txSeq = (uint16_t)esp_random();
+  bootId = (uint16_t)esp_random(); // receivers must not mistake a reboot for retransmits
+
   // ESP-NOW setup
   if (esp_now_init() != ESP_OK) {
     Serial.println("Error initializing ESP-NOW");
@@ -718,30 +1737,36 @@ void setup(){
   // Clear any existing peers to ensure clean state
   esp_now_del_peer(ESPNOW_BROADCAST_ADDR);
   Serial.println("Cleared existing ESP-NOW peers");
-  
-  esp_now_register_send_cb(OnDataSent);
-  esp_now_register_recv_cb(OnDataRecv);
 
-  // Add Player 1 peer with known MAC address
-  esp_now_peer_info_t peerInfo = {};
-  memcpy(peerInfo.peer_addr, player1Address, 6);
-  peerInfo.channel = 0; // follow current channel
-  peerInfo.encrypt = false;
-  if (esp_now_add_peer(&peerInfo) == ESP_OK) {
-    Serial.println("Player 1 peer added successfully");
+  // Broadcast peer for round control (STA interface, same channel as the AP)
+  esp_now_peer_info_t broadcastPeerInfo = {};
+  memcpy(broadcastPeerInfo.peer_addr, ESPNOW_BROADCAST_ADDR, 6);
+  broadcastPeerInfo.channel = 0; // follow current channel
+  broadcastPeerInfo.encrypt = false;
+  if (esp_now_add_peer(&broadcastPeerInfo) == ESP_OK) {
+    Serial.println("Broadcast peer added successfully");
   } else {
-    Serial.println("Failed to add Player 1 peer");
+    Serial.println("Failed to add broadcast peer");
   }
+  
+  // Queue must exist before the receive callback can fire
+  eventQueue = xQueueCreate(EVENT_QUEUE_LEN, sizeof(BridgeEvent));
 
-  // Add Player 2 peer with known MAC address
-  esp_now_peer_info_t player2PeerInfo = {};
-  memcpy(player2PeerInfo.peer_addr, player2Address, 6);
-  player2PeerInfo.channel = 0; // follow current channel
-  player2PeerInfo.encrypt = false;
-  if (esp_now_add_peer(&player2PeerInfo) == ESP_OK) {
-    Serial.println("Player 2 peer added successfully");
-  } else {
-    Serial.println("Failed to add Player 2 peer");
+  esp_now_register_send_cb(OnDataSent);
+  esp_now_register_recv_cb(OnDataRecv);
+
+  // Add a peer for every player with a known MAC address
+  for (int i = 0; i < ESPNOW_MAX_PLAYERS; i++) {
+    if (!players.hasMac[i]) continue;
+    esp_now_peer_info_t peerInfo = {};
+    memcpy(peerInfo.peer_addr, players.mac[i], 6);
+    peerInfo.channel = 0; // follow current channel
+    peerInfo.encrypt = false;
+    if (esp_now_add_peer(&peerInfo) == ESP_OK) {
+      Serial.printf("Player %d peer added successfully\n", i + 1);
+    } else {
+      Serial.printf("Failed to add Player %d peer\n", i + 1);
+    }
   }
 
   // Add Lightboard peer with known MAC address
@@ -759,72 +1784,96 @@ if (esp_now_add_peer(&lightboardPeerInfo) == ESP_OK) {
   }
   // AP is already on channel 1 via softAP() call above
 
-  myData.playerId = 1;
 
   // Local hit detection disabled: Player 1 is host-only
   Serial.println(F("Local hit detection disabled (host-only)."));
 
   // Initialize game state
   gameActive = true;  // Ensure game starts active
-  winner = "none";
+  setWinner(0);
   // Bridge is host only - no need to initialize bridge hit time
-  player1HitTime = 0;
-  player2HitTime = 0;
-  clockSynced = false;
-  player2ClockSynced = false;
-  clockOffset = 0;
-  player2ClockOffset = 0;
+  clearHits();
+  for (int i = 0; i < ESPNOW_MAX_PLAYERS; i++) {
+    players.synced[i] = false;
+    clockSyncSeed(i);
+  }
+  restoreBoard();
+
+  // Warm start: probe every known player now rather than waiting for its
+  // heartbeat and the first tick; the reply connects and syncs it
+  for (int i = 0; i < ESPNOW_MAX_PLAYERS; i++) {
+    if (!players.hasMac[i]) continue;
+    MsgClockSync m = {esp_timer_get_time(), 0, 0};
+    sendEspNow(players.mac[i], MSG_CLOCK_SYNC, &m, sizeof(m));
+    players.sync[i].lastProbeMs = millis();
+  }
   
+  // Dispatcher task, fed by the ESP-NOW callback, the UART and the tick timer
+  xTaskCreatePinnedToCore(dispatcherTask, "dispatch", 6144, nullptr, DISPATCH_TASK_PRIO, &dispatchTask, DISPATCH_TASK_CORE);
+  Serial.onReceive(onPiSerialReceive);
+
+  const esp_timer_create_args_t tickArgs = {
+    .callback = &onTickTimer,
+    .arg = nullptr,
+    .dispatch_method = ESP_TIMER_TASK,
+    .name = "bridge_tick"
+  };
+  esp_timer_create(&tickArgs, &tickTimer);
+  esp_timer_start_periodic(tickTimer, HEARTBEAT_INTERVAL_MS * 1000ULL);
+
+  const esp_timer_create_args_t retryArgs = {
+    .callback = &onRetryTimer,
+    .arg = nullptr,
+    .dispatch_method = ESP_TIMER_TASK,
+    .name = "espnow_retry"
+  };
+  esp_timer_create(&retryArgs, &retryTimer);
+
+  const esp_timer_create_args_t settleArgs = {
+    .callback = &onSettleTimer,
+    .arg = nullptr,
+    .dispatch_method = ESP_TIMER_TASK,
+    .name = "arbitration"
+  };
+  esp_timer_create(&settleArgs, &settleTimer);
+
   Serial.println("ESP-NOW Bridge ready. Waiting for Pi connection...");
 }
 
-// ===================== Loop =====================
-void loop(){
-  const unsigned long nowUs = micros();
-  const unsigned long nowMs = millis();
+// ===================== Dispatcher =====================
+// Drain everything the UART has buffered in bulk reads (JSON lines or binary frames)
+void drainPiSerial() {
+  uint8_t rxChunk[64];
+  int rxAvail;
+  while ((rxAvail = Serial.available()) > 0) {
+    size_t n = Serial.read(rxChunk, rxAvail < (int)sizeof(rxChunk) ? rxAvail : sizeof(rxChunk));
+    for (size_t i = 0; i < n; i++) piRxByte(rxChunk[i]);
+  }
+}
 
+// Once per HEARTBEAT_INTERVAL_MS: clock sync, connection timeouts, heartbeats
+void bridgeTick() {
   // Clock synchronization
   syncClock();
 
-  // Local capture disabled: skip start/capture processing
-  // if (g_startPending) { ... }
-
-  // if (g_capturing && (nowUs - g_t0) >= CAPTURE_WINDOW_US) { ... }
-
-  // Process serial commands from Pi
-  if (Serial.available()) {
-    char c = Serial.read();
-    if (c == '\n' || c == '\r') {
-      if (serialBuffer.length() > 0) {
-        processPiCommand(serialBuffer);
-        serialBuffer = "";
-      }
-    } else {
-      serialBuffer += c;
-    }
-  }
+  checkpointPoll();
 
   // Check for Pi connection timeout
   if (piConnected && (millis() - lastPiHeartbeat > PI_HEARTBEAT_TIMEOUT)) {
     piConnected = false;
+    piBinary = PI_BINARY_DEFAULT; // a reconnecting Pi negotiates again
     // Debug: Serial.println("Pi connection lost");
   }
 
   // Check for connection timeout
-  if (player1Connected && (millis() - lastHeartbeat > heartbeatTimeout)) {
-    player1Connected = false;
-    clockSynced = false; // Reset sync when connection lost
-    player1MacLearned = false; // Reset MAC learning to force rediscovery
-    // Debug: Serial.println("Player 1 connection lost - resetting discovery");
-    sendToPi("{\"type\":\"error\",\"message\":\"Player 1 disconnected\"}");
-  }
-  
-  if (player2Connected && (millis() - lastPlayer2Heartbeat > heartbeatTimeout)) {
-    player2Connected = false;
-    player2ClockSynced = false; // Reset sync when connection lost
-    player2MacLearned = false; // Reset MAC learning to force rediscovery
-    // Debug: Serial.println("Player 2 connection lost - resetting discovery");
-    sendToPi("{\"type\":\"error\",\"message\":\"Player 2 disconnected\"}");
+  for (int i = 0; i < ESPNOW_MAX_PLAYERS; i++) {
+    if (!players.connected[i] || millis() - players.lastSeenMs[i] <= heartbeatTimeout) continue;
+    players.connected[i] = false;
+    players.synced[i] = false; // Reset sync when connection lost
+    clockSyncSeed(i);
+    players.macLearned[i] = false; // Reset MAC learning to force rediscovery
+    // Debug: Serial.printf("Player %d connection lost - resetting discovery\n", i + 1);
+    piSendPlayerDisconnected(i + 1);
   }
   
   // Check for lightboard connection timeout
@@ -832,33 +1881,148 @@ void loop(){
     lightboardWasConnected = lightboardConnected; // Store previous state
     lightboardConnected = false;
     lightboardMacLearned = false; // Reset MAC learning to force rediscovery
+    lbSentValid = false; // it asks for the whole board when it's back
     // Debug: Serial.println("Lightboard connection lost - resetting discovery");
-    sendToPi("{\"type\":\"error\",\"message\":\"Lightboard disconnected\"}");
+    piSendError(PI_ERROR_LB_DISCONNECTED);
   }
 
-  // Send heartbeat to Player 1
-  static unsigned long lastHeartbeatSend = 0;
-  if (millis() - lastHeartbeatSend >= HEARTBEAT_INTERVAL_MS) {
-    myData.action = 1; // heartbeat
-    esp_now_send(player1Address, (uint8_t*)&myData, sizeof(myData));
-    // Debug: Serial.println("Sent heartbeat to Player 1");
-    lastHeartbeatSend = millis();
+  // Heartbeats to every player with a MAC and the lightboard (always try,
+  // even if MAC not learned yet), skipped when a sync probe or other packet
+  // already went to that peer: receivers count any packet as liveness
+  unsigned long now = millis();
+  for (int i = 0; i < ESPNOW_MAX_PLAYERS; i++) {
+    if (players.hasMac[i] && now - players.link[i].lastTxMs >= LIVENESS_IDLE_MS) {
+      sendEspNow(players.mac[i], MSG_HEARTBEAT, nullptr, 0);
+    }
   }
-  
-  // Send heartbeat to Player 2
-  static unsigned long lastPlayer2HeartbeatSend = 0;
-  if (millis() - lastPlayer2HeartbeatSend >= HEARTBEAT_INTERVAL_MS) {
-    myData.action = 1; // heartbeat
-    esp_now_send(player2Address, (uint8_t*)&myData, sizeof(myData));
-    // Debug: Serial.println("Sent heartbeat to Player 2");
-    lastPlayer2HeartbeatSend = millis();
+  if (now - lightboardLink.lastTxMs >= LIVENESS_IDLE_MS) sendEspNow(lightboardAddress, MSG_HEARTBEAT, nullptr, 0);
+
+  // A won board resets once the lightboard has finished celebrating
+  if (lbCelebrationEndMs && (long)(now - lbCelebrationEndMs) >= 0) {
+    lbCelebrationEndMs = 0;
+    lbReset(lbBoard);
+    lbCommit();
+    lbPublish();
   }
-  
-  // Send heartbeat to lightboard (always try, even if MAC not learned yet)
-  static unsigned long lastLightboardHeartbeatSend = 0;
-  if (millis() - lastLightboardHeartbeatSend >= HEARTBEAT_INTERVAL_MS) {
-    sendLightboardUpdate(1); // heartbeat action
-    // Debug: Serial.println("Sent heartbeat to lightboard");
-    lastLightboardHeartbeatSend = millis();
+
+  // Trace reports, a few lines per tick and never while a round is open
+  if (piConnected && !settling && !(gameActive && roundOpen)) {
+    if (!telemetryReporting && now - lastTelemetryMs >= TELEMETRY_REPORT_MS) {
+      lastTelemetryMs = now;
+      telemetryReportStart();
+      telemetryReporting = true;
+    }
+    if (telemetryReporting) telemetryReporting = piSendTelemetryLines(TELEMETRY_LINES_PER_TICK);
+  }
+
+  static uint32_t reportedDrops = 0;
+  if (eventQueueDrops != reportedDrops) {
+    reportedDrops = eventQueueDrops;
+    Serial.printf("Event queue full: %lu events dropped so far\n", (unsigned long)reportedDrops);
+  }
+
+  static uint32_t reportedMalformed = 0;
+  if (malformedPackets != reportedMalformed) {
+    reportedMalformed = malformedPackets;
+    Serial.printf("Dropped malformed ESP-NOW packets (need protocol v%d): %lu so far\n",
+                  ESPNOW_PROTO_VERSION, (unsigned long)reportedMalformed);
+  }
+
+  // Packet loss per sender, from sequence gaps
+  static uint32_t reportedLost = 0;
+  uint32_t lost = lightboardSeq.lost;
+  for (int i = 0; i < ESPNOW_MAX_PLAYERS; i++) lost += players.rxSeq[i].lost;
+  if (lost != reportedLost) {
+    reportedLost = lost;
+    Serial.print("ESP-NOW loss (lost/received):");
+    for (int i = 0; i < ESPNOW_MAX_PLAYERS; i++) {
+      if (!players.rxSeq[i].seen) continue;
+      Serial.printf(" P%d %lu/%lu,", i + 1, (unsigned long)players.rxSeq[i].lost,
+                    (unsigned long)players.rxSeq[i].received);
+    }
+    Serial.printf(" LB %lu/%lu\n", (unsigned long)lightboardSeq.lost, (unsigned long)lightboardSeq.received);
+  }
+
+  // Sender reboots (new boot id): their sequence tracking started over
+  static uint32_t reportedRestarts = 0;
+  uint32_t restarts = lightboardSeq.restarts;
+  for (int i = 0; i < ESPNOW_MAX_PLAYERS; i++) restarts += players.rxSeq[i].restarts;
+  if (restarts != reportedRestarts) {
+    reportedRestarts = restarts;
+    Serial.print("ESP-NOW sender reboots:");
+    for (int i = 0; i < ESPNOW_MAX_PLAYERS; i++) {
+      if (players.rxSeq[i].restarts) Serial.printf(" P%d %lu,", i + 1, (unsigned long)players.rxSeq[i].restarts);
+    }
+    Serial.printf(" LB %lu\n", (unsigned long)lightboardSeq.restarts);
+  }
+
+  // Reliable sends: retransmissions and packets given up on
+  static uint32_t reportedRetries = 0;
+  static uint32_t reportedFailed = 0;
+  static uint32_t reportedResyncs = 0;
+  const EspNowTxStats &tx = espNowTx.stats;
+  if (tx.retries != reportedRetries || tx.failed != reportedFailed || tx.resyncs != reportedResyncs) {
+    reportedRetries = tx.retries;
+    reportedFailed = tx.failed;
+    reportedResyncs = tx.resyncs;
+    Serial.printf("ESP-NOW tx: %lu reliable, %lu retries, %lu failed, %lu unqueued, %lu resyncs\n",
+                  (unsigned long)tx.sent, (unsigned long)tx.retries,
+                  (unsigned long)tx.failed, (unsigned long)tx.overflow, (unsigned long)tx.resyncs);
+  }
+}
+
+// Send callback results since the last event, in order
+void drainSendStatus() {
+  const uint32_t head = sendStatusHead.load(std::memory_order_acquire);
+  uint32_t tail = sendStatusTail.load(std::memory_order_relaxed);
+  const bool lost = sendStatusLost.exchange(false);
+  if (tail == head && !lost) return;
+  const int64_t now = esp_timer_get_time();
+  for (; tail != head; tail++) {
+    const bool ok = sendStatusRing[tail % SEND_STATUS_RING];
+    if (!ok) bridgeTelem.sendFailed++;
+    espNowTx.sendStatus(ok, now);
+  }
+  sendStatusTail.store(tail, std::memory_order_release);
+  if (lost) espNowTx.resyncInflight();
+  armRetryTimer();
+}
+
+// All bridge state is owned by this task
+void dispatcherTask(void *arg) {
+  BridgeEvent ev;
+  for (;;) {
+    if (xQueueReceive(eventQueue, &ev, portMAX_DELAY) != pdTRUE) continue;
+    const uint32_t startUs = (uint32_t)esp_timer_get_time();
+    drainSendStatus(); // before any event, so ACK deadlines are current
+    switch (ev.kind) {
+      case EVT_ESPNOW:
+        handleEspNowPacket(ev.srcMac, ev.data, ev.len, ev.rxUs);
+        bridgeTelem.span(TELEM_DISPATCH, (uint32_t)ev.rxUs, (uint32_t)esp_timer_get_time());
+        break;
+      case EVT_TICK:
+        drainPiSerial(); // in case a UART receive event was missed
+        bridgeTick();
+        break;
+      case EVT_SERIAL:
+        drainPiSerial();
+        break;
+      case EVT_SEND_STATUS:
+        break; // drained above
+      case EVT_RETRY:
+        espNowTx.poll(espNowRawSend, esp_timer_get_time());
+        armRetryTimer();
+        break;
+      case EVT_SETTLE:
+        closeSettleWindow();
+        break;
+    }
+    bridgeTelem.span(TELEM_LOOP, startUs, (uint32_t)esp_timer_get_time());
   }
 }
+
+// ===================== Loop =====================
+void loop(){
+  // Everything runs on the dispatcher task; nothing to poll here
+  vTaskDelete(NULL);
+}
@@ -0,0 +1,62 @@
+// Round arbitration used by Bridge.ino: which player's hit came first. Plain
+// C++ with no Arduino dependencies so bench/ can build it on the host.
+//
+// Hit times are on the Bridge's timebase (clock_sync.h), 0 = no hit. The
+// earliest wins; its margin over the runner-up is judged against their
+// combined sync uncertainty (root sum of squares, at least tieWindowUs) and
+// within it the round is a tie. Without a sync fit on either side (negative
+// uncertainty), timestamps can't be compared and arrival order decides.
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+
+struct ArbResult {
+  int     first;         // slot of the winner, -1 = no hits
+  int     second;        // runner-up, -1 = only one hit
+  bool    tie;
+  bool    synced;        // decided on hit times, not arrival order
+  int64_t marginUs;      // lead over the runner-up (0 = uncontested)
+  float   uncertaintyUs; // what the margin was judged against
+};
+
+// Keep each player's earliest hit of the round (later ones, and copies the
+// sequence check missed, don't move it)
+static inline void arbNoteHit(int64_t *hitTime, int64_t *hitRxUs, int slot, int64_t timeUs, int64_t rxUs) {
+  if (!hitTime[slot] || timeUs < hitTime[slot]) {
+    hitTime[slot] = timeUs;
+    hitRxUs[slot] = rxUs;
+  }
+}
+
+// uncertaintyUs[i]: player i's share of the timing error, -1 = no sync fit
+static inline ArbResult arbitrate(const int64_t *hitTime, const int64_t *hitRxUs,
+                                  const float *uncertaintyUs, int n, float tieWindowUs) {
+  ArbResult r = {-1, -1, false, true, 0, 0.0f};
+  for (int i = 0; i < n; i++) {
+    if (hitTime[i] && uncertaintyUs[i] < 0) r.synced = false;
+  }
+  const int64_t *t = r.synced ? hitTime : hitRxUs;
+
+  for (int i = 0; i < n; i++) {
+    if (!hitTime[i]) continue;
+    if (r.first < 0 || t[i] < t[r.first]) {
+      r.second = r.first;
+      r.first = i;
+    } else if (r.second < 0 || t[i] < t[r.second]) {
+      r.second = i;
+    }
+  }
+  if (r.second < 0) return r;
+
+  r.marginUs = t[r.second] - t[r.first];
+  float u = tieWindowUs;
+  if (r.synced) {
+    float u1 = uncertaintyUs[r.first], u2 = uncertaintyUs[r.second];
+    float c = sqrtf(u1 * u1 + u2 * u2);
+    if (c > u) u = c;
+  }
+  r.uncertaintyUs = u;
+  r.tie = r.marginUs <= (int64_t)u;
+  return r;
+}
@@ -0,0 +1,65 @@
+// Board layout and hit sources shared by the host benches: synthetic hits
+// with known ground truth, and replayed "---- Capture ----" serial dumps.
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <random>
+#include <vector>
+
+#include "tdoa_solver.h"
+
+// Keep in sync with USER CONFIG in player_firmware.h
+static const int SENSOR_COUNT = 4;
+static const float SX[SENSOR_COUNT] = {0.200f, 0.200f, 0.300f, 0.100f};
+static const float SY[SENSOR_COUNT] = {0.100f, 0.300f, 0.200f, 0.200f};
+static const TdoaLimits LIMITS = {0.0f, 0.4f, 0.0f, 0.4f, 0.02f};
+static const float V_SOUND = 3000.0f; // m/s
+
+struct Sample {
+  unsigned long t[SENSOR_COUNT];
+  bool  hasTruth;
+  float x, y;
+};
+
+static inline void makeSample(float x, float y, float jitterUs, std::mt19937 &rng,
+                              unsigned long base, Sample &s)
+{
+  std::normal_distribution<float> noise(0.0f, jitterUs);
+  for (int i = 0; i < SENSOR_COUNT; i++) {
+    float d = sqrtf((x-SX[i])*(x-SX[i]) + (y-SY[i])*(y-SY[i]));
+    float us = d / V_SOUND * 1e6f + (jitterUs > 0 ? noise(rng) : 0.0f);
+    s.t[i] = base + (unsigned long)lroundf(us < 0 ? 0 : us) + 1; // never 0 (= missing)
+  }
+  s.hasTruth = true; s.x = x; s.y = y;
+}
+
+// Parse Player serial dumps:
+//   ---- Capture ----
+//   t0=123456789
+//   mask=0b1101
+//   S0: 12 us  | last=40 us, cnt=3
+//   S1: -  | last=- us, cnt=0
+static inline void loadCaptures(const char *path, std::vector<Sample> &out)
+{
+  FILE *f = fopen(path, "r");
+  if (!f) { fprintf(stderr, "cannot open %s\n", path); return; }
+  char line[256];
+  bool inCap = false; unsigned long t0 = 0; int seen = 0;
+  Sample s;
+  while (fgets(line, sizeof(line), f)) {
+    if (strstr(line, "---- Capture ----")) { inCap = true; seen = 0; t0 = 0; memset(&s, 0, sizeof(s)); continue; }
+    if (!inCap) continue;
+    const char *p;
+    if ((p = strstr(line, "t0="))) { t0 = strtoul(p + 3, nullptr, 10); continue; }
+    int idx; char rest[64];
+    if (sscanf(line, " S%d: %63s", &idx, rest) == 2 && idx >= 0 && idx < SENSOR_COUNT) {
+      // Relative to t0; offset by 1 so a zero delta is not read as "missing"
+      if (rest[0] != '-') s.t[idx] = t0 + 1 + strtoul(rest, nullptr, 10);
+      if (++seen == SENSOR_COUNT) { s.hasTruth = false; out.push_back(s); inCap = false; }
+    }
+  }
+  fclose(f);
+}
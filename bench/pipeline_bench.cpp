@@ -0,0 +1,350 @@
+// Host-side replay and benchmark of the capture -> solve -> arbitrate ->
+// render pipeline, built from the same headers the boards run:
+// tdoa_solver.h (player localisation chain), clock_sync.h and arbitration.h
+// (Bridge), espnow_protocol.h (duplicate suppression) and lightboard_rules.h
+// (modes and rendering).
+//
+// Build and run from this directory:
+//   g++ -O2 -std=c++17 -I.. pipeline_bench.cpp -o pipeline_bench
+//   ./pipeline_bench                      # synthetic hits only
+//   ./pipeline_bench capture.log          # also replay "---- Capture ----" serial dumps
+//   ./pipeline_bench --sync-jitter 80     # arbitration at this radio jitter (µs, repeatable)
+//
+// Solve: µs per hit and localisation error for each solver configuration,
+// on jittered synthetic hits (some with only two or three sensors) and on
+// replayed captures (error against the double reference solver, as they
+// have no ground truth).
+// Arbitrate: two players are synced through clock_sync.h over a radio with
+// the given one-way queuing jitter, then hit a known time apart. Hits arrive
+// with random latency, some twice (retransmits), and go through the Bridge's
+// duplicate check and arbitrate(). Reports how often the earlier hit wins,
+// how often the round is called a tie, and how often the later hit wins.
+// Render: per lightboard mode, the cost of a point (rules plus the LEDs it
+// touched) and of a full repaint.
+//
+// Timings are host numbers: compare configurations with them, don't read
+// them as ESP32 costs.
+
+#include <chrono>
+#include <algorithm>
+
+#include "tdoa_solver.h"
+#include "clock_sync.h"
+#include "arbitration.h"
+#include "espnow_protocol.h"
+#include "lightboard_rules.h"
+#include "bench_board.h"
+
+// Keep in sync with player_firmware.h / Bridge.ino
+static const int GRID_SIZE = 40;                    // TDOA_GRID_SIZE
+static const TdoaConfig PLAYER_TDOA = {true, 1};    // USE_FAST_TDOA, USE_TDOA_GRID
+static const float SYNC_UNCERTAINTY_SIGMAS = 3.0f;
+static const float TIE_WINDOW_US = 100.0f;
+
+typedef TdoaGrid<SENSOR_COUNT, GRID_SIZE> BenchGrid;
+static BenchGrid g_grid;
+
+typedef std::chrono::steady_clock Clock;
+static double nsSince(Clock::time_point start) {
+  return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+static float percentile(std::vector<float> v, float p) {
+  if (v.empty()) return 0.0f;
+  std::sort(v.begin(), v.end());
+  return v[(size_t)(p * (v.size() - 1))];
+}
+
+// ===================== Solve =====================
+struct SolveConfig {
+  const char *name;
+  TdoaConfig cfg;
+};
+
+static const SolveConfig SOLVE_CONFIGS[] = {
+  {"firmware", PLAYER_TDOA},
+  {"double",   {false, 0}},
+  {"float",    {true, 0}},
+  {"grid-all", {true, 2}},
+};
+
+static void benchSolve(const char *title, const std::vector<Sample> &set, const std::vector<Sample> *ref) {
+  printf("%s (%zu hits)\n", title, set.size());
+  for (const SolveConfig &sc : SOLVE_CONFIGS) {
+    const BenchGrid *grid = sc.cfg.gridUse ? &g_grid : nullptr;
+    const int reps = 50;
+    volatile float sink = 0;
+    Clock::time_point start = Clock::now();
+    for (int r = 0; r < reps; r++) {
+      for (const Sample &s : set) {
+        float x = 0, y = 0;
+        if (tdoaLocate(SX, SY, s.t, V_SOUND, LIMITS, sc.cfg, grid, x, y)) sink = sink + x;
+      }
+    }
+    const double usPerHit = nsSince(start) / 1000.0 / (double(reps) * set.size());
+
+    int modes[4] = {0, 0, 0, 0};
+    std::vector<float> err;
+    for (size_t k = 0; k < set.size(); k++) {
+      const Sample &s = set[k];
+      float x = 0, y = 0;
+      uint8_t mode = tdoaLocate(SX, SY, s.t, V_SOUND, LIMITS, sc.cfg, grid, x, y);
+      modes[mode]++;
+      if (!mode) continue;
+      if (s.hasTruth) err.push_back(1000.0f * hypotf(x - s.x, y - s.y));
+      else if (ref && (*ref)[k].hasTruth) err.push_back(1000.0f * hypotf(x - (*ref)[k].x, y - (*ref)[k].y));
+    }
+    float mean = 0;
+    for (float e : err) mean += e;
+    if (!err.empty()) mean /= err.size();
+    printf("  %-9s %7.3f us/hit  err mean %6.2f mm  p95 %6.2f mm  max %6.2f mm  tdoa %5d  partial %5d  nearest %5d\n",
+           sc.name, usPerHit, mean, percentile(err, 0.95f), percentile(err, 1.0f),
+           modes[TDOA_MODE_TDOA], modes[TDOA_MODE_PARTIAL], modes[TDOA_MODE_NEAREST]);
+  }
+}
+
+// Hits over the whole board; a share lose their latest sensors, as weak
+// wavefronts do on a real board
+static std::vector<Sample> syntheticHits(float jitterUs, std::mt19937 &rng) {
+  std::vector<Sample> set;
+  std::uniform_real_distribution<float> pos(0.02f, 0.38f);
+  std::uniform_real_distribution<float> u(0.0f, 1.0f);
+  for (int k = 0; k < 2000; k++) {
+    Sample s;
+    makeSample(pos(rng), pos(rng), jitterUs, rng, 1000000ul + rng() % 4000000000ul, s);
+    float drop = u(rng);
+    int keep = drop < 0.15f ? 2 : drop < 0.30f ? 3 : SENSOR_COUNT;
+    int order[SENSOR_COUNT];
+    for (int i = 0; i < SENSOR_COUNT; i++) order[i] = i;
+    std::sort(order, order + SENSOR_COUNT, [&](int a, int b) { return s.t[a] < s.t[b]; });
+    for (int i = keep; i < SENSOR_COUNT; i++) s.t[order[i]] = 0;
+    set.push_back(s);
+  }
+  return set;
+}
+
+// Reference positions for replayed captures: the same chain in double, no grid
+static std::vector<Sample> referenceFor(const std::vector<Sample> &caps) {
+  std::vector<Sample> ref = caps;
+  const TdoaConfig exact = {false, 0};
+  for (Sample &s : ref) {
+    s.hasTruth = tdoaLocate(SX, SY, s.t, V_SOUND, LIMITS, exact, (const BenchGrid *)nullptr, s.x, s.y) != TDOA_MODE_NONE;
+  }
+  return ref;
+}
+
+// ===================== Arbitrate =====================
+// A player's crystal against the Bridge's: player time = t + offset + drift * t
+struct SimPlayer {
+  double offsetUs;
+  double drift;
+  ClockSync sync;
+  uint16_t seq;
+  uint16_t boot;
+
+  int64_t clock(double t) const { return (int64_t)llround(t + offsetUs + drift * t); }
+};
+
+struct Radio {
+  double baseUs;     // fixed one-way latency
+  double jitterUs;   // mean queuing delay on top (exponential)
+  double hitBaseUs;  // hit packets: capture window close + send
+  std::exponential_distribution<double> queue;
+
+  Radio(double base, double jitter, double hitBase)
+    : baseUs(base), jitterUs(jitter), hitBaseUs(hitBase), queue(1.0 / (jitter > 0 ? jitter : 1e-3)) {}
+  double delay(std::mt19937 &rng) { return baseUs + (jitterUs > 0 ? queue(rng) : 0.0); }
+};
+
+// One probe per heartbeat for 20 s, as syncClock() does once connected
+static void simSync(SimPlayer &p, Radio &radio, double startUs, std::mt19937 &rng) {
+  clockSyncReset(p.sync);
+  for (int k = 0; k < 20; k++) {
+    double t1 = startUs + k * 1000000.0;
+    double atPlayer = t1 + radio.delay(rng);
+    int64_t t2 = p.clock(atPlayer);
+    int64_t t3 = t2 + 60; // turnaround
+    double t4 = atPlayer + 60 + radio.delay(rng);
+    clockSyncAddSample(p.sync, (int64_t)llround(t1), t2, t3, (int64_t)llround(t4));
+  }
+}
+
+struct ArbOutcome {
+  int right = 0, tie = 0, wrong = 0, rounds = 0;
+  long duplicates = 0;
+  double syncErrSq = 0;
+  double uncertainty = 0;
+};
+
+// deltaUs: how much earlier the first hit really was; unsyncedB: player B
+// has no sync fit, so arrival order decides
+static ArbOutcome simArbitrate(double radioJitterUs, double deltaUs, bool unsyncedB,
+                               int rounds, std::mt19937 &rng) {
+  ArbOutcome out;
+  std::uniform_real_distribution<double> offset(1e6, 1e9);
+  std::uniform_real_distribution<double> drift(-30e-6, 30e-6);
+  std::uniform_real_distribution<double> u(0.0, 1.0);
+  std::normal_distribution<double> capture(0.0, 1.0); // first-edge timestamp error
+  Radio radio(800.0, radioJitterUs, 2500.0);
+
+  SimPlayer pl[2];
+  for (int r = 0; r < rounds; r++) {
+    // Fresh clocks and sync every 50 rounds
+    if (r % 50 == 0) {
+      for (SimPlayer &p : pl) {
+        p.offsetUs = offset(rng);
+        p.drift = drift(rng);
+        p.seq = (uint16_t)rng();
+        p.boot = (uint16_t)rng();
+        simSync(p, radio, 1e6, rng);
+      }
+      if (unsyncedB) clockSyncReset(pl[1].sync);
+    }
+
+    // After the last probe, one round every 200 ms: up to 10 s on the drift fit
+    const double roundUs = 21e6 + (r % 50) * 200e3;
+    const int earlier = (int)(rng() & 1);
+    double hitUs[2];
+    hitUs[earlier] = roundUs;
+    hitUs[1 - earlier] = roundUs + deltaUs;
+
+    int64_t hitTime[2] = {0, 0}, hitRxUs[2] = {0, 0};
+    EspNowSeqStats seq[2] = {};
+    for (int i = 0; i < 2; i++) {
+      const int64_t stamp = pl[i].clock(hitUs[i] + capture(rng));
+      const uint16_t s = pl[i].seq++;
+      const int copies = u(rng) < 0.2 ? 2 : 1; // ack lost: the hit is sent again
+      for (int c = 0; c < copies; c++) {
+        const int64_t rx = (int64_t)llround(hitUs[i] + radio.hitBaseUs + radio.delay(rng) + c * 4000.0);
+        if (!espNowTrackSeq(seq[i], pl[i].boot, s)) continue;
+        const int64_t local = clockSyncToLocal(pl[i].sync, stamp);
+        arbNoteHit(hitTime, hitRxUs, i, local, rx);
+      }
+      out.duplicates += seq[i].duplicates;
+      if (pl[i].sync.count) {
+        const double e = (double)hitTime[i] - hitUs[i];
+        out.syncErrSq += e * e;
+      }
+    }
+    float uncertainty[2];
+    for (int i = 0; i < 2; i++) {
+      uncertainty[i] = pl[i].sync.used ? SYNC_UNCERTAINTY_SIGMAS * pl[i].sync.jitterUs : -1.0f;
+    }
+    ArbResult res = arbitrate(hitTime, hitRxUs, uncertainty, 2, TIE_WINDOW_US);
+
+    out.rounds++;
+    out.uncertainty += res.uncertaintyUs;
+    if (res.tie) out.tie++;
+    else if (res.first == earlier) out.right++;
+    else out.wrong++;
+  }
+  return out;
+}
+
+static void benchArbitrate(const std::vector<double> &jitters, std::mt19937 &rng) {
+  const double deltas[] = {0, 50, 100, 200, 500, 1000, 5000};
+  const int rounds = 2000;
+  for (double j : jitters) {
+    printf("Arbitration, radio jitter %.0f us (mean one-way queuing), %d rounds per margin\n", j, rounds);
+    for (int unsynced = 0; unsynced < 2; unsynced++) {
+      for (double d : deltas) {
+        ArbOutcome o = simArbitrate(j, d, unsynced != 0, rounds, rng);
+        const int syncedHits = unsynced ? o.rounds : 2 * o.rounds;
+        printf("  %-8s margin %5.0f us  earlier wins %5.1f%%  tie %5.1f%%  later wins %5.1f%%"
+               "  sync err rms %6.1f us  tie threshold %6.1f us  dupes dropped %ld\n",
+               unsynced ? "unsynced" : "synced", d,
+               100.0 * o.right / o.rounds, 100.0 * o.tie / o.rounds, 100.0 * o.wrong / o.rounds,
+               sqrt(o.syncErrSq / syncedHits), o.uncertainty / o.rounds, o.duplicates);
+      }
+    }
+  }
+
+  // The Bridge's own cost per round: the duplicate check and note per hit, then the decision
+  const int calls = 1000000;
+  const float uncertainty[2] = {30.0f, 40.0f};
+  volatile int sink = 0;
+  Clock::time_point start = Clock::now();
+  for (int k = 0; k < calls; k++) {
+    int64_t hitTime[2] = {0, 0}, hitRxUs[2] = {0, 0};
+    EspNowSeqStats seq = {};
+    for (int i = 0; i < 2; i++) {
+      if (espNowTrackSeq(seq, 1, (uint16_t)(k + i))) arbNoteHit(hitTime, hitRxUs, i, 1000000 + k + 150 * i, 2000000 + k);
+    }
+    sink = sink + arbitrate(hitTime, hitRxUs, uncertainty, 2, TIE_WINDOW_US).first;
+  }
+  printf("  arbitration cost %.1f ns/round (host)\n", nsSince(start) / calls);
+}
+
+// ===================== Render =====================
+static void benchRender(std::mt19937 &rng) {
+  const LbPalette pal = {0xFF0000, 0x0050FF, 0x802880};
+  uint32_t frame[LB_NUM_LEDS];
+  printf("Lightboard render (%d LEDs)\n", LB_NUM_LEDS);
+  for (uint8_t mode = 1; mode <= LB_NUM_MODES; mode++) {
+    const LbRules &rules = lbRulesFor(mode);
+    const int points = 200000;
+
+    // Points as the lightboard replays an award: rules, then the LEDs touched
+    MsgLightboardSnapshot b = {};
+    lbSetMode(b, mode);
+    int games = 0, touched = 0;
+    Clock::time_point start = Clock::now();
+    for (int k = 0; k < points; k++) {
+      LbTouched t;
+      if (lbPoint(b, 1 + (rng() & 1), &t)) { lbReset(b); games++; continue; }
+      if (t.a >= 0 && t.a < LB_NUM_LEDS) { frame[t.a] = rules.pixel(b, pal, t.a); touched++; }
+      if (t.b >= 0 && t.b < LB_NUM_LEDS && t.b != t.a) { frame[t.b] = rules.pixel(b, pal, t.b); touched++; }
+    }
+    const double pointNs = nsSince(start) / points;
+
+    // Full repaints of a mid-game board
+    lbSetMode(b, mode);
+    for (int k = 0; k < 10; k++) lbPoint(b, 1 + (k % 3 == 0));
+    const int frames = 100000;
+    volatile uint32_t sink = 0;
+    start = Clock::now();
+    for (int f = 0; f < frames; f++) {
+      for (int i = 0; i < LB_NUM_LEDS; i++) frame[i] = rules.pixel(b, pal, i);
+      sink = sink + frame[f % LB_NUM_LEDS];
+    }
+    const double frameNs = nsSince(start) / frames;
+
+    printf("  %-13s %6.1f ns/point (%.2f LEDs touched)  %7.1f ns/full repaint  %5.1f points/game\n",
+           rules.name, pointNs, double(touched) / points, frameNs,
+           games ? double(points) / games : 0.0);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  std::mt19937 rng(1234);
+  g_grid.build(SX, SY, V_SOUND, LIMITS);
+
+  std::vector<double> jitters;
+  std::vector<const char *> logs;
+  for (int a = 1; a < argc; a++) {
+    if (!strcmp(argv[a], "--sync-jitter") && a + 1 < argc) jitters.push_back(atof(argv[++a]));
+    else logs.push_back(argv[a]);
+  }
+  if (jitters.empty()) jitters = {10, 50, 200};
+
+  const float captureJitters[] = {0.0f, 1.0f, 3.0f};
+  for (float j : captureJitters) {
+    char title[64];
+    snprintf(title, sizeof(title), "Solve, synthetic, jitter %.0f us", j);
+    benchSolve(title, syntheticHits(j, rng), nullptr);
+  }
+  for (const char *log : logs) {
+    std::vector<Sample> caps;
+    loadCaptures(log, caps);
+    if (caps.empty()) { printf("%s: no captures\n", log); continue; }
+    std::vector<Sample> ref = referenceFor(caps);
+    char title[256];
+    snprintf(title, sizeof(title), "Solve, replay %s (vs double)", log);
+    benchSolve(title, caps, &ref);
+  }
+
+  benchArbitrate(jitters, rng);
+  benchRender(rng);
+  return 0;
+}
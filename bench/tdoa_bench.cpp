@@ -0,0 +1,185 @@
+// Host-side benchmark for the TDoA solvers in tdoa_solver.h (iterative
+// double/float solvers and the lookup grid).
+//
+// Build and run from this directory:
+//   g++ -O2 -std=c++17 -I.. tdoa_bench.cpp -o tdoa_bench
+//   ./tdoa_bench                 # synthetic sweep only
+//   ./tdoa_bench capture.log     # also replay "---- Capture ----" serial dumps
+//
+// Synthetic hits are generated on a grid over the board with known ground
+// truth, quantised to 1 µs and given random timing jitter. Replayed captures
+// have no ground truth, so they are compared against the reference solver.
+// Timings are host ns per solve: use them for the relative cost of the two
+// solvers, not as ESP32 numbers.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <algorithm>
+
+#include "tdoa_solver.h"
+#include "bench_board.h"
+
+struct Stats {
+  int solved = 0, total = 0;
+  long iters = 0;
+  std::vector<float> err; // mm
+  double ns = 0.0;
+};
+
+typedef bool (*SolveFn)(const float*, const float*, const unsigned long*, float,
+                        const TdoaLimits&, float&, float&, int&, int*);
+
+static TdoaGrid<SENSOR_COUNT, 40> g_grid;
+
+static bool gridSolve(const float*, const float*, const unsigned long *t, float,
+                      const TdoaLimits&, float &x, float &y, int &n, int *it)
+{
+  if (it) *it = 1;
+  return g_grid.solve(t, x, y, n);
+}
+
+// Reference for the coarse-to-fine search: every cell scanned
+static bool gridFullSolve(const float*, const float*, const unsigned long *t, float,
+                          const TdoaLimits&, float &x, float &y, int &n, int *it)
+{
+  if (it) *it = 1;
+  g_grid.exhaustive = true;
+  const bool ok = g_grid.solve(t, x, y, n);
+  g_grid.exhaustive = false;
+  return ok;
+}
+
+// Player fallback before the grid: scaled position of the first sensor to fire
+static bool nearestFallback(const float *sx, const float *sy, const unsigned long *t, float,
+                            const TdoaLimits&, float &x, float &y, int &n, int *it)
+{
+  int first = -1; unsigned long tf = ~0ul; n = 0;
+  for (int i = 0; i < SENSOR_COUNT; i++) {
+    if (!t[i]) continue;
+    n++;
+    if (t[i] < tf) { tf = t[i]; first = i; }
+  }
+  if (it) *it = 0;
+  if (first < 0) return false;
+  x = sx[first] * 0.8f; y = sy[first] * 0.8f;
+  return true;
+}
+
+static void run(const char *name, SolveFn fn, const std::vector<Sample> &set,
+                const std::vector<Sample> *refOut, std::vector<Sample> *resOut, Stats &st)
+{
+  const int reps = 200;
+  volatile float sink = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < reps; r++) {
+    for (const Sample &s : set) {
+      float x, y; int n;
+      if (fn(SX, SY, s.t, V_SOUND, LIMITS, x, y, n, nullptr)) sink = sink + x;
+    }
+  }
+  auto end = std::chrono::steady_clock::now();
+  st.ns = std::chrono::duration<double, std::nano>(end - start).count() / (double(reps) * set.size());
+
+  for (size_t k = 0; k < set.size(); k++) {
+    const Sample &s = set[k];
+    float x = 0, y = 0; int n, it = 0;
+    bool ok = fn(SX, SY, s.t, V_SOUND, LIMITS, x, y, n, &it);
+    st.total++;
+    if (resOut) { Sample o = s; o.hasTruth = ok; o.x = x; o.y = y; resOut->push_back(o); }
+    if (!ok) continue;
+    st.solved++; st.iters += it;
+    if (s.hasTruth) {
+      st.err.push_back(1000.0f * hypotf(x - s.x, y - s.y));
+    } else if (refOut && (*refOut)[k].hasTruth) {
+      st.err.push_back(1000.0f * hypotf(x - (*refOut)[k].x, y - (*refOut)[k].y));
+    }
+  }
+  (void)name;
+}
+
+static void report(const char *name, Stats &st)
+{
+  float mean = 0, p95 = 0, mx = 0;
+  if (!st.err.empty()) {
+    std::sort(st.err.begin(), st.err.end());
+    for (float e : st.err) mean += e;
+    mean /= st.err.size();
+    p95 = st.err[(size_t)(0.95 * (st.err.size() - 1))];
+    mx = st.err.back();
+  }
+  printf("  %-10s solved %5d/%-5d  err mean %6.2f mm  p95 %6.2f mm  max %6.2f mm  iters %4.1f  %7.1f ns/solve\n",
+         name, st.solved, st.total, mean, p95, mx,
+         st.solved ? double(st.iters) / st.solved : 0.0, st.ns);
+}
+
+static void compare(const char *title, const std::vector<Sample> &set, bool vsRef)
+{
+  printf("%s (%zu hits)\n", title, set.size());
+  Stats sd, sf, sg, sgf;
+  std::vector<Sample> refRes;
+  run("double", tdoaSolve<SENSOR_COUNT>, set, nullptr, &refRes, sd);
+  run("float", tdoaSolveF<SENSOR_COUNT>, set, vsRef ? &refRes : nullptr, nullptr, sf);
+  run("grid", gridSolve, set, vsRef ? &refRes : nullptr, nullptr, sg);
+  run("grid-full", gridFullSolve, set, vsRef ? &refRes : nullptr, nullptr, sgf);
+  report("double", sd);
+  report(vsRef ? "float/ref" : "float", sf);
+  report(vsRef ? "grid/ref" : "grid", sg);
+  report(vsRef ? "full/ref" : "grid-full", sgf);
+}
+
+// Only two sensors fired (the two nearest: far sensors see the weakest
+// wavefront). The iterative solvers give up, so compare the grid against the
+// old first-sensor fallback
+static void comparePairs(const char *title, std::vector<Sample> set)
+{
+  for (Sample &s : set) {
+    int order[SENSOR_COUNT];
+    for (int i = 0; i < SENSOR_COUNT; i++) order[i] = i;
+    std::sort(order, order + SENSOR_COUNT, [&](int a, int b) { return s.t[a] < s.t[b]; });
+    for (int k = 2; k < SENSOR_COUNT; k++) s.t[order[k]] = 0;
+  }
+  printf("%s (%zu hits)\n", title, set.size());
+  Stats sn, sg, sgf;
+  run("nearest", nearestFallback, set, nullptr, nullptr, sn);
+  run("grid", gridSolve, set, nullptr, nullptr, sg);
+  run("grid-full", gridFullSolve, set, nullptr, nullptr, sgf);
+  report("nearest", sn);
+  report("grid", sg);
+  report("grid-full", sgf);
+}
+
+int main(int argc, char **argv)
+{
+  std::mt19937 rng(1234);
+  g_grid.build(SX, SY, V_SOUND, LIMITS);
+
+  const float jitters[] = {0.0f, 1.0f, 3.0f};
+  for (float j : jitters) {
+    std::vector<Sample> set;
+    for (float x = 0.02f; x < 0.39f; x += 0.01f)
+      for (float y = 0.02f; y < 0.39f; y += 0.01f) {
+        Sample s; makeSample(x, y, j, rng, 1000000ul + rng() % 4000000000ul, s);
+        set.push_back(s);
+      }
+    char title[64];
+    snprintf(title, sizeof(title), "Synthetic grid, jitter %.0f us", j);
+    compare(title, set, false);
+    snprintf(title, sizeof(title), "Synthetic grid, 2 sensors, jitter %.0f us", j);
+    comparePairs(title, set);
+  }
+
+  for (int a = 1; a < argc; a++) {
+    std::vector<Sample> caps;
+    loadCaptures(argv[a], caps);
+    if (caps.empty()) { printf("%s: no captures\n", argv[a]); continue; }
+    char title[256];
+    snprintf(title, sizeof(title), "Replay %s (float vs double)", argv[a]);
+    compare(title, caps, true);
+  }
+  return 0;
+}
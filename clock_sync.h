@@ -0,0 +1,122 @@
+// Bridge <-> player clock synchronisation used by Bridge.ino. Plain C++ with
+// no Arduino dependencies so bench/ can build it on the host.
+//
+// Two-way exchange per probe (64-bit esp_timer_get_time() on both ends, so
+// nothing wraps): t1 bridge send, t2 player receive, t3 player send, t4 bridge
+// receive. offset = player - bridge = t2 - t1 - rtt/2,
+// rtt = (t4 - t1) - (t3 - t2). A window of samples is kept per player; only
+// those near the minimum RTT (least queuing) feed a linear fit of offset vs
+// time, whose slope is the crystal drift used to extrapolate between probes.
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+static const int SYNC_WINDOW = 16;                 // samples kept per player
+static const uint32_t SYNC_RTT_MARGIN_US = 150;    // accept samples within min RTT + margin
+static const uint32_t SYNC_MAX_RTT_US = 20000;     // discard outright (retransmits, stalls)
+static const int64_t SYNC_MIN_DRIFT_SPAN_US = 4000000; // fit drift only over >= 4 s of samples
+static const double SYNC_MAX_DRIFT = 200e-6;       // |drift| clamp (200 ppm)
+
+struct SyncSample {
+  int64_t  localUs;   // t4
+  int64_t  offsetUs;  // player - bridge
+  uint32_t rttUs;
+};
+
+struct ClockSync {
+  SyncSample samples[SYNC_WINDOW];
+  uint8_t  count;
+  uint8_t  next;
+  // Model: offset(t) = baseOffsetUs + biasUs + drift * (t - refUs)
+  int64_t  baseOffsetUs;
+  int64_t  refUs;
+  double   biasUs;
+  double   drift;       // µs per µs (1e-6 = 1 ppm)
+  uint32_t minRttUs;
+  float    jitterUs;    // RMS residual of the accepted samples around the fit
+  uint8_t  used;        // samples accepted into the last fit
+  uint32_t rejected;    // probes discarded for RTT > SYNC_MAX_RTT_US
+  unsigned long lastProbeMs;
+};
+
+static inline void clockSyncReset(ClockSync &cs) {
+  memset(&cs, 0, sizeof(cs));
+}
+
+// Refit the offset model from the samples near the minimum RTT
+static inline void clockSyncFit(ClockSync &cs) {
+  uint32_t minRtt = UINT32_MAX;
+  int best = 0;
+  for (int i = 0; i < cs.count; i++) {
+    if (cs.samples[i].rttUs < minRtt) { minRtt = cs.samples[i].rttUs; best = i; }
+  }
+  cs.minRttUs = minRtt;
+  cs.baseOffsetUs = cs.samples[best].offsetUs;
+  cs.refUs = cs.samples[best].localUs;
+
+  // Least squares y = a + b x over accepted samples, x/y relative to the best one
+  double sx = 0, sy = 0, sxx = 0, sxy = 0;
+  int64_t xMin = 0, xMax = 0;
+  int n = 0;
+  for (int i = 0; i < cs.count; i++) {
+    const SyncSample &smp = cs.samples[i];
+    if (smp.rttUs > minRtt + SYNC_RTT_MARGIN_US) continue;
+    int64_t dx = smp.localUs - cs.refUs;
+    double x = (double)dx;
+    double y = (double)(smp.offsetUs - cs.baseOffsetUs);
+    sx += x; sy += y; sxx += x * x; sxy += x * y;
+    if (dx < xMin) xMin = dx;
+    if (dx > xMax) xMax = dx;
+    n++;
+  }
+  cs.used = n;
+
+  double a = sy / n, b = 0.0;
+  double den = n * sxx - sx * sx;
+  if (n >= 3 && (xMax - xMin) >= SYNC_MIN_DRIFT_SPAN_US && den > 0) {
+    b = (n * sxy - sx * sy) / den;
+    if (b > SYNC_MAX_DRIFT) b = SYNC_MAX_DRIFT;
+    if (b < -SYNC_MAX_DRIFT) b = -SYNC_MAX_DRIFT;
+    a = (sy - b * sx) / n;
+  } else {
+    b = cs.drift; // keep the previous estimate until the window spans enough time
+    a = (sy - b * sx) / n;
+  }
+  cs.biasUs = a;
+  cs.drift = b;
+
+  double rss = 0;
+  for (int i = 0; i < cs.count; i++) {
+    const SyncSample &smp = cs.samples[i];
+    if (smp.rttUs > minRtt + SYNC_RTT_MARGIN_US) continue;
+    double r = (double)(smp.offsetUs - cs.baseOffsetUs) - (a + b * (double)(smp.localUs - cs.refUs));
+    rss += r * r;
+  }
+  cs.jitterUs = sqrt(rss / n);
+}
+
+static inline void clockSyncAddSample(ClockSync &cs, int64_t t1, int64_t t2, int64_t t3, int64_t t4) {
+  // A missing or implausible t3 means an instant turnaround
+  int64_t turnaround = t3 - t2;
+  if (turnaround < 0 || turnaround > 5000) turnaround = 0;
+  int64_t rtt = (t4 - t1) - turnaround;
+  if (rtt < 0 || rtt > SYNC_MAX_RTT_US) { cs.rejected++; return; }
+
+  SyncSample &smp = cs.samples[cs.next];
+  smp.localUs = t4;
+  smp.offsetUs = (t2 - t1) - rtt / 2;
+  smp.rttUs = (uint32_t)rtt;
+  cs.next = (cs.next + 1) % SYNC_WINDOW;
+  if (cs.count < SYNC_WINDOW) cs.count++;
+  clockSyncFit(cs);
+}
+
+// Player timebase -> bridge timebase, extrapolated with the drift estimate
+static inline int64_t clockSyncToLocal(const ClockSync &cs, int64_t remoteUs) {
+  if (cs.count == 0) return remoteUs;
+  int64_t approxLocal = remoteUs - cs.baseOffsetUs;
+  double corr = cs.biasUs + cs.drift * (double)(approxLocal - cs.refUs);
+  return approxLocal - llround(corr);
+}
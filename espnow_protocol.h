@@ -0,0 +1,516 @@
+// ESP-NOW wire format shared by Bridge.ino, the player firmware and
+// lightboard.cpp. Plain C++ with no Arduino dependencies.
+//
+// Every packet is a packed EspNowHeader followed by the payload for its type:
+//   [magic][version][type][sender][seq lo][seq hi][boot lo][boot hi][payload]
+// Receivers drop a packet unless magic, version and the exact payload length
+// for the type all match, then dispatch on type.
+//
+// Sequence numbers run per sender -> receiver link. boot is drawn at random
+// when the sender starts; a new value means it rebooted and restarts the
+// receiver's seq tracking for that link. Types in
+// ESPNOW_RELIABLE_TYPES are acknowledged with MSG_ACK and retransmitted by
+// EspNowTxQueue until acked; the receiver suppresses the duplicates by
+// sequence number. Heartbeats and clock sync stay fire-and-forget (a
+// retransmitted sync probe would only be a bad RTT sample).
+//
+// MSG_ROUND_CONTROL goes to ESPNOW_BROADCAST_ADDR: one frame reaches every
+// board at the same instant. Broadcasts carry their own sequence counter
+// (receivers keep a separate EspNowSeqStats for them) and are never acked.
+//
+// The Bridge owns the lightboard's board (rules: lightboard_rules.h) and
+// replicates it: MSG_LB_RESTORE with the full state (Score Order sequence
+// included), then MSG_LB_DELTA with only the fields that changed, or
+// MSG_LB_AWARD for points the lightboard animates itself. Each carries the
+// state version it produces; a lightboard that sees a gap asks for a fresh
+// restore (MSG_LB_STATE_REQ).
+//
+// Players and the lightboard report their latency trace points to the Bridge
+// (MSG_TELEMETRY_STAGE, MSG_TELEMETRY_COUNTERS; see telemetry.h). Reports are
+// fire-and-forget: a lost one is replaced by the next.
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+static const uint8_t ESPNOW_MAGIC = 0xCB;
+static const uint8_t ESPNOW_PROTO_VERSION = 6; // 3: packed header + typed payloads, 4: versioned lightboard state, 5: Bridge-owned board, 6: boot id
+
+static const uint8_t ESPNOW_BROADCAST_ADDR[6] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+
+// Sender ids (EspNowHeader.sender). Players use their player id,
+// 1..ESPNOW_MAX_PLAYERS.
+static const uint8_t ESPNOW_MAX_PLAYERS = 6;
+
+enum : uint8_t {
+  ESPNOW_ID_BRIDGE     = 0,
+  ESPNOW_ID_PLAYER1    = 1,
+  ESPNOW_ID_PLAYER2    = 2,
+  ESPNOW_ID_LIGHTBOARD = 0xF0
+};
+
+static inline bool espNowIsPlayer(uint8_t sender) {
+  return sender >= 1 && sender <= ESPNOW_MAX_PLAYERS;
+}
+
+enum EspNowMsgType : uint8_t {
+  MSG_HEARTBEAT     = 0x01, // no payload (any device)
+  MSG_HIT           = 0x02, // MsgHit (player -> bridge)
+  MSG_RESET_REQUEST = 0x03, // no payload (bridge <-> player)
+  MSG_CLOCK_SYNC    = 0x04, // MsgClockSync (bridge -> player request, player -> bridge reply)
+  MSG_HIT_LOCATION  = 0x05, // MsgHitLocation (player -> bridge)
+  // 0x06-0x09: retired lightboard commands (settings, point, mode, reset) -
+  // since v5 the Bridge sends the resulting state instead
+  MSG_LB_RESTORE    = 0x0A, // MsgLightboardSnapshot, full state (bridge -> lightboard)
+  MSG_LB_STATE_REQ  = 0x0B, // no payload: "send me a restore" (lightboard -> bridge)
+  MSG_LB_AWARD      = 0x0C, // MsgLightboardAward (bridge -> lightboard)
+  MSG_ACK           = 0x0D, // MsgAck (receiver of a reliable type -> sender)
+  MSG_ROUND_CONTROL = 0x0E, // MsgRoundControl (bridge -> broadcast)
+  // 0x0F: retired (v4 lightboard -> bridge snapshot)
+  MSG_LB_DELTA      = 0x10, // MsgLightboardDelta (bridge -> lightboard)
+  MSG_TELEMETRY_STAGE    = 0x11, // MsgTelemetryStage (player/lightboard -> bridge)
+  MSG_TELEMETRY_COUNTERS = 0x12, // MsgTelemetryCounters (player/lightboard -> bridge)
+  MSG_TYPE_COUNT
+};
+
+typedef struct __attribute__((packed)) {
+  uint8_t  magic;   // ESPNOW_MAGIC
+  uint8_t  version; // ESPNOW_PROTO_VERSION
+  uint8_t  type;    // EspNowMsgType
+  uint8_t  sender;  // ESPNOW_ID_* / player id
+  uint16_t seq;     // per-sender counter, +1 per packet sent (wraps)
+  uint16_t boot;    // random per sender boot: a new value restarts the receiver's tracking
+} EspNowHeader;
+
+typedef struct __attribute__((packed)) {
+  int64_t  hitTime;     // esp_timer_get_time() of the first edge
+  uint16_t strength;    // sensors that fired
+} MsgHit;
+
+// Request carries t1; the reply echoes t1 and adds the player's t2/t3
+typedef struct __attribute__((packed)) {
+  int64_t t1;           // bridge send time
+  int64_t t2;           // player receive time
+  int64_t t3;           // player send time
+} MsgClockSync;
+
+typedef struct __attribute__((packed)) {
+  int64_t hitTime;      // same timestamp as the matching MSG_HIT
+  int16_t xMm;          // impact position in mm, top-left origin
+  int16_t yMm;
+  uint8_t mode;         // 0=none, 1=tdoa, 2=partial, 3=nearest
+  uint8_t sensors;      // number of sensors that latched a first arrival
+} MsgHitLocation;
+
+typedef struct __attribute__((packed)) {
+  uint8_t gameMode;     // 1-6 (Territory, Swap Sides, Split Scoring, Score Order, Race, Tug O War)
+  uint8_t p1ColorIndex;
+  uint8_t p2ColorIndex;
+  int8_t  p1Pos;        // -1 to NUM_LEDS
+  int8_t  p2Pos;
+  uint8_t nextLedPos;   // Score Order
+  int8_t  tugBoundary;  // Tug O War, -1 once Player 2 has pulled it all the way
+  int8_t  p1RacePos;    // Race
+  int8_t  p2RacePos;
+  uint8_t celebrating;
+  uint8_t winner;       // 0=none, 1=Player1, 2=Player2
+} MsgLightboardState;
+
+// Points the lightboard animates itself with the shared rules, one step per
+// interval. The Bridge has already applied them: version is the state
+// version after the last step, valid only on top of version - 1.
+typedef struct __attribute__((packed)) {
+  uint8_t  player;         // 1=Player1, 2=Player2
+  uint8_t  count;          // points to award (1-10)
+  uint16_t stepIntervalMs; // delay between animated steps (0 = all at once)
+  uint16_t version;
+} MsgLightboardAward;
+
+typedef struct __attribute__((packed)) {
+  uint16_t seq;         // EspNowHeader.seq being acknowledged
+} MsgAck;
+
+enum : uint8_t {
+  ROUND_FLAG_RESET_LIGHTBOARD = 0x01  // full game reset, not a quiz question change (the
+                                      // reset board itself follows as MSG_LB_DELTA)
+};
+
+// New round for every board. startUs is in the Bridge timebase; receivers
+// arm at rxUs + (startUs - sentUs), since the frame reaches all of them at
+// the same moment
+typedef struct __attribute__((packed)) {
+  uint16_t roundId;     // +1 per round; repeats of the same round are ignored
+  int64_t  sentUs;      // Bridge esp_timer_get_time() when built
+  int64_t  startUs;     // Bridge time at which hits start counting
+  uint8_t  flags;       // ROUND_FLAG_*
+} MsgRoundControl;
+
+// One trace stage summarised over its recent window (telemetry.h)
+typedef struct __attribute__((packed)) {
+  uint8_t  stage;       // TelemetryStage
+  uint8_t  samples;     // in the window the percentiles cover
+  uint32_t total;       // recorded since boot
+  uint32_t p50Us;
+  uint32_t p99Us;
+  uint32_t maxUs;
+} MsgTelemetryStage;
+
+typedef struct __attribute__((packed)) {
+  uint32_t sendFailed;  // send callbacks reporting failure
+  uint32_t retries;     // reliable retransmissions (EspNowTxStats)
+  uint32_t gaveUp;      // reliable packets given up after ESPNOW_MAX_TRIES
+  uint32_t freeHeap;
+  uint32_t minFreeHeap; // low-water mark since boot
+} MsgTelemetryCounters;
+
+// ---- Replicated lightboard state ----
+static const uint8_t ESPNOW_LB_LEDS = 38;
+static const uint8_t ESPNOW_LB_SEQ_BYTES = (ESPNOW_LB_LEDS * 2 + 7) / 8; // 10
+
+// Full board. sequence holds the Score Order owner of each LED (0=none,
+// 1=Player1, 2=Player2), 2 bits per LED, LED 0 in the low bits of byte 0.
+typedef struct __attribute__((packed)) {
+  uint16_t version;     // +1 per change made by the Bridge, 0 = no state
+  MsgLightboardState state;
+  uint8_t  sequence[ESPNOW_LB_SEQ_BYTES];
+} MsgLightboardSnapshot;
+
+// Field ids for MsgLightboardChange; LB_FIELD_SEQ + i is LED i of the sequence
+enum : uint8_t {
+  LB_FIELD_MODE = 0, LB_FIELD_P1_COLOR, LB_FIELD_P2_COLOR, LB_FIELD_P1_POS, LB_FIELD_P2_POS,
+  LB_FIELD_NEXT_LED_POS, LB_FIELD_TUG_BOUNDARY, LB_FIELD_P1_RACE_POS, LB_FIELD_P2_RACE_POS,
+  LB_FIELD_CELEBRATING, LB_FIELD_WINNER,
+  LB_FIELD_SEQ = 0x40
+};
+
+typedef struct __attribute__((packed)) {
+  uint8_t field;        // LB_FIELD_*
+  int8_t  value;
+} MsgLightboardChange;
+
+// A point changes at most a few fields; anything bigger goes as a snapshot
+static const uint8_t ESPNOW_LB_DELTA_MAX = 4;
+typedef struct __attribute__((packed)) {
+  uint16_t version;     // version after applying; only valid on top of version - 1
+  uint8_t  count;       // entries used in change[]
+  MsgLightboardChange change[ESPNOW_LB_DELTA_MAX];
+} MsgLightboardDelta;
+
+// Version after v; wraps past 0, which means "no state"
+static inline uint16_t espNowLbNextVersion(uint16_t v) {
+  return (uint16_t)(v == 0xFFFF ? 1 : v + 1);
+}
+
+static inline uint8_t espNowLbSeqGet(const uint8_t *seq, int i) {
+  return (seq[i >> 2] >> ((i & 3) * 2)) & 0x03;
+}
+
+static inline void espNowLbSeqSet(uint8_t *seq, int i, uint8_t owner) {
+  uint8_t shift = (i & 3) * 2;
+  seq[i >> 2] = (uint8_t)((seq[i >> 2] & ~(0x03 << shift)) | ((owner & 0x03) << shift));
+}
+
+// The MsgLightboardState fields in LB_FIELD_* order, as signed bytes
+static inline int8_t *espNowLbField(MsgLightboardState &s, uint8_t field) {
+  switch (field) {
+    case LB_FIELD_MODE:         return (int8_t *)&s.gameMode;
+    case LB_FIELD_P1_COLOR:     return (int8_t *)&s.p1ColorIndex;
+    case LB_FIELD_P2_COLOR:     return (int8_t *)&s.p2ColorIndex;
+    case LB_FIELD_P1_POS:       return &s.p1Pos;
+    case LB_FIELD_P2_POS:       return &s.p2Pos;
+    case LB_FIELD_NEXT_LED_POS: return (int8_t *)&s.nextLedPos;
+    case LB_FIELD_TUG_BOUNDARY: return &s.tugBoundary;
+    case LB_FIELD_P1_RACE_POS:  return &s.p1RacePos;
+    case LB_FIELD_P2_RACE_POS:  return &s.p2RacePos;
+    case LB_FIELD_CELEBRATING:  return (int8_t *)&s.celebrating;
+    case LB_FIELD_WINNER:       return (int8_t *)&s.winner;
+    default:                    return nullptr;
+  }
+}
+
+// Changes turning `from` into `to`; false if they don't fit one delta
+static inline bool espNowLbDiff(const MsgLightboardSnapshot &from, const MsgLightboardSnapshot &to,
+                                MsgLightboardDelta &d) {
+  d.version = espNowLbNextVersion(from.version);
+  d.count = 0;
+  MsgLightboardState a = from.state, b = to.state;
+  for (uint8_t f = LB_FIELD_MODE; f <= LB_FIELD_WINNER; f++) {
+    int8_t va = *espNowLbField(a, f), vb = *espNowLbField(b, f);
+    if (va == vb) continue;
+    if (d.count == ESPNOW_LB_DELTA_MAX) return false;
+    d.change[d.count++] = {f, vb};
+  }
+  for (int i = 0; i < ESPNOW_LB_LEDS; i++) {
+    uint8_t oa = espNowLbSeqGet(from.sequence, i), ob = espNowLbSeqGet(to.sequence, i);
+    if (oa == ob) continue;
+    if (d.count == ESPNOW_LB_DELTA_MAX) return false;
+    d.change[d.count++] = {(uint8_t)(LB_FIELD_SEQ + i), (int8_t)ob};
+  }
+  return true;
+}
+
+// Apply a delta on top of its base version; false (s untouched) if s isn't
+// that version or a field is unknown
+static inline bool espNowLbApply(MsgLightboardSnapshot &s, const MsgLightboardDelta &d) {
+  if (s.version == 0 || d.version != espNowLbNextVersion(s.version) || d.count > ESPNOW_LB_DELTA_MAX) return false;
+  MsgLightboardSnapshot next = s;
+  for (uint8_t i = 0; i < d.count; i++) {
+    uint8_t f = d.change[i].field;
+    if (f >= LB_FIELD_SEQ && f < LB_FIELD_SEQ + ESPNOW_LB_LEDS) {
+      espNowLbSeqSet(next.sequence, f - LB_FIELD_SEQ, (uint8_t)d.change[i].value);
+    } else {
+      int8_t *v = espNowLbField(next.state, f);
+      if (!v) return false;
+      *v = d.change[i].value;
+    }
+  }
+  next.version = d.version;
+  s = next;
+  return true;
+}
+
+// Exact payload length per type (0xFF = unknown type)
+static const uint8_t ESPNOW_PAYLOAD_LEN[MSG_TYPE_COUNT] = {
+  0xFF,                                       // 0x00 unused
+  0,                                          // MSG_HEARTBEAT
+  sizeof(MsgHit),                             // MSG_HIT
+  0,                                          // MSG_RESET_REQUEST
+  sizeof(MsgClockSync),                       // MSG_CLOCK_SYNC
+  sizeof(MsgHitLocation),                     // MSG_HIT_LOCATION
+  0xFF, 0xFF, 0xFF, 0xFF,                     // 0x06-0x09 retired
+  sizeof(MsgLightboardSnapshot),              // MSG_LB_RESTORE
+  0,                                          // MSG_LB_STATE_REQ
+  sizeof(MsgLightboardAward),                 // MSG_LB_AWARD
+  sizeof(MsgAck),                             // MSG_ACK
+  sizeof(MsgRoundControl),                    // MSG_ROUND_CONTROL
+  0xFF,                                       // 0x0F retired
+  sizeof(MsgLightboardDelta),                 // MSG_LB_DELTA
+  sizeof(MsgTelemetryStage),                  // MSG_TELEMETRY_STAGE
+  sizeof(MsgTelemetryCounters)                // MSG_TELEMETRY_COUNTERS
+};
+
+static const uint32_t ESPNOW_RELIABLE_TYPES =
+  (1u << MSG_HIT) | (1u << MSG_RESET_REQUEST) | (1u << MSG_HIT_LOCATION) |
+  (1u << MSG_LB_RESTORE) | (1u << MSG_LB_STATE_REQ) | (1u << MSG_LB_AWARD) |
+  (1u << MSG_LB_DELTA);
+
+static inline bool espNowIsReliable(uint8_t type) {
+  return type < 32 && (ESPNOW_RELIABLE_TYPES & (1u << type));
+}
+
+static const uint8_t ESPNOW_MAX_PAYLOAD = sizeof(MsgClockSync);
+static_assert(sizeof(MsgLightboardSnapshot) <= ESPNOW_MAX_PAYLOAD, "snapshot exceeds ESPNOW_MAX_PAYLOAD");
+static_assert(sizeof(MsgTelemetryCounters) <= ESPNOW_MAX_PAYLOAD, "telemetry exceeds ESPNOW_MAX_PAYLOAD");
+static const uint8_t ESPNOW_MAX_PACKET = sizeof(EspNowHeader) + ESPNOW_MAX_PAYLOAD;
+
+// Header + payload for one outgoing packet; returns the length to send
+static inline uint8_t espNowBuild(uint8_t *out, uint8_t type, uint8_t sender, uint16_t boot, uint16_t seq,
+                                  const void *payload, uint8_t payloadLen) {
+  EspNowHeader h = {ESPNOW_MAGIC, ESPNOW_PROTO_VERSION, type, sender, seq, boot};
+  memcpy(out, &h, sizeof(h));
+  if (payloadLen) memcpy(out + sizeof(h), payload, payloadLen);
+  return (uint8_t)(sizeof(h) + payloadLen);
+}
+
+// Validate an incoming packet; on success hdr is filled and the payload
+// starts at data + sizeof(EspNowHeader)
+static inline bool espNowParse(const uint8_t *data, int len, EspNowHeader &hdr) {
+  if (len < (int)sizeof(EspNowHeader)) return false;
+  memcpy(&hdr, data, sizeof(hdr));
+  if (hdr.magic != ESPNOW_MAGIC || hdr.version != ESPNOW_PROTO_VERSION) return false;
+  if (hdr.type >= MSG_TYPE_COUNT || ESPNOW_PAYLOAD_LEN[hdr.type] == 0xFF) return false;
+  return len == (int)(sizeof(EspNowHeader) + ESPNOW_PAYLOAD_LEN[hdr.type]);
+}
+
+// ===================== Receive side =====================
+// Per-sender loss accounting and duplicate suppression. window bit i is set
+// when lastSeq - i has been received, so retransmits of anything in the last
+// 32 packets are recognised even after newer packets arrived. A sender that
+// reboots starts a new random sequence under a new boot id, so tracking starts
+// over instead of reading the jump as loss or the overlap as duplicates.
+static const uint16_t ESPNOW_SEQ_WINDOW = 32;
+
+struct EspNowSeqStats {
+  bool     seen;
+  uint16_t boot;        // sender's EspNowHeader.boot
+  uint16_t lastSeq;
+  uint32_t window;
+  uint32_t received;
+  uint32_t lost;        // gaps in the sequence not (yet) filled by a retransmit
+  uint32_t duplicates;  // retransmits of packets already delivered
+  uint32_t restarts;    // sender reboots seen (boot id changed)
+};
+
+// Returns false for a packet that was already delivered
+static inline bool espNowTrackSeq(EspNowSeqStats &s, uint16_t boot, uint16_t seq) {
+  if (!s.seen || boot != s.boot) {
+    if (s.seen) s.restarts++;
+    s.seen = true;
+    s.boot = boot;
+    s.lastSeq = seq;
+    s.window = 1;
+    s.received++;
+    return true;
+  }
+  uint16_t ahead = (uint16_t)(seq - s.lastSeq);
+  if (ahead == 0) { s.duplicates++; return false; }
+  if (ahead < 0x8000) {
+    s.window = (ahead < ESPNOW_SEQ_WINDOW) ? (s.window << ahead) | 1u : 1u;
+    s.lost += ahead - 1;
+    s.lastSeq = seq;
+    s.received++;
+    return true;
+  }
+  uint16_t behind = (uint16_t)(s.lastSeq - seq);
+  if (behind < ESPNOW_SEQ_WINDOW) {
+    uint32_t bit = 1u << behind;
+    if (s.window & bit) { s.duplicates++; return false; }
+    s.window |= bit;     // late retransmit fills a gap
+    if (s.lost) s.lost--;
+    s.received++;
+    return true;
+  }
+  // Older than the window from the same boot: whether it was delivered can't
+  // be told any more, so treat it as a retransmit
+  s.duplicates++;
+  return false;
+}
+
+// ===================== Send side =====================
+// Reliable packets stay queued until acked. The send callback reports whether
+// the frame left the radio: a failure is retried after a short doubling
+// backoff, a success waits ESPNOW_ACK_TIMEOUT_US for the MSG_ACK before
+// retrying. Time is passed in (µs) so this stays platform-free.
+static const int64_t ESPNOW_ACK_TIMEOUT_US = 4000;
+static const int64_t ESPNOW_RETRY_BASE_US  = 250;   // 250, 500, 1000 µs ...
+static const int64_t ESPNOW_RETRY_MAX_US   = 2000;
+static const uint8_t ESPNOW_MAX_TRIES      = 6;
+static const uint8_t ESPNOW_INFLIGHT_MAX   = 16;    // sends awaiting their callback
+
+// Returns false if the driver rejected the frame (no callback will follow)
+typedef bool (*EspNowRawSend)(const uint8_t *mac, const uint8_t *pkt, uint8_t len);
+
+struct EspNowTxStats {
+  uint32_t sent;        // reliable packets queued
+  uint32_t retries;     // retransmissions
+  uint32_t failed;      // given up after ESPNOW_MAX_TRIES
+  uint32_t overflow;    // queue full: sent once without retransmit
+  uint32_t resyncs;     // send callbacks lost, inflight FIFO cleared
+};
+
+template <int N>
+struct EspNowTxQueue {
+  struct Entry {
+    bool     used;
+    bool     awaitingCb;
+    uint8_t  tries;
+    uint8_t  len;
+    uint16_t seq;
+    uint8_t  mac[6];
+    int64_t  dueUs;
+    uint8_t  pkt[ESPNOW_MAX_PACKET];
+  };
+  struct Inflight {
+    int8_t   entry;     // -1 = unreliable send
+    uint16_t seq;
+  };
+
+  Entry    e[N];
+  Inflight inflight[ESPNOW_INFLIGHT_MAX];
+  uint8_t  inHead, inCount;
+  EspNowTxStats stats;
+
+  void send(EspNowRawSend raw, const uint8_t *mac, const uint8_t *pkt, uint8_t len,
+            bool reliable, uint16_t seq, int64_t now) {
+    int idx = -1;
+    if (reliable) {
+      for (int i = 0; i < N; i++) if (!e[i].used) { idx = i; break; }
+      if (idx < 0) stats.overflow++;
+      else {
+        Entry &x = e[idx];
+        x.used = true;
+        x.tries = 0;
+        x.len = len;
+        x.seq = seq;
+        memcpy(x.mac, mac, 6);
+        memcpy(x.pkt, pkt, len);
+        stats.sent++;
+      }
+    }
+    transmit(raw, idx, mac, pkt, len, seq, now);
+  }
+
+  // Send callback result, in send order
+  void sendStatus(bool ok, int64_t now) {
+    if (!inCount) return;
+    Inflight f = inflight[inHead];
+    inHead = (inHead + 1) % ESPNOW_INFLIGHT_MAX;
+    inCount--;
+    if (f.entry < 0) return;
+    Entry &x = e[f.entry];
+    if (!x.used || x.seq != f.seq || !x.awaitingCb) return; // already acked
+    x.awaitingCb = false;
+    x.dueUs = now + (ok ? ESPNOW_ACK_TIMEOUT_US : retryDelay(x.tries));
+  }
+
+  // Some callback results were lost, so the FIFO no longer lines up with the
+  // callbacks still to come. Forget it; the ACK timeout covers those sends.
+  void resyncInflight() {
+    inHead = 0;
+    inCount = 0;
+    stats.resyncs++;
+  }
+
+  void ack(const uint8_t *mac, uint16_t seq) {
+    for (int i = 0; i < N; i++) {
+      if (e[i].used && e[i].seq == seq && memcmp(e[i].mac, mac, 6) == 0) { e[i].used = false; return; }
+    }
+  }
+
+  // Retransmit whatever is due; returns the next due time, 0 if nothing is queued
+  int64_t poll(EspNowRawSend raw, int64_t now) {
+    int64_t next = 0;
+    for (int i = 0; i < N; i++) {
+      Entry &x = e[i];
+      if (!x.used) continue;
+      if (x.dueUs <= now) {
+        if (x.tries >= ESPNOW_MAX_TRIES) { x.used = false; stats.failed++; continue; }
+        stats.retries++;
+        transmit(raw, i, x.mac, x.pkt, x.len, x.seq, now);
+      }
+      if (!next || x.dueUs < next) next = x.dueUs;
+    }
+    return next;
+  }
+
+  int64_t nextDueUs() const {
+    int64_t next = 0;
+    for (int i = 0; i < N; i++) {
+      if (e[i].used && (!next || e[i].dueUs < next)) next = e[i].dueUs;
+    }
+    return next;
+  }
+
+private:
+  static int64_t retryDelay(uint8_t tries) {
+    int64_t d = ESPNOW_RETRY_BASE_US << (tries > 1 ? tries - 1 : 0);
+    return d < ESPNOW_RETRY_MAX_US ? d : ESPNOW_RETRY_MAX_US;
+  }
+
+  void transmit(EspNowRawSend raw, int idx, const uint8_t *mac, const uint8_t *pkt, uint8_t len,
+                uint16_t seq, int64_t now) {
+    bool queued = raw(mac, pkt, len);
+    if (queued) {
+      if (inCount == ESPNOW_INFLIGHT_MAX) resyncInflight(); // callbacks lost
+      inflight[(inHead + inCount) % ESPNOW_INFLIGHT_MAX] = {(int8_t)idx, seq};
+      inCount++;
+    }
+    if (idx < 0) return;
+    Entry &x = e[idx];
+    x.tries++;
+    x.awaitingCb = queued;
+    // No callback ever arrives for a rejected frame; the ACK timeout also
+    // covers a callback that goes missing
+    x.dueUs = now + (queued ? ESPNOW_ACK_TIMEOUT_US : retryDelay(x.tries));
+  }
+};
@@ -1,14 +1,129 @@
 #include <WiFi.h>
 #include <esp_now.h>
 #include <esp_wifi.h>
+#include <esp_timer.h>
+#include <freertos/semphr.h>
+#include <freertos/queue.h>
 #include <Adafruit_NeoPixel.h>
+#include "espnow_protocol.h"
+#include "lightboard_rules.h"
+#include "telemetry.h"
 
 // ---- LED strip config ----
 #define LED_PIN      13
 #define NUM_LEDS     38
 #define BRIGHTNESS   50
+#define FRAME_MS     16   // at most one strip push per frame tick
+// 1: drive the strip from the RMT peripheral, frames go out in the background
+// with interrupts enabled. 0: Adafruit_NeoPixel::show() (bit-banged, blocking)
+#define LED_OUTPUT_RMT 1
 Adafruit_NeoPixel strip(NUM_LEDS, LED_PIN, NEO_GRB + NEO_KHZ800);
 
+// ---- Framebuffer ----
+// Game logic, celebrations and demo mode draw here; loop() pushes it to the
+// strip once per frame tick, and only if a pixel changed. Only loop() touches
+// it: Bridge packets are queued by the receive callback and applied there. show() blocks with
+// interrupts off (~1.2 ms for 38 LEDs), which also costs ESP-NOW reception.
+uint32_t frame[NUM_LEDS] = {0};
+bool frameDirty = true;          // push the blank frame on the first tick
+uint32_t frameChanges = 0;       // pixel writes that changed a colour (trace points)
+unsigned long lastShowMs = 0;
+
+// Trace points (telemetry.h). TELEM_SHOW runs from the arrival of the Bridge
+// packet that changed the frame to the push that carries it out
+Telemetry telem = {};
+bool showRxPending = false;          // a received change is waiting for the next push
+uint32_t showRxUs = 0;
+bool showInFrame = false;            // the encoded RMT frame carries it
+uint32_t showFrameRxUs = 0;
+unsigned long lastTelemMs = 0;
+
+// A frame is being pushed: it carries any received change still pending
+inline void showTakePending(uint32_t *rxUs) {
+  if (!showRxPending) return;
+  *rxUs = showRxUs;
+  showRxPending = false;
+  showInFrame = true;
+}
+
+inline void fbSet(int i, uint32_t c) {
+  if (frame[i] != c) { frame[i] = c; frameDirty = true; frameChanges++; }
+}
+inline void fbClear() { for (int i=0;i<NUM_LEDS;i++) fbSet(i, 0); }
+
+#if LED_OUTPUT_RMT
+// ---- RMT output ----
+// 10 MHz RMT clock: one symbol per bit, 1.2 us each (WS2812 timing), then a
+// low reset symbol so back-to-back frames latch. Two symbol buffers: the RMT
+// driver reads one while the next frame is encoded into the other.
+#define RMT_TICK_HZ   10000000
+#define LED_SYMBOLS   (NUM_LEDS * 24 + 1)
+static const rmt_data_t WS_BIT0 = {{4, 1, 8, 0}}; // 0.4 us high, 0.8 us low
+static const rmt_data_t WS_BIT1 = {{8, 1, 4, 0}}; // 0.8 us high, 0.4 us low
+static const rmt_data_t WS_RESET = {{1500, 0, 1500, 0}}; // 300 us low
+rmt_data_t ledSymbols[2][LED_SYMBOLS];
+uint8_t ledBack = 0;     // buffer the next frame is encoded into
+bool ledPending = false; // ledSymbols[ledBack] holds a frame the RMT hasn't taken yet
+bool ledReady = false;
+
+bool ledOutputBegin() {
+  ledReady = rmtInit(LED_PIN, RMT_TX_MODE, RMT_MEM_NUM_BLOCKS_1, RMT_TICK_HZ);
+  if (!ledReady) Serial.println("RMT init failed - LED output disabled");
+  return ledReady;
+}
+
+// Frame colours are 0x00RRGGBB; the strip wants GRB, MSB first, with the same
+// brightness scaling Adafruit_NeoPixel applies in setPixelColor()
+void ledEncode(rmt_data_t *out) {
+  const uint16_t scale = BRIGHTNESS + 1;
+  for (int i=0;i<NUM_LEDS;i++) {
+    uint32_t c = frame[i];
+    uint8_t r = ((c >> 16 & 0xFF) * scale) >> 8;
+    uint8_t g = ((c >> 8 & 0xFF) * scale) >> 8;
+    uint8_t b = ((c & 0xFF) * scale) >> 8;
+    uint32_t grb = (uint32_t)g << 16 | (uint32_t)r << 8 | b;
+    for (int bit=23; bit>=0; bit--) *out++ = (grb >> bit & 1) ? WS_BIT1 : WS_BIT0;
+  }
+  *out = WS_RESET;
+}
+
+// Hand the encoded frame to the RMT once the previous one has gone out
+void ledOutputPoll() {
+  if (!ledPending || !rmtTransmitCompleted(LED_PIN)) return;
+  if (rmtWriteAsync(LED_PIN, ledSymbols[ledBack], LED_SYMBOLS)) {
+    ledBack ^= 1;
+    if (showInFrame) telem.span(TELEM_SHOW, showFrameRxUs, (uint32_t)esp_timer_get_time());
+  }
+  showInFrame = false;
+  ledPending = false;
+}
+#endif
+
+void fbFlush(unsigned long nowMs) {
+#if LED_OUTPUT_RMT
+  ledOutputPoll();
+  if (!ledReady) return;
+#endif
+  if (!frameDirty || nowMs - lastShowMs < FRAME_MS) return;
+  lastShowMs = nowMs;
+  frameDirty = false;
+#if LED_OUTPUT_RMT
+  // The back buffer is never the one in flight, so a frame still waiting for
+  // the line is simply replaced by the newer one
+  showTakePending(&showFrameRxUs);
+  ledEncode(ledSymbols[ledBack]);
+  ledPending = true;
+  ledOutputPoll();
+#else
+  uint32_t rxUs;
+  showTakePending(&rxUs);
+  for (int i=0;i<NUM_LEDS;i++) strip.setPixelColor(i, frame[i]);
+  strip.show();
+  if (showInFrame) telem.span(TELEM_SHOW, rxUs, (uint32_t)esp_timer_get_time());
+  showInFrame = false;
+#endif
+}
+
 // ---- Center indices ----
 const int CENTER_LEFT  = (NUM_LEDS / 2) - 1; // 18
 const int CENTER_RIGHT = (NUM_LEDS / 2);     // 19
@@ -25,24 +140,17 @@ static void forceStaChannel(uint8_t ch){
 // Bridge MAC address (hardcoded for reliability)
 uint8_t bridgeAddress[] = {0x80, 0xF3, 0xDA, 0x4A, 0x2F, 0x98}; // Bridge AP MAC
 
-typedef struct struct_lightboard_message {
-  uint8_t  deviceId;     // 3=Lightboard
-  uint8_t  action;       // 1=heartbeat, 2=game-state, 3=score-update, 4=mode-change, 5=reset, 6=state-restore, 7=state-request
-  uint8_t  gameMode;     // 1-6 (Territory, Swap Sides, Split Scoring, Score Order, Race, Tug O War)
-  uint8_t  p1ColorIndex; // Player 1 color index
-  uint8_t  p2ColorIndex; // Player 2 color index
-  int8_t   p1Pos;        // Player 1 position (-1 to NUM_LEDS)
-  int8_t   p2Pos;        // Player 2 position (-1 to NUM_LEDS)
-  uint8_t  nextLedPos;   // For Score Order mode
-  uint8_t  tugBoundary;  // For Tug O War mode
-  uint8_t  p1RacePos;    // For Race mode
-  uint8_t  p2RacePos;    // For Race mode
-  uint8_t  celebrating;  // Celebration state
-  uint8_t  winner;       // 0=none, 1=Player1, 2=Player2
-} struct_lightboard_message;
-
-struct_lightboard_message myData;
-struct_lightboard_message bridgeData;
+// Packet format, types and payloads: espnow_protocol.h
+// loop() and the receive callback both send, so the sequence counter and
+// retransmit queue are guarded by txLock
+SemaphoreHandle_t txLock = nullptr;
+uint16_t txSeq = 0;              // EspNowHeader.seq, random start per boot
+uint16_t bootId = 0;             // EspNowHeader.boot, random per boot
+EspNowTxQueue<4> txQueue = {};   // state requests awaiting an ACK
+esp_timer_handle_t retryTimer = nullptr;
+EspNowSeqStats bridgeSeq = {};   // loss accounting + duplicate suppression for the Bridge
+EspNowSeqStats bridgeBcastSeq = {}; // same for the Bridge's broadcasts (own counter)
+volatile unsigned long lastTxMs = 0; // any packet to the Bridge doubles as a heartbeat
 
 // Connection tracking
 bool bridgeConnected = false;
@@ -51,24 +159,31 @@ const unsigned long heartbeatTimeout = 2000; // 2 seconds
 bool bridgeMacLearned = false;
 static bool wasConnected = false; // Track if we've been connected before
 
-// ---- Game state ----
-int p1Pos = -1;
-int p2Pos = NUM_LEDS;
-bool celebrating = false;
-
-// Mode 4: Score Order tracking
-int nextLedPosition = 0;
-int scoringSequence[NUM_LEDS];
-
-// Mode 5: Race tracking
-int p1RacePos = -1;
-int p2RacePos = -1;
-
-// Mode 6: Tug O War tracking
-int tugBoundary = CENTER_LEFT;
-
-// Game modes
-int gameMode = 1;
+// ---- Board ----
+// The Bridge owns the game (lightboard_rules.h) and replicates the board here;
+// the lightboard only renders it. version 0 = nothing received yet.
+static_assert(NUM_LEDS == LB_NUM_LEDS, "lightboard_rules.h plays a different strip length");
+MsgLightboardSnapshot board = {};
+
+// Multi-point award still being animated (set by an MSG_LB_AWARD, stepped by loop())
+uint8_t awardPlayer = 0;
+uint8_t awardRemaining = 0;
+uint16_t awardStepMs = 0;
+unsigned long awardLastStepMs = 0;
+
+// Bridge packets, copied out of the receive callback. loop() owns the board,
+// the award and the framebuffer, so it is the only place they are applied.
+static const UBaseType_t RX_QUEUE_LEN = 16;
+struct LbRxPacket {
+  uint8_t  len;
+  bool     broadcast;
+  uint8_t  srcMac[6];
+  uint32_t rxUs;                    // esp_timer_get_time() on arrival (trace points)
+  uint8_t  data[ESPNOW_MAX_PACKET];
+};
+QueueHandle_t rxQueue = nullptr;
+volatile uint32_t rxQueueDrops = 0; // packets lost because the queue was full
+volatile uint32_t rxRejected = 0;   // packets that failed espNowParse or weren't from the Bridge
 
 // Player colors (RGB values)
 struct PlayerColor {
@@ -98,16 +213,68 @@ uint32_t getP2ColorValue();
 void requestStateRestore();
 
 // ==================== Celebration Manager ====================
-enum CelebrationType : uint8_t {
-  CEL_WINNER_CHASE = 0,
-  CEL_CENTER_RIPPLE,
-  CEL_CONFETTI,
-  CEL_BREATHE
+// Table-driven: each pattern is a start() that precomputes its colours and
+// rates once, and a frame() that draws from them with integer maths only.
+// Add an effect by adding a row to CELEBRATIONS. const tables stay in flash
+// (rodata) on the ESP32.
+
+// 128 + 127.5*sin(2*pi*i/256): one full wave per 256 phase steps
+static const uint8_t SINE8[256] = {
+  128,131,134,137,140,143,146,149,152,155,158,162,165,167,170,173,
+  176,179,182,185,188,190,193,196,198,201,203,206,208,211,213,215,
+  218,220,222,224,226,228,230,232,234,235,237,238,240,241,243,244,
+  245,246,248,249,250,250,251,252,253,253,254,254,254,255,255,255,
+  255,255,255,255,254,254,254,253,253,252,251,250,250,249,248,246,
+  245,244,243,241,240,238,237,235,234,232,230,228,226,224,222,220,
+  218,215,213,211,208,206,203,201,198,196,193,190,188,185,182,179,
+  176,173,170,167,165,162,158,155,152,149,146,143,140,137,134,131,
+  128,124,121,118,115,112,109,106,103,100, 97, 93, 90, 88, 85, 82,
+   79, 76, 73, 70, 67, 65, 62, 59, 57, 54, 52, 49, 47, 44, 42, 40,
+   37, 35, 33, 31, 29, 27, 25, 23, 21, 20, 18, 17, 15, 14, 12, 11,
+   10,  9,  7,  6,  5,  5,  4,  3,  2,  2,  1,  1,  1,  0,  0,  0,
+    0,  0,  0,  0,  1,  1,  1,  2,  2,  3,  4,  5,  5,  6,  7,  9,
+   10, 11, 12, 14, 15, 17, 18, 20, 21, 23, 25, 27, 29, 31, 33, 35,
+   37, 40, 42, 44, 47, 49, 52, 54, 57, 59, 62, 65, 67, 70, 73, 76,
+   79, 82, 85, 88, 90, 93, 97,100,103,106,109,112,115,118,121,124
+};
+
+// Perceptual brightness (gamma 2.2), so waves look even on the strip
+static const uint8_t GAMMA8[256] = {
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,
+    1,  1,  1,  1,  1,  1,  1,  1,  1,  2,  2,  2,  2,  2,  2,  2,
+    3,  3,  3,  3,  3,  4,  4,  4,  4,  5,  5,  5,  5,  6,  6,  6,
+    6,  7,  7,  7,  8,  8,  8,  9,  9,  9, 10, 10, 11, 11, 11, 12,
+   12, 13, 13, 13, 14, 14, 15, 15, 16, 16, 17, 17, 18, 18, 19, 19,
+   20, 20, 21, 22, 22, 23, 23, 24, 25, 25, 26, 26, 27, 28, 28, 29,
+   30, 30, 31, 32, 33, 33, 34, 35, 35, 36, 37, 38, 39, 39, 40, 41,
+   42, 43, 43, 44, 45, 46, 47, 48, 49, 49, 50, 51, 52, 53, 54, 55,
+   56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+   73, 74, 75, 76, 77, 78, 79, 81, 82, 83, 84, 85, 87, 88, 89, 90,
+   91, 93, 94, 95, 97, 98, 99,100,102,103,105,106,107,109,110,111,
+  113,114,116,117,119,120,121,123,124,126,127,129,130,132,133,135,
+  137,138,140,141,143,145,146,148,149,151,153,154,156,158,159,161,
+  163,165,166,168,170,172,173,175,177,179,181,182,184,186,188,190,
+  192,194,196,197,199,201,203,205,207,209,211,213,215,217,219,221,
+  223,225,227,229,231,234,236,238,240,242,244,246,248,251,253,255
+};
+
+// 8.8 fixed point: 256 = 1.0
+static const uint16_t CHASE_TAIL_Q8[6] = {256, 192, 144, 108, 81, 61}; // 0.75^k
+static const uint16_t CONFETTI_DECAY_Q8 = 218;  // ~0.85 per frame
+#define CEL_FRAME_MS 16
+
+static inline uint8_t scale8(uint8_t v, uint16_t q8) { return (uint8_t)((v * q8) >> 8); }
+static inline uint8_t lerp8(uint8_t a, uint8_t b, uint8_t t) { return a + (((int)b - a) * t >> 8); }
+
+struct CelebrationPattern {
+  uint16_t durationMs;
+  void (*start)();
+  void (*frame)(uint32_t elapsedMs);
 };
 
 bool celActive = false;
 bool celP1Wins = false;
-CelebrationType celType = CEL_WINNER_CHASE;
+uint8_t celType = 0;  // index into CELEBRATIONS
 
 uint32_t celStartMs = 0;
 uint32_t celLastFrame = 0;
@@ -115,39 +282,104 @@ uint16_t celDurationMs = 3000;
 
 uint8_t winnerR=0, winnerG=0, winnerB=0;
 
-// Clamp
-static inline float clampv(float v, float lo, float hi) {
-  if (v < lo) return lo;
-  if (v > hi) return hi;
-  return v;
+// Per-pattern parameters, filled by the pattern's start()
+uint32_t celChaseTail[6];          // winner colour down the tail (head flashes white)
+uint8_t  celRippleR, celRippleG, celRippleB; // winner blended 30% toward white
+uint8_t  celRipplePhase[NUM_LEDS]; // per-LED wave offset from the centre
+uint32_t celPhaseRateQ8;           // wave phase steps per ms, 8.8 fixed point
+uint8_t  confR[NUM_LEDS], confG[NUM_LEDS], confB[NUM_LEDS];
+
+void chaseStart() {
+  for (int k=0;k<6;k++) {
+    celChaseTail[k] = strip.Color(scale8(winnerR, CHASE_TAIL_Q8[k]),
+                                  scale8(winnerG, CHASE_TAIL_Q8[k]),
+                                  scale8(winnerB, CHASE_TAIL_Q8[k]));
+  }
+}
+
+void chaseFrame(uint32_t elapsedMs) {
+  int head = (int)((elapsedMs / 20) % NUM_LEDS);
+  bool flash = (elapsedMs / 200) % 2 == 0;
+  for (int k=0;k<6;k++) {
+    int idx = head - k;
+    if (idx < 0) idx += NUM_LEDS;
+    fbSet(idx, (k == 0 && flash) ? strip.Color(255,255,255) : celChaseTail[k]);
+  }
+}
+
+// Wave: 0.55 rad per LED from the centre, 10 rad over the whole celebration
+void rippleStart() {
+  celRippleR = lerp8(winnerR, 255, 77);
+  celRippleG = lerp8(winnerG, 255, 77);
+  celRippleB = lerp8(winnerB, 255, 77);
+  for (int i=0;i<NUM_LEDS;i++) {
+    int d = min(abs(i - CENTER_LEFT), abs(i - CENTER_RIGHT));
+    celRipplePhase[i] = (uint8_t)(d * 0.55f * 256.0f / 6.2832f);
+  }
+  celPhaseRateQ8 = (uint32_t)(10.0f * 256.0f / 6.2832f * 256.0f / celDurationMs);
+}
+
+void rippleFrame(uint32_t elapsedMs) {
+  uint8_t t = (uint8_t)((elapsedMs * celPhaseRateQ8) >> 8);
+  for (int i=0;i<NUM_LEDS;i++) {
+    uint8_t s = GAMMA8[SINE8[(uint8_t)(celRipplePhase[i] - t)]];
+    fbSet(i, strip.Color(scale8(celRippleR, s + 1), scale8(celRippleG, s + 1), scale8(celRippleB, s + 1)));
+  }
+}
+
+void confettiStart() {
+  memset(confR, 0, sizeof(confR));
+  memset(confG, 0, sizeof(confG));
+  memset(confB, 0, sizeof(confB));
+}
+
+void confettiFrame(uint32_t elapsedMs) {
+  for (int i=0;i<NUM_LEDS;i++) {
+    confR[i] = scale8(confR[i], CONFETTI_DECAY_Q8);
+    confG[i] = scale8(confG[i], CONFETTI_DECAY_Q8);
+    confB[i] = scale8(confB[i], CONFETTI_DECAY_Q8);
+  }
+  uint8_t sparks = 2 + (elapsedMs % 3);
+  for (uint8_t s=0; s<sparks; s++) {
+    int i = random(0, NUM_LEDS);
+    bool whiteSpark = (random(0,100) < 30);
+    confR[i] = max(confR[i], whiteSpark ? (uint8_t)255 : winnerR);
+    confG[i] = max(confG[i], whiteSpark ? (uint8_t)255 : winnerG);
+    confB[i] = max(confB[i], whiteSpark ? (uint8_t)255 : winnerB);
+  }
+  for (int i=0;i<NUM_LEDS;i++) fbSet(i, strip.Color(confR[i], confG[i], confB[i]));
+}
+
+// Two breaths over the celebration, winner colour <-> white
+void breatheStart() {
+  celPhaseRateQ8 = (uint32_t)(2 * 256 * 256) / celDurationMs;
 }
 
-static inline uint32_t scaleColor(uint8_t r,uint8_t g,uint8_t b,float s){
-  s = clampv(s, 0.0f, 1.0f);
-  return strip.Color((uint8_t)(r*s),(uint8_t)(g*s),(uint8_t)(b*s));
+void breatheFrame(uint32_t elapsedMs) {
+  uint8_t s = SINE8[(uint8_t)((elapsedMs * celPhaseRateQ8) >> 8)];
+  uint32_t c = strip.Color(lerp8(winnerR, 255, s), lerp8(winnerG, 255, s), lerp8(winnerB, 255, s));
+  for (int i=0;i<NUM_LEDS;i++) fbSet(i, c);
 }
 
+const CelebrationPattern CELEBRATIONS[] = {
+  {2500, chaseStart,    chaseFrame},    // winner chase
+  {2500, rippleStart,   rippleFrame},   // centre ripple
+  {2000, confettiStart, confettiFrame}, // confetti
+  {3000, breatheStart,  breatheFrame},  // breathe
+};
+const uint8_t NUM_CELEBRATIONS = sizeof(CELEBRATIONS) / sizeof(CELEBRATIONS[0]);
+
 void startCelebration(bool player1Wins) {
   celActive = true;
   celP1Wins = player1Wins;
-  if (celP1Wins) { 
-    PlayerColor c = getP1Color();
-    winnerR=c.r; winnerG=c.g; winnerB=c.b; 
-  }
-  else { 
-    PlayerColor c = getP2Color();
-    winnerR=c.r; winnerG=c.g; winnerB=c.b; 
-  }
+  PlayerColor c = celP1Wins ? getP1Color() : getP2Color();
+  winnerR=c.r; winnerG=c.g; winnerB=c.b;
 
   static uint8_t nextPattern = 0;
-  celType = (CelebrationType)(nextPattern++ % 4);
+  celType = nextPattern++ % NUM_CELEBRATIONS;
+  celDurationMs = CELEBRATIONS[celType].durationMs;
+  CELEBRATIONS[celType].start();
 
-  switch (celType) {
-    case CEL_WINNER_CHASE:  celDurationMs = 2500; break;
-    case CEL_CENTER_RIPPLE: celDurationMs = 2500; break;
-    case CEL_CONFETTI:      celDurationMs = 2000; break;
-    case CEL_BREATHE:       celDurationMs = 3000; break;
-  }
   celStartMs   = millis();
   celLastFrame = 0;
 }
@@ -155,76 +387,14 @@ void startCelebration(bool player1Wins) {
 bool updateCelebration() {
   if (!celActive) return false;
   uint32_t now = millis();
-  if (now - celLastFrame < 16) return true;
+  if (now - celLastFrame < CEL_FRAME_MS) return true;
   celLastFrame = now;
 
-  float t = (float)(now - celStartMs) / (float)celDurationMs;
-  if (t >= 1.0f) { celActive = false; return false; }
-
-  for (int i=0;i<NUM_LEDS;i++) strip.setPixelColor(i, 0);
+  uint32_t elapsed = now - celStartMs;
+  if (elapsed >= celDurationMs) { celActive = false; return false; }
 
-  switch (celType) {
-    case CEL_WINNER_CHASE: {
-      int head = (int)((now / 20) % NUM_LEDS);
-      for (int k=0; k<6; k++) {
-        int idx = head - k;
-        if (idx < 0) idx += NUM_LEDS;
-        float s = powf(0.75f, k);
-
-        if (k == 0 && (celLastFrame/200)%2==0) {
-          strip.setPixelColor(idx, strip.Color(255,255,255));
-        } else {
-          strip.setPixelColor(idx, scaleColor(winnerR, winnerG, winnerB, s));
-        }
-      }
-    } break;
-
-    case CEL_CENTER_RIPPLE: {
-      for (int i=0;i<NUM_LEDS;i++) {
-        int d = min(abs(i - CENTER_LEFT), abs(i - CENTER_RIGHT));
-        float phase = (d * 0.55f) - (t * 10.0f);
-        float s = 0.5f + 0.5f * sinf(phase);
-
-        uint8_t r = (winnerR * 0.7) + (255 * 0.3);
-        uint8_t g = (winnerG * 0.7) + (255 * 0.3);
-        uint8_t b = (winnerB * 0.7) + (255 * 0.3);
-        strip.setPixelColor(i, scaleColor(r,g,b,s));
-      }
-    } break;
-
-    case CEL_CONFETTI: {
-      static uint8_t confR[NUM_LEDS]={0}, confG[NUM_LEDS]={0}, confB[NUM_LEDS]={0};
-      for (int i=0;i<NUM_LEDS;i++) {
-        confR[i] = (uint8_t)(confR[i] * 0.85f);
-        confG[i] = (uint8_t)(confG[i] * 0.85f);
-        confB[i] = (uint8_t)(confB[i] * 0.85f);
-        strip.setPixelColor(i, strip.Color(confR[i], confG[i], confB[i]));
-      }
-      uint8_t sparks = 2 + (now % 3);
-      for (uint8_t s=0; s<sparks; s++) {
-        int i = random(0, NUM_LEDS);
-        bool whiteSpark = (random(0,100) < 30);
-        uint8_t r = whiteSpark ? 255 : winnerR;
-        uint8_t g = whiteSpark ? 255 : winnerG;
-        uint8_t b = whiteSpark ? 255 : winnerB;
-        confR[i] = max(confR[i], r);
-        confG[i] = max(confG[i], g);
-        confB[i] = max(confB[i], b);
-      }
-    } break;
-
-    case CEL_BREATHE: {
-      float s = 0.5f + 0.5f * sinf(t * 2.0f * 3.14159f * 2.0f);
-      for (int i=0;i<NUM_LEDS;i++) {
-        uint8_t r = (uint8_t)(winnerR * (1.0f-s) + 255 * s);
-        uint8_t g = (uint8_t)(winnerG * (1.0f-s) + 255 * s);
-        uint8_t b = (uint8_t)(winnerB * (1.0f-s) + 255 * s);
-        strip.setPixelColor(i, strip.Color(r,g,b));
-      }
-    } break;
-  }
-
-  strip.show();
+  fbClear();
+  CELEBRATIONS[celType].frame(elapsed);
   return true;
 }
 
@@ -235,153 +405,314 @@ inline uint32_t col(uint8_t r, uint8_t g, uint8_t b){ return strip.Color(r,g,b);
 PlayerColor getP1Color() { return availableColors[p1ColorIndex]; }
 PlayerColor getP2Color() { return availableColors[p2ColorIndex]; }
 
-// Get color as uint32_t for strip.setPixelColor
-uint32_t getP1ColorValue() { 
-  PlayerColor c = getP1Color(); 
-  return col(c.r, c.g, c.b); 
+// Packed player colours for fbSet, rebuilt only when a colour index changes
+uint32_t p1ColorValue = 0, p2ColorValue = 0, mixColorValue = 0;
+int cachedP1Index = -1, cachedP2Index = -1;
+
+// Apply colour indices from the Bridge; out-of-range indices keep the
+// current colour. Returns true if a colour changed (the board needs a repaint).
+bool setPlayerColors(int p1Index, int p2Index) {
+  if (p1Index >= 0 && p1Index < NUM_COLORS) p1ColorIndex = p1Index;
+  if (p2Index >= 0 && p2Index < NUM_COLORS) p2ColorIndex = p2Index;
+  if (p1ColorIndex == cachedP1Index && p2ColorIndex == cachedP2Index) return false;
+  cachedP1Index = p1ColorIndex;
+  cachedP2Index = p2ColorIndex;
+  PlayerColor c1 = getP1Color(), c2 = getP2Color();
+  p1ColorValue = col(c1.r, c1.g, c1.b);
+  p2ColorValue = col(c2.r, c2.g, c2.b);
+  mixColorValue = col((c1.r+c2.r)/2, (c1.g+c2.g)/2, (c1.b+c2.b)/2); // Race: both on one LED
+  return true;
 }
-uint32_t getP2ColorValue() { 
-  PlayerColor c = getP2Color(); 
-  return col(c.r, c.g, c.b); 
+
+uint32_t getP1ColorValue() { return p1ColorValue; }
+uint32_t getP2ColorValue() { return p2ColorValue; }
+
+void clearStrip(){ fbClear(); }
+
+bool espNowRawSend(const uint8_t *mac, const uint8_t *pkt, uint8_t len) {
+  return esp_now_send(mac, pkt, len) == ESP_OK;
 }
 
-void clearStrip(){ for (int i=0;i<NUM_LEDS;i++) strip.setPixelColor(i,0); strip.show(); }
+// Call with txLock held
+void armRetryTimer() {
+  int64_t due = txQueue.nextDueUs();
+  esp_timer_stop(retryTimer); // ignore result (not running)
+  if (!due) return;
+  int64_t wait = due - esp_timer_get_time();
+  esp_timer_start_once(retryTimer, wait > 50 ? (uint64_t)wait : 50);
+}
+
+void onRetryTimer(void *arg) {
+  xSemaphoreTake(txLock, portMAX_DELAY);
+  txQueue.poll(espNowRawSend, esp_timer_get_time());
+  armRetryTimer();
+  xSemaphoreGive(txLock);
+}
+
+// Header + payload to the Bridge; reliable types are retransmitted until acked
+void sendToBridge(uint8_t type, const void *payload, uint8_t len) {
+  uint8_t pkt[ESPNOW_MAX_PACKET];
+  xSemaphoreTake(txLock, portMAX_DELAY);
+  uint16_t seq = txSeq++;
+  uint8_t n = espNowBuild(pkt, type, ESPNOW_ID_LIGHTBOARD, bootId, seq, payload, len);
+  lastTxMs = millis();
+  bool reliable = espNowIsReliable(type);
+  txQueue.send(espNowRawSend, bridgeAddress, pkt, n, reliable, seq, esp_timer_get_time());
+  if (reliable) armRetryTimer();
+  xSemaphoreGive(txLock);
+}
 
 void requestStateRestore() {
-  // Send state request message to Bridge (action 7 = state request)
+  // Send state request message to Bridge
   if (!bridgeMacLearned) return; // Can't send if we don't know the MAC yet
   
-  myData.deviceId = 3; // Lightboard
-  myData.action = 7; // state request
-  esp_now_send(bridgeAddress, (uint8_t*)&myData, sizeof(myData));
+  sendToBridge(MSG_LB_STATE_REQ, nullptr, 0);
   Serial.println("Sent state request to Bridge");
 }
 
+// ---- Progress rendering ----
+// Each mode's pixel function lives with its rules (lightboard_rules.h)
+LbPalette progressPalette() { return {p1ColorValue, p2ColorValue, mixColorValue}; }
+
+// Full repaint: mode change, restore, reset, colour change
 void paintProgress() {
-  for (int i=0;i<NUM_LEDS;i++) strip.setPixelColor(i,0);
-  if (gameMode==2) { if(p1Pos>=0&&p1Pos<NUM_LEDS) strip.setPixelColor(p1Pos,getP1ColorValue()); if(p2Pos>=0&&p2Pos<NUM_LEDS) strip.setPixelColor(p2Pos,getP2ColorValue()); }
-  else if (gameMode==3) { if(p1Pos<=CENTER_LEFT) for(int i=CENTER_LEFT;i>=p1Pos&&i>=0;i--) strip.setPixelColor(i,getP1ColorValue()); if(p2Pos>=CENTER_RIGHT) for(int i=CENTER_RIGHT;i<=p2Pos&&i<NUM_LEDS;i++) strip.setPixelColor(i,getP2ColorValue()); }
-  else if (gameMode==4) { for(int i=0;i<nextLedPosition;i++){ if(scoringSequence[i]==1) strip.setPixelColor(i,getP1ColorValue()); else if(scoringSequence[i]==2) strip.setPixelColor(i,getP2ColorValue()); }}
-  else if (gameMode==5) { bool p1On=(p1RacePos>=0),p2On=(p2RacePos>=0); if(p1On&&p2On&&p1RacePos==p2RacePos) { PlayerColor c1=getP1Color(),c2=getP2Color(); strip.setPixelColor(p1RacePos,col((c1.r+c2.r)/2,(c1.g+c2.g)/2,(c1.b+c2.b)/2)); } else { if(p1On) strip.setPixelColor(p1RacePos,getP1ColorValue()); if(p2On) strip.setPixelColor(p2RacePos,getP2ColorValue()); }}
-  else if (gameMode==6) { for(int i=0;i<=tugBoundary&&i<NUM_LEDS;i++) strip.setPixelColor(i,getP1ColorValue()); for(int i=tugBoundary+1;i<NUM_LEDS;i++) strip.setPixelColor(i,getP2ColorValue()); }
-  else { for(int i=0;i<=p1Pos&&i<NUM_LEDS;i++) strip.setPixelColor(i,getP1ColorValue()); for(int i=NUM_LEDS-1;i>=p2Pos&&i>=0;i--) strip.setPixelColor(i,getP2ColorValue()); }
-  strip.show();
+  const LbRules &r = lbRulesFor(board.state.gameMode);
+  const LbPalette pal = progressPalette();
+  for (int i=0;i<NUM_LEDS;i++) fbSet(i, r.pixel(board, pal, i));
+}
+
+// Incremental repaint of up to two pixels a point update changed
+void repaintLeds(int a, int b) {
+  const LbRules &r = lbRulesFor(board.state.gameMode);
+  const LbPalette pal = progressPalette();
+  if (a >= 0 && a < NUM_LEDS) fbSet(a, r.pixel(board, pal, a));
+  if (b >= 0 && b < NUM_LEDS && b != a) fbSet(b, r.pixel(board, pal, b));
+}
+
+// Render the board after a restore or delta; a new win starts the
+// celebration, a reset during one ends it
+void boardChanged(bool wasCelebrating) {
+  setPlayerColors(board.state.p1ColorIndex, board.state.p2ColorIndex);
+  if (board.state.celebrating && !wasCelebrating) {
+    Serial.printf("Lightboard: Player %d wins! Starting celebration...\n", board.state.winner);
+    startCelebration(board.state.winner == 1);
+  } else if (!board.state.celebrating) {
+    celActive = false;
+  }
+  if (!celActive) paintProgress();
 }
 
-void resetGame(){ 
-  switch(gameMode){
-    case 1:case 2:p1Pos=-1;p2Pos=NUM_LEDS;break;
-    case 3:p1Pos=CENTER_LEFT+1;p2Pos=CENTER_RIGHT-1;break;
-    case 4:nextLedPosition=0;for(int i=0;i<NUM_LEDS;i++)scoringSequence[i]=0;break;
-    case 5:p1RacePos=-1;p2RacePos=-1;break;
-    case 6:tugBoundary=CENTER_LEFT;break;
-  } 
-  if(gameMode==6) paintProgress(); else clearStrip(); 
+// One step of an award on our copy of the board; the Bridge already holds
+// the result, so this only animates towards it
+void stepAward() {
+  awardRemaining--;
+  LbTouched t;
+  if (lbPoint(board, awardPlayer, &t)) {
+    awardRemaining = 0;
+    Serial.printf("Lightboard: Player %d wins! Starting celebration...\n", board.state.winner);
+    startCelebration(board.state.winner == 1);
+  } else if (!celActive) {
+    repaintLeds(t.a, t.b);
+  }
+}
+
+// Any newer state from the Bridge builds on the award's end result
+void finishAward() {
+  while (awardRemaining > 0) stepAward();
 }
 
 // ===================== ESP-NOW Callbacks =====================
 void OnDataSent(const wifi_tx_info_t *info, esp_now_send_status_t status) {
-  Serial.print("Lightboard Send Status: ");
-  Serial.println(status == ESP_NOW_SEND_SUCCESS ? "Success" : "Fail");
+  xSemaphoreTake(txLock, portMAX_DELAY);
+  if (status != ESP_NOW_SEND_SUCCESS) telem.sendFailed++;
+  txQueue.sendStatus(status == ESP_NOW_SEND_SUCCESS, esp_timer_get_time());
+  armRetryTimer();
+  xSemaphoreGive(txLock);
+  // Debug: Serial.println(status == ESP_NOW_SEND_SUCCESS ? "Lightboard Send Status: Success" : "Lightboard Send Status: Fail");
+}
+
+void onHeartbeat(const uint8_t *payload) {
+  // Heartbeat - just update connection status
+  Serial.println("Bridge heartbeat received");
+}
+
+void onRestore(const uint8_t *payload) {
+  // Full board from the Bridge, Score Order sequence included; replaces
+  // whatever we had, an award in progress too
+  MsgLightboardSnapshot m;
+  memcpy(&m, payload, sizeof(m));
+  if (m.version == 0) return; // the Bridge has no board yet either
+  awardRemaining = 0;
+  bool wasCelebrating = board.state.celebrating;
+  board = m;
+  board.state.nextLedPos = min((int)board.state.nextLedPos, NUM_LEDS);
+  Serial.printf("State restored: version=%u, mode=%d, p1Pos=%d, p2Pos=%d, p1Color=%d, p2Color=%d\n",
+               m.version, board.state.gameMode, board.state.p1Pos, board.state.p2Pos,
+               board.state.p1ColorIndex, board.state.p2ColorIndex);
+  boardChanged(wasCelebrating);
+}
+
+void onDelta(const uint8_t *payload) {
+  MsgLightboardDelta m;
+  memcpy(&m, payload, sizeof(m));
+  finishAward();
+  bool wasCelebrating = board.state.celebrating;
+  if (!espNowLbApply(board, m)) {
+    Serial.printf("Delta v%u doesn't follow board v%u - requesting state\n", m.version, board.version);
+    requestStateRestore();
+    return;
+  }
+  boardChanged(wasCelebrating);
+}
+
+void onAward(const uint8_t *payload) {
+  MsgLightboardAward m;
+  memcpy(&m, payload, sizeof(m));
+  if ((m.player != 1 && m.player != 2) || m.count == 0) return;
+  finishAward(); // a new award starts from the previous one's end result
+  if (board.version == 0 || m.version != espNowLbNextVersion(board.version)) {
+    Serial.printf("Award v%u doesn't follow board v%u - requesting state\n", m.version, board.version);
+    requestStateRestore();
+    return;
+  }
+  Serial.printf("Award received - Player %d scores %d points\n", m.player, m.count);
+  board.version = m.version;
+  awardPlayer = m.player;
+  awardStepMs = m.stepIntervalMs;
+  awardRemaining = m.count;
+  awardLastStepMs = millis();
+  stepAward(); // first step right away
 }
 
+// Bridge messages by EspNowMsgType (nullptr = not for the lightboard)
+typedef void (*BridgeMsgHandler)(const uint8_t *payload);
+static const BridgeMsgHandler BRIDGE_HANDLERS[MSG_TYPE_COUNT] = {
+  nullptr,       // 0x00
+  onHeartbeat,   // MSG_HEARTBEAT
+  nullptr,       // MSG_HIT
+  nullptr,       // MSG_RESET_REQUEST
+  nullptr,       // MSG_CLOCK_SYNC
+  nullptr,       // MSG_HIT_LOCATION
+  nullptr,       // 0x06 (retired)
+  nullptr,       // 0x07 (retired)
+  nullptr,       // 0x08 (retired)
+  nullptr,       // 0x09 (retired)
+  onRestore,     // MSG_LB_RESTORE
+  nullptr,       // MSG_LB_STATE_REQ (lightboard -> Bridge)
+  onAward,       // MSG_LB_AWARD
+  nullptr,       // MSG_ACK (handled in handleBridgePacket)
+  nullptr,       // MSG_ROUND_CONTROL (the Bridge resets the board itself)
+  nullptr,       // 0x0F (retired)
+  onDelta,       // MSG_LB_DELTA
+  nullptr,       // MSG_TELEMETRY_STAGE (lightboard -> Bridge)
+  nullptr        // MSG_TELEMETRY_COUNTERS (lightboard -> Bridge)
+};
+
+// Runs in the Wi-Fi task: copy the packet for loop(), acknowledge, nothing else
 void OnDataRecv(const esp_now_recv_info_t *info, const uint8_t *data, int len) {
-  Serial.printf("ESP-NOW message received: len=%d, expected=%d\n", len, sizeof(struct_lightboard_message));
-  if (len != sizeof(struct_lightboard_message)) return;
-  
-  memcpy(&bridgeData, data, sizeof(bridgeData));
-
-  if (bridgeData.deviceId == 1) { // Bridge
-    // Learn Bridge MAC dynamically
-    if (info && !bridgeMacLearned) {
-      memcpy(bridgeAddress, info->src_addr, 6);
-      char macStr[18];
-      sprintf(macStr, "%02X:%02X:%02X:%02X:%02X:%02X", bridgeAddress[0],bridgeAddress[1],bridgeAddress[2],bridgeAddress[3],bridgeAddress[4],bridgeAddress[5]);
-      Serial.printf("Discovered Bridge MAC: %s\r\n", macStr);
-      esp_now_del_peer(bridgeAddress);
-      esp_now_peer_info_t p = {};
-      memcpy(p.peer_addr, bridgeAddress, 6);
-      p.channel = 1;
-      p.encrypt = false;
-      if (esp_now_add_peer(&p) == ESP_OK) {
-        bridgeMacLearned = true;
-        Serial.println("Bridge peer added after discovery");
-        Serial.println("Connection established! Heartbeats will now be sent.");
-      } else {
-        Serial.println("Failed to add discovered Bridge peer");
-      }
-    }
-    // Check if this is a new connection (was disconnected, now connected)
-    bool wasDisconnected = !bridgeConnected;
-    bridgeConnected = true;
-    lastHeartbeat = millis();
-    
-    // Clear demo mode and go black only on new connection
-    if (wasDisconnected) {
-      clearStrip();
-      Serial.println("Connection established - demo mode cleared, requesting state");
-      // Request state restore from Bridge
-      requestStateRestore();
-    }
+  EspNowHeader hdr;
+  if (!espNowParse(data, len, hdr) || hdr.sender != ESPNOW_ID_BRIDGE) {
+    rxRejected++; // reported from loop()
+    return;
+  }
 
-    if (bridgeData.action == 1) {
-      // Heartbeat - just update connection status
-      Serial.println("Bridge heartbeat received");
-    } else if (bridgeData.action == 2) {
-      // Game state update - only update essential settings (mode, colors)
-      gameMode = bridgeData.gameMode;
-      p1ColorIndex = bridgeData.p1ColorIndex;
-      p2ColorIndex = bridgeData.p2ColorIndex;
-      
-      Serial.printf("Game state update: mode=%d, p1Color=%d, p2Color=%d\n", 
-                   gameMode, p1ColorIndex, p2ColorIndex);
-      paintProgress();
-      
-    } else if (bridgeData.action == 3) {
-      // Point update - run our own game logic
-      Serial.printf("Point update received - Player %d scored, running lightboard game logic\n", bridgeData.winner);
-      handlePointUpdate(bridgeData.winner);
-      
-    } else if (bridgeData.action == 4) {
-      // Mode change
-      gameMode = bridgeData.gameMode;
-      p1ColorIndex = bridgeData.p1ColorIndex;
-      p2ColorIndex = bridgeData.p2ColorIndex;
-      Serial.printf("Mode changed to: %d\n", gameMode);
-      resetGame();
-      
-    } else if (bridgeData.action == 5) {
-      // Reset
-      Serial.println("Reset received - resetting lightboard game state");
-      resetGame();
-      
-    } else if (bridgeData.action == 6) {
-      // State restore - restore full game state from saved state
-      Serial.println("State restore received - restoring lightboard game state");
-      gameMode = bridgeData.gameMode;
-      p1ColorIndex = bridgeData.p1ColorIndex;
-      p2ColorIndex = bridgeData.p2ColorIndex;
-      p1Pos = bridgeData.p1Pos;
-      p2Pos = bridgeData.p2Pos;
-      nextLedPosition = bridgeData.nextLedPos;
-      tugBoundary = bridgeData.tugBoundary;
-      p1RacePos = bridgeData.p1RacePos;
-      p2RacePos = bridgeData.p2RacePos;
-      celebrating = bridgeData.celebrating;
-      
-      // Restore scoring sequence for mode 4 (Score Order)
-      if (gameMode == 4) {
-        // Note: scoringSequence is not in the message, so we'll just restore positions
-        // The sequence will be rebuilt as points are awarded
-      }
-      
-      Serial.printf("State restored: mode=%d, p1Pos=%d, p2Pos=%d, p1Color=%d, p2Color=%d\n",
-                   gameMode, p1Pos, p2Pos, p1ColorIndex, p2ColorIndex);
-      
-      // Update display with restored state
-      paintProgress();
+  LbRxPacket pkt;
+  pkt.len = (uint8_t)len;
+  pkt.rxUs = (uint32_t)esp_timer_get_time();
+  pkt.broadcast = info && info->des_addr && memcmp(info->des_addr, ESPNOW_BROADCAST_ADDR, 6) == 0;
+  if (info) memcpy(pkt.srcMac, info->src_addr, 6);
+  else memcpy(pkt.srcMac, bridgeAddress, 6);
+  memcpy(pkt.data, data, len);
+  if (xQueueSend(rxQueue, &pkt, 0) != pdTRUE) {
+    rxQueueDrops++; // no ACK, so the Bridge retransmits it
+    return;
+  }
+
+  // Acknowledge every queued copy right away (the Bridge retransmits after
+  // ESPNOW_ACK_TIMEOUT_US); sendToBridge() is txLock-guarded. Before the MAC is
+  // learned the Bridge's next copy gets the ACK instead.
+  if (espNowIsReliable(hdr.type) && bridgeMacLearned) {
+    MsgAck ack = {hdr.seq};
+    sendToBridge(MSG_ACK, &ack, sizeof(ack));
+  }
+}
+
+// One queued Bridge packet, on loop()
+void handleBridgePacket(const uint8_t *srcMac, bool broadcast, const uint8_t *data, uint8_t len, uint32_t rxUs) {
+  EspNowHeader hdr;
+  espNowParse(data, len, hdr); // checked in OnDataRecv
+
+  // Learn Bridge MAC dynamically (from unicast only: broadcasts leave from the
+  // Bridge's STA interface, lightboard traffic uses its AP interface)
+  if (!broadcast && !bridgeMacLearned) {
+    xSemaphoreTake(txLock, portMAX_DELAY); // the callback's ACKs go to bridgeAddress
+    memcpy(bridgeAddress, srcMac, 6);
+    xSemaphoreGive(txLock);
+    char macStr[18];
+    sprintf(macStr, "%02X:%02X:%02X:%02X:%02X:%02X", bridgeAddress[0],bridgeAddress[1],bridgeAddress[2],bridgeAddress[3],bridgeAddress[4],bridgeAddress[5]);
+    Serial.printf("Discovered Bridge MAC: %s\r\n", macStr);
+    esp_now_del_peer(bridgeAddress);
+    esp_now_peer_info_t p = {};
+    memcpy(p.peer_addr, bridgeAddress, 6);
+    p.channel = 1;
+    p.encrypt = false;
+    if (esp_now_add_peer(&p) == ESP_OK) {
+      bridgeMacLearned = true;
+      Serial.println("Bridge peer added after discovery");
+      Serial.println("Connection established! Heartbeats will now be sent.");
+    } else {
+      Serial.println("Failed to add discovered Bridge peer");
     }
   }
+  // Check if this is a new connection (was disconnected, now connected)
+  bool wasDisconnected = !bridgeConnected;
+  bridgeConnected = true;
+  lastHeartbeat = millis();
+  
+  // Replace the demo pattern with our own state on a new connection (point
+  // updates only repaint the LEDs they touch, so the board must start clean)
+  if (wasDisconnected) {
+    paintProgress();
+    Serial.println("Connection established - demo mode cleared, requesting state");
+    // Request state restore from Bridge
+    requestStateRestore();
+  }
+
+  if (!espNowTrackSeq(broadcast ? bridgeBcastSeq : bridgeSeq, hdr.boot, hdr.seq)) return; // duplicate
+
+  if (hdr.type == MSG_ACK) {
+    MsgAck ack;
+    memcpy(&ack, data + sizeof(EspNowHeader), sizeof(ack));
+    xSemaphoreTake(txLock, portMAX_DELAY);
+    txQueue.ack(srcMac, ack.seq);
+    armRetryTimer();
+    xSemaphoreGive(txLock);
+    return;
+  }
+  BridgeMsgHandler h = BRIDGE_HANDLERS[hdr.type];
+  if (!h) return;
+  const uint32_t changes = frameChanges;
+  h(data + sizeof(EspNowHeader));
+  if (frameChanges != changes && !showRxPending) {
+    showRxUs = rxUs;
+    showRxPending = true;
+  }
+}
+
+// Stage summaries and counters to the Bridge, fire-and-forget; skipped while
+// a state request is still waiting for its ACK
+void sendTelemetry() {
+  MsgTelemetryCounters c;
+  xSemaphoreTake(txLock, portMAX_DELAY);
+  bool busy = txQueue.nextDueUs() != 0;
+  c.sendFailed = telem.sendFailed;
+  c.retries = txQueue.stats.retries;
+  c.gaveUp = txQueue.stats.failed;
+  xSemaphoreGive(txLock);
+  if (busy) return;
+  c.freeHeap = ESP.getFreeHeap();
+  c.minFreeHeap = ESP.getMinFreeHeap();
+  telemetryReport(telem, c, sendToBridge);
 }
 
 // ===================== Setup =====================
@@ -422,8 +753,12 @@ void setup(){
   Serial.printf("LED Strip: %d LEDs on pin %d\r\n", NUM_LEDS, LED_PIN);
 
   // Initialize LED strip
+#if LED_OUTPUT_RMT
+  ledOutputBegin();
+#else
   strip.begin();
   strip.setBrightness(BRIGHTNESS);
+#endif
   clearStrip();
   randomSeed((uint32_t)esp_timer_get_time());
 
@@ -434,6 +769,19 @@ void setup(){
     // (removed) rely on forceStaChannel(1) before esp_now_init
   Serial.printf("WiFi Channel set to: %d\r\n", WiFi.channel());
 
+  // Reliable-send state and the receive queue must exist before the first callback
+  txLock = xSemaphoreCreateMutex();
+  rxQueue = xQueueCreate(RX_QUEUE_LEN, sizeof(LbRxPacket));
+  txSeq = (uint16_t)esp_random();
+  bootId = (uint16_t)esp_random(); // the Bridge must not mistake a reboot for retransmits
+  const esp_timer_create_args_t retryArgs = {
+    .callback = &onRetryTimer,
+    .arg = nullptr,
+    .dispatch_method = ESP_TIMER_TASK,
+    .name = "espnow_retry"
+  };
+  esp_timer_create(&retryArgs, &retryTimer);
+
   // ESP-NOW setup
   if (esp_now_init() != ESP_OK) {
     Serial.println("Error initializing ESP-NOW");
@@ -459,10 +807,10 @@ if (esp_now_add_peer(&peerInfo) == ESP_OK) {
     Serial.println("Failed to add Bridge peer");
   }
 
-  myData.deviceId = 3; // Lightboard device ID
-
-  // Initialize game state
-  resetGame();
+  // Blank Territory board until the Bridge restores the real one
+  lbSetMode(board, 1);
+  setPlayerColors(board.state.p1ColorIndex, board.state.p2ColorIndex);
+  paintProgress();
   
   Serial.println("Lightboard ready - waiting for Bridge connection");
   Serial.println("Make sure Bridge is running and has the correct lightboard MAC address");
@@ -485,139 +833,6 @@ uint32_t wheel(byte WheelPos) {
   return strip.Color(WheelPos * 3, 255 - WheelPos * 3, 0);
 }
 
-// ===================== Lightboard Game Logic =====================
-void handlePointUpdate(uint8_t scoringPlayer) {
-  // This function runs the lightboard's own game logic based on point updates
-  // The lightboard determines how to update positions based on the current game mode and which player scored
-  
-  switch (gameMode) {
-    case 1: // Territory
-      // Move the scoring player toward center
-      if (scoringPlayer == 1 && p1Pos < NUM_LEDS - 1) {
-        p1Pos++;
-      } else if (scoringPlayer == 2 && p2Pos > 0) {
-        p2Pos--;
-      }
-      break;
-      
-    case 2: // Swap Sides
-      // Move the scoring player toward center, but avoid collision
-      if (scoringPlayer == 1) {
-        if (p1Pos + 1 == p2Pos) {
-          p1Pos = p2Pos + 1; // Jump over if about to collide
-        } else if (p1Pos < NUM_LEDS - 1) {
-          p1Pos++;
-        }
-      } else if (scoringPlayer == 2) {
-        if (p2Pos - 1 == p1Pos) {
-          p2Pos = p1Pos - 1; // Jump over if about to collide
-        } else if (p2Pos > 0) {
-          p2Pos--;
-        }
-      }
-      break;
-      
-    case 3: // Split Scoring
-      // Move the scoring player away from center
-      if (scoringPlayer == 1 && p1Pos > 0) {
-        p1Pos--;
-      } else if (scoringPlayer == 2 && p2Pos < NUM_LEDS - 1) {
-        p2Pos++;
-      }
-      break;
-      
-    case 4: // Score Order
-      // Fill LEDs in sequence with the scoring player
-      if (nextLedPosition < NUM_LEDS) {
-        scoringSequence[nextLedPosition] = scoringPlayer;
-        nextLedPosition++;
-      }
-      break;
-      
-    case 5: // Race
-      // Move the scoring player forward
-      if (scoringPlayer == 1 && p1RacePos < NUM_LEDS - 1) {
-        p1RacePos++;
-      } else if (scoringPlayer == 2 && p2RacePos < NUM_LEDS - 1) {
-        p2RacePos++;
-      }
-      break;
-      
-    case 6: // Tug O War
-      // Move boundary based on who scored
-      if (scoringPlayer == 1 && tugBoundary < NUM_LEDS - 1) {
-        tugBoundary++;
-      } else if (scoringPlayer == 2 && tugBoundary >= 0) {
-        tugBoundary--;
-      }
-      break;
-  }
-  
-  // Check for win conditions
-  checkWinConditions();
-  
-  // Update display
-  paintProgress();
-}
-
-void checkWinConditions() {
-  bool p1Wins = false;
-  bool p2Wins = false;
-  
-  switch (gameMode) {
-    case 1: // Territory
-      if (p1Pos >= p2Pos) {
-        p1Wins = (p1Pos + 1 >= NUM_LEDS - p2Pos);
-        p2Wins = !p1Wins;
-      }
-      break;
-      
-    case 2: // Swap Sides
-      p1Wins = (p1Pos >= NUM_LEDS - 1);
-      p2Wins = (p2Pos <= 0);
-      break;
-      
-    case 3: // Split Scoring
-      p1Wins = (p1Pos <= 0);
-      p2Wins = (p2Pos >= NUM_LEDS - 1);
-      break;
-      
-    case 4: // Score Order
-      if (nextLedPosition >= NUM_LEDS) {
-        int p1Count = 0, p2Count = 0;
-        for (int i = 0; i < NUM_LEDS; i++) {
-          if (scoringSequence[i] == 1) p1Count++;
-          else if (scoringSequence[i] == 2) p2Count++;
-        }
-        p1Wins = (p1Count > p2Count);
-        p2Wins = !p1Wins;
-      }
-      break;
-      
-    case 5: // Race
-      p1Wins = (p1RacePos >= NUM_LEDS - 1);
-      p2Wins = (p2RacePos >= NUM_LEDS - 1);
-      break;
-      
-    case 6: // Tug O War
-      p1Wins = (tugBoundary >= NUM_LEDS - 1);
-      p2Wins = (tugBoundary < 0);
-      break;
-  }
-  
-  if (p1Wins && !p2Wins) {
-    Serial.println("Lightboard: Player 1 wins! Starting celebration...");
-    startCelebration(true); // Player 1 wins
-    celebrating = true;
-    Serial.printf("Celebration started: celActive=%d, celebrating=%d\n", celActive, celebrating);
-  } else if (p2Wins && !p1Wins) {
-    Serial.println("Lightboard: Player 2 wins! Starting celebration...");
-    startCelebration(false); // Player 2 wins
-    celebrating = true;
-    Serial.printf("Celebration started: celActive=%d, celebrating=%d\n", celActive, celebrating);
-  }
-}
-
 // ===================== Demo Mode =====================
 void runDemoMode() {
   static unsigned long lastDemoUpdate = 0;
@@ -630,18 +845,11 @@ void runDemoMode() {
       // Rainbow chase effect
       rainbowOffset = (rainbowOffset + 1) % 256;
       
-      // Clear strip
-      for (int i = 0; i < NUM_LEDS; i++) {
-        strip.setPixelColor(i, 0);
-      }
-      
       // Create rainbow chase using wheel function
       for (int i = 0; i < NUM_LEDS; i++) {
         int hue = (rainbowOffset + (i * 256 / NUM_LEDS)) % 256;
-        strip.setPixelColor(i, wheel(hue));
+        fbSet(i, wheel(hue));
       }
-      
-      strip.show();
     }
   }
 }
@@ -649,15 +857,37 @@ void runDemoMode() {
 // ===================== Loop =====================
 void loop(){
   const unsigned long nowMs = millis();
+  // Loop time is entry to entry, so it includes whatever the core ran in between
+  static uint32_t lastLoopUs = 0;
+  const uint32_t loopUs = micros();
+  if (lastLoopUs) telem.span(TELEM_LOOP, lastLoopUs, loopUs);
+  lastLoopUs = loopUs;
+
+  // Bridge packets received since the last pass
+  LbRxPacket pkt;
+  while (xQueueReceive(rxQueue, &pkt, 0) == pdTRUE) {
+    handleBridgePacket(pkt.srcMac, pkt.broadcast, pkt.data, pkt.len, pkt.rxUs);
+  }
+  static uint32_t reportedDrops = 0;
+  if (rxQueueDrops != reportedDrops) {
+    reportedDrops = rxQueueDrops;
+    Serial.printf("Receive queue full: %lu packets dropped so far\n", (unsigned long)reportedDrops);
+  }
+  static uint32_t reportedRejected = 0;
+  if (rxRejected != reportedRejected) {
+    reportedRejected = rxRejected;
+    Serial.printf("ESP-NOW packets rejected: %lu so far\n", (unsigned long)reportedRejected);
+  }
 
-  // Handle celebration animation
-  if (celebrating) {
-    if (!updateCelebration()) {
-      celebrating = false;
-      resetGame();
-      paintProgress();
-    }
+  // Animate a pending multi-point award, one step per interval
+  if (awardRemaining > 0 && nowMs - awardLastStepMs >= awardStepMs) {
+    awardLastStepMs = nowMs;
+    stepAward();
   }
+
+  // Handle celebration animation; afterwards the winning board shows until
+  // the Bridge sends the reset
+  if (celActive && !updateCelebration()) paintProgress();
   
   // Track previous connection state to detect transitions
   static bool prevBridgeConnected = false;
@@ -682,17 +912,23 @@ void loop(){
     clearStrip(); // Clear LEDs when disconnected
   }
 
-  // Send heartbeat to Bridge (start immediately after setup)
-  static unsigned long lastHeartbeatSend = 0;
-  if (millis() - lastHeartbeatSend >= 1000) {
-    myData.action = 1; // heartbeat
-    esp_now_send(bridgeAddress, (uint8_t*)&myData, sizeof(myData));
+  // One strip push per frame tick, covering everything drawn since the last one
+  fbFlush(millis());
+
+  // Send heartbeat to Bridge, unless an ACK or state request already told it
+  // we are alive (start immediately after setup)
+  if (millis() - lastTxMs >= 1000) {
+    sendToBridge(MSG_HEARTBEAT, nullptr, 0);
     if (bridgeMacLearned) {
       Serial.println("Sent heartbeat to Bridge");
     } else {
       Serial.println("Sent heartbeat to Bridge (waiting for connection)");
     }
-    lastHeartbeatSend = millis();
+  }
+
+  if (bridgeMacLearned && millis() - lastTelemMs >= TELEMETRY_REPORT_MS) {
+    lastTelemMs = millis();
+    sendTelemetry();
   }
 
   // Demo mode handles LED display when not connected
@@ -0,0 +1,221 @@
+// Lightboard game rules shared by Bridge.ino and lightboard.cpp. Plain C++
+// with no Arduino dependencies, on top of espnow_protocol.h.
+//
+// The Bridge owns the board: it applies every point, reset and mode change
+// here and replicates the result (MSG_LB_DELTA / MSG_LB_RESTORE). The
+// lightboard only renders (with each mode's pixel function below), and runs
+// the same rules to animate a multi-point award step by step towards the
+// state the Bridge already holds.
+#pragma once
+
+#include "espnow_protocol.h"
+
+static const int LB_NUM_LEDS     = ESPNOW_LB_LEDS;
+static const int LB_CENTER_LEFT  = (LB_NUM_LEDS / 2) - 1; // 18
+static const int LB_CENTER_RIGHT = (LB_NUM_LEDS / 2);     // 19
+static const uint8_t LB_NUM_MODES = 6;
+static const uint8_t LB_NUM_COLORS = 5;
+
+// LEDs a point can recolour (-1 = none), for incremental repaints
+struct LbTouched {
+  int a, b;
+};
+
+// Strip colours (0x00RRGGBB) the pixel functions draw with
+struct LbPalette {
+  uint32_t p1, p2;
+  uint32_t mix; // both players on one LED (Race)
+};
+
+struct LbRules {
+  const char *name;
+  void (*reset)(MsgLightboardState &s, uint8_t *seq);
+  LbTouched (*point)(MsgLightboardState &s, uint8_t *seq, uint8_t player);
+  uint8_t (*winner)(const MsgLightboardState &s, const uint8_t *seq); // 0 = none yet
+  // What LED i shows: the same function serves a full repaint and the few
+  // LEDs a point touched. Where players overlap, Player 2 draws over Player 1.
+  uint32_t (*pixel)(const MsgLightboardSnapshot &b, const LbPalette &pal, int i);
+};
+
+// ---- Territory: players expand from opposite ends ----
+static inline void lbTerritoryReset(MsgLightboardState &s, uint8_t *) {
+  s.p1Pos = -1;
+  s.p2Pos = LB_NUM_LEDS;
+}
+static inline LbTouched lbTerritoryPoint(MsgLightboardState &s, uint8_t *, uint8_t player) {
+  if (player == 1 && s.p1Pos < LB_NUM_LEDS - 1) return {++s.p1Pos, -1};
+  if (player == 2 && s.p2Pos > 0) return {--s.p2Pos, -1};
+  return {-1, -1};
+}
+static inline uint8_t lbTerritoryWinner(const MsgLightboardState &s, const uint8_t *) {
+  if (s.p1Pos < s.p2Pos) return 0;
+  return (s.p1Pos + 1 >= LB_NUM_LEDS - s.p2Pos) ? 1 : 2;
+}
+static inline uint32_t lbTerritoryPixel(const MsgLightboardSnapshot &b, const LbPalette &pal, int i) {
+  if (i >= b.state.p2Pos) return pal.p2;
+  if (i <= b.state.p1Pos) return pal.p1;
+  return 0;
+}
+
+// ---- Swap Sides: players jump over each other ----
+static inline LbTouched lbSwapPoint(MsgLightboardState &s, uint8_t *, uint8_t player) {
+  if (player == 1) {
+    int from = s.p1Pos;
+    if (s.p1Pos + 1 == s.p2Pos) s.p1Pos = s.p2Pos + 1; // jump over if about to collide
+    else if (s.p1Pos < LB_NUM_LEDS - 1) s.p1Pos++;
+    return {from, s.p1Pos};
+  }
+  if (player == 2) {
+    int from = s.p2Pos;
+    if (s.p2Pos - 1 == s.p1Pos) s.p2Pos = s.p1Pos - 1;
+    else if (s.p2Pos > 0) s.p2Pos--;
+    return {from, s.p2Pos};
+  }
+  return {-1, -1};
+}
+static inline uint8_t lbSwapWinner(const MsgLightboardState &s, const uint8_t *) {
+  bool p1 = s.p1Pos >= LB_NUM_LEDS - 1, p2 = s.p2Pos <= 0;
+  return (p1 && !p2) ? 1 : (p2 && !p1) ? 2 : 0;
+}
+static inline uint32_t lbSwapPixel(const MsgLightboardSnapshot &b, const LbPalette &pal, int i) {
+  if (i == b.state.p2Pos) return pal.p2;
+  if (i == b.state.p1Pos) return pal.p1;
+  return 0;
+}
+
+// ---- Split Scoring: players expand from the centre outward ----
+static inline void lbSplitReset(MsgLightboardState &s, uint8_t *) {
+  s.p1Pos = LB_CENTER_LEFT + 1;
+  s.p2Pos = LB_CENTER_RIGHT - 1;
+}
+static inline LbTouched lbSplitPoint(MsgLightboardState &s, uint8_t *, uint8_t player) {
+  if (player == 1 && s.p1Pos > 0) return {--s.p1Pos, -1};
+  if (player == 2 && s.p2Pos < LB_NUM_LEDS - 1) return {++s.p2Pos, -1};
+  return {-1, -1};
+}
+static inline uint8_t lbSplitWinner(const MsgLightboardState &s, const uint8_t *) {
+  bool p1 = s.p1Pos <= 0, p2 = s.p2Pos >= LB_NUM_LEDS - 1;
+  return (p1 && !p2) ? 1 : (p2 && !p1) ? 2 : 0;
+}
+static inline uint32_t lbSplitPixel(const MsgLightboardSnapshot &b, const LbPalette &pal, int i) {
+  if (i >= LB_CENTER_RIGHT && i <= b.state.p2Pos) return pal.p2;
+  if (i <= LB_CENTER_LEFT && i >= b.state.p1Pos) return pal.p1;
+  return 0;
+}
+
+// ---- Score Order: LEDs fill in scoring order ----
+static inline void lbScoreOrderReset(MsgLightboardState &s, uint8_t *seq) {
+  s.nextLedPos = 0;
+  memset(seq, 0, ESPNOW_LB_SEQ_BYTES);
+}
+static inline LbTouched lbScoreOrderPoint(MsgLightboardState &s, uint8_t *seq, uint8_t player) {
+  if (s.nextLedPos >= LB_NUM_LEDS) return {-1, -1};
+  espNowLbSeqSet(seq, s.nextLedPos, player);
+  return {s.nextLedPos++, -1};
+}
+static inline uint8_t lbScoreOrderWinner(const MsgLightboardState &s, const uint8_t *seq) {
+  if (s.nextLedPos < LB_NUM_LEDS) return 0;
+  int p1 = 0, p2 = 0;
+  for (int i = 0; i < LB_NUM_LEDS; i++) {
+    uint8_t owner = espNowLbSeqGet(seq, i);
+    if (owner == 1) p1++;
+    else if (owner == 2) p2++;
+  }
+  return p1 > p2 ? 1 : 2;
+}
+static inline uint32_t lbScoreOrderPixel(const MsgLightboardSnapshot &b, const LbPalette &pal, int i) {
+  if (i >= b.state.nextLedPos) return 0;
+  uint8_t owner = espNowLbSeqGet(b.sequence, i);
+  if (owner == 1) return pal.p1;
+  if (owner == 2) return pal.p2;
+  return 0;
+}
+
+// ---- Race: first to the far end ----
+static inline void lbRaceReset(MsgLightboardState &s, uint8_t *) {
+  s.p1RacePos = -1;
+  s.p2RacePos = -1;
+}
+static inline LbTouched lbRacePoint(MsgLightboardState &s, uint8_t *, uint8_t player) {
+  if (player == 1 && s.p1RacePos < LB_NUM_LEDS - 1) { int from = s.p1RacePos; return {from, ++s.p1RacePos}; }
+  if (player == 2 && s.p2RacePos < LB_NUM_LEDS - 1) { int from = s.p2RacePos; return {from, ++s.p2RacePos}; }
+  return {-1, -1};
+}
+static inline uint8_t lbRaceWinner(const MsgLightboardState &s, const uint8_t *) {
+  bool p1 = s.p1RacePos >= LB_NUM_LEDS - 1, p2 = s.p2RacePos >= LB_NUM_LEDS - 1;
+  return (p1 && !p2) ? 1 : (p2 && !p1) ? 2 : 0;
+}
+static inline uint32_t lbRacePixel(const MsgLightboardSnapshot &b, const LbPalette &pal, int i) {
+  bool p1Here = (b.state.p1RacePos >= 0 && i == b.state.p1RacePos);
+  bool p2Here = (b.state.p2RacePos >= 0 && i == b.state.p2RacePos);
+  if (p1Here && p2Here) return pal.mix;
+  if (p2Here) return pal.p2;
+  if (p1Here) return pal.p1;
+  return 0;
+}
+
+// ---- Tug O War: each point pulls the boundary one LED towards the other player ----
+static inline void lbTugReset(MsgLightboardState &s, uint8_t *) {
+  s.tugBoundary = LB_CENTER_LEFT;
+}
+static inline LbTouched lbTugPoint(MsgLightboardState &s, uint8_t *, uint8_t player) {
+  if (player == 1 && s.tugBoundary < LB_NUM_LEDS - 1) return {++s.tugBoundary, -1};
+  if (player == 2 && s.tugBoundary >= 0) return {s.tugBoundary--, -1};
+  return {-1, -1};
+}
+static inline uint8_t lbTugWinner(const MsgLightboardState &s, const uint8_t *) {
+  return s.tugBoundary >= LB_NUM_LEDS - 1 ? 1 : s.tugBoundary < 0 ? 2 : 0;
+}
+static inline uint32_t lbTugPixel(const MsgLightboardSnapshot &b, const LbPalette &pal, int i) {
+  return i <= b.state.tugBoundary ? pal.p1 : pal.p2;
+}
+
+// Indexed by gameMode; 0 and unknown modes play as Territory
+static const LbRules LB_RULES[LB_NUM_MODES + 1] = {
+  {"Territory",     lbTerritoryReset,  lbTerritoryPoint,  lbTerritoryWinner,  lbTerritoryPixel},
+  {"Territory",     lbTerritoryReset,  lbTerritoryPoint,  lbTerritoryWinner,  lbTerritoryPixel},
+  {"Swap Sides",    lbTerritoryReset,  lbSwapPoint,       lbSwapWinner,       lbSwapPixel},
+  {"Split Scoring", lbSplitReset,      lbSplitPoint,      lbSplitWinner,      lbSplitPixel},
+  {"Score Order",   lbScoreOrderReset, lbScoreOrderPoint, lbScoreOrderWinner, lbScoreOrderPixel},
+  {"Race",          lbRaceReset,       lbRacePoint,       lbRaceWinner,       lbRacePixel},
+  {"Tug O War",     lbTugReset,        lbTugPoint,        lbTugWinner,        lbTugPixel},
+};
+
+static inline const LbRules &lbRulesFor(uint8_t mode) {
+  return LB_RULES[mode <= LB_NUM_MODES ? mode : 0];
+}
+
+// New game in the current mode; settings (mode, colours) stay
+static inline void lbReset(MsgLightboardSnapshot &b) {
+  lbRulesFor(b.state.gameMode).reset(b.state, b.sequence);
+  b.state.celebrating = 0;
+  b.state.winner = 0;
+}
+
+// Mode change: every mode starts from its own reset state
+static inline void lbSetMode(MsgLightboardSnapshot &b, uint8_t mode) {
+  b.state.gameMode = mode;
+  lbTerritoryReset(b.state, b.sequence);
+  lbScoreOrderReset(b.state, b.sequence);
+  lbRaceReset(b.state, b.sequence);
+  lbTugReset(b.state, b.sequence);
+  lbReset(b);
+}
+
+// One point; the board freezes on a win until the next reset. Returns the
+// winner this point produced (0 = none).
+static inline uint8_t lbPoint(MsgLightboardSnapshot &b, uint8_t player, LbTouched *touched = nullptr) {
+  LbTouched t = {-1, -1};
+  uint8_t won = 0;
+  if (!b.state.celebrating && (player == 1 || player == 2)) {
+    const LbRules &r = lbRulesFor(b.state.gameMode);
+    t = r.point(b.state, b.sequence, player);
+    won = r.winner(b.state, b.sequence);
+    if (won) {
+      b.state.celebrating = 1;
+      b.state.winner = won;
+    }
+  }
+  if (touched) *touched = t;
+  return won;
+}
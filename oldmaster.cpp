@@ -1,7 +1,17 @@
 #include <WiFi.h>
 #include <esp_now.h>
 #include <esp_wifi.h>
-#include <ArduinoJson.h>
+
+// 1: page and WebSocket on AsyncTCP (ESPAsyncWebServer), served from the TCP
+// task so a page load or a slow client never holds up loop(). 0: WebServer and
+// WebSocketsServer polled from loop()
+#define WEB_ASYNC 1
+#if WEB_ASYNC
+#include <ESPAsyncWebServer.h>
+#else
+#include <WebServer.h>
+#include <WebSocketsServer.h>
+#endif
 
 #define LED_PIN 2
 
@@ -9,6 +19,8 @@
 // ESP-NOW Bridge: communicates between Raspberry Pi and other ESP32s
 static const unsigned long HEARTBEAT_INTERVAL_MS = 1000;   // heartbeat to players
 static const unsigned long SERIAL_TIMEOUT_MS = 100;        // serial read timeout
+static const char* AP_SSID = "ToolBoard";                  // SoftAP for the web UI
+static const char* AP_PASS = "12345678";
 // =======================================================
 
 // ===================== ESP-NOW Configuration =====================
@@ -95,7 +107,6 @@ void awardMultiplePointsToPlayer(uint8_t playerId, int multiplier);
 
 // Local sensor state removed (host-only)
 // Local result tracking removed (host-only)
-unsigned long g_lastBroadcastMs = 0;
 
 // HitResult struct removed (host-only, no local hit detection)
 
@@ -125,1855 +136,67 @@ const unsigned long QUIZ_ACTION_DEBOUNCE_MS = 500; // 500ms debounce period
 // =======================================================
 
 // ===================== UI =====================
-const char HTML[] PROGMEM = R"HTML(
-<!doctype html><html><head><meta name=viewport content="width=device-width, initial-scale=1, maximum-scale=1, user-scalable=no, viewport-fit=cover"><meta charset="utf-8">
-<title>ToolBoard Quiz</title>
-<style>
-:root{ --text:#e5e7eb; --ok:#10b981; --bad:#ef4444; --accent:#6366f1; --accent2:#8b5cf6; --bg:#0b1220; --card:#101a33; --ink:#eaf0ff; --muted:#aab6d3; }
-html{ -webkit-text-size-adjust:100%; text-size-adjust:100%; }
-html,body{min-height:100%}
-body{ margin:0; font-family:system-ui,Segoe UI,Roboto,Arial; color:var(--text);
-  background:radial-gradient(1200px 600px at 50% -20%, #1e293b 0%, #0b1220 60%, #070b13 100%);
-  display:flex; align-items:flex-start; justify-content:center; padding:24px; }
-.app-container{ margin-top:max(0px, calc(50vh - 300px)); }
-.card{ background:linear-gradient(180deg, rgba(255,255,255,0.04), rgba(255,255,255,0.02));
-  border:1px solid rgba(255,255,255,0.08); border-radius:16px; padding:28px 22px;
-  box-shadow:0 10px 30px rgba(0,0,0,0.3), inset 0 1px 0 rgba(255,255,255,0.04); text-align:center; width:min(520px, 92vw) }
-#connDot{ position:fixed; z-index:5; width:14px; height:14px; border-radius:50%;
-  top:calc(env(safe-area-inset-top, 0px) + 12px); right:calc(env(safe-area-inset-right, 0px) + 12px);
-  border:2px solid rgba(255,255,255,0.25); }
-.ok{background:var(--ok); box-shadow:0 0 0 2px rgba(255,255,255,0.15), 0 0 14px rgba(16,185,129,.45)}
-.bad{background:var(--bad); box-shadow:0 0 0 2px rgba(255,255,255,0.15), 0 0 14px rgba(239,68,68,.45)}
-
-/* Quiz Styles */
-.app { width: min(900px, 96vw); }
-h1 { font-weight: 700; letter-spacing: .3px; margin: 0 0 14px; font-size: clamp(20px, 3.3vw, 32px); color: var(--accent2); }
-.bar { display: flex; gap: 10px; align-items: center; justify-content: space-between; margin-bottom: 12px; flex-wrap: wrap; }
-.pill { background: rgba(255,255,255,.06); border: 1px solid rgba(255,255,255,.08); color: var(--muted); padding: 8px 12px; border-radius: 999px; font-size: 13px; }
-
-   .quiz-card {
-    background: linear-gradient(180deg, rgba(255,255,255,.04), rgba(255,255,255,.02));
-    border: 1px solid rgba(255,255,255,.12);
-    border-radius: 18px; padding: clamp(18px, 3.5vw, 28px);
-    box-shadow: 0 10px 30px rgba(0,0,0,.35), 0 2px 8px rgba(0,0,0,.25);
-    transition: transform .2s ease, box-shadow .2s ease;
-    margin-bottom: 20px;
-    min-height: 200px;
-    display: flex;
-    flex-direction: column;
-    justify-content: center;
-    position: relative;
-  }
-.quiz-card:active { transform: scale(.998); box-shadow: 0 6px 18px rgba(0,0,0,.35); }
-
- .q { font-size: clamp(20px, 3vw, 28px); line-height: 1.3; margin: 0; min-height: 1.3em; }
- .a { position: absolute; bottom: 0; left: 0; right: 0; margin-top: 14px; font-size: clamp(18px, 2.3vw, 22px); color: #d6f2ff; opacity: 0; visibility: hidden; max-height: 0; overflow: hidden; padding: 0 clamp(18px, 3.5vw, 28px) clamp(18px, 3.5vw, 28px) clamp(18px, 3.5vw, 28px); }
- .a.show { opacity: 1; visibility: visible; max-height: 200px; }
-
- .category-badge {
-   background: linear-gradient(180deg, rgba(155,225,255,.15), rgba(155,225,255,.08));
-   border: 1px solid rgba(155,225,255,.2);
-   border-radius: 8px;
-   padding: 6px 12px;
-   font-size: 12px;
-   font-weight: 600;
-   color: var(--accent-2);
-   position: absolute;
-   top: 12px;
-   left: 12px;
-   z-index: 1;
- }
-
-.controls { display: grid; grid-template-columns: 1fr 1fr 1fr; gap: 10px; margin-top: 16px; }
-button {
-  -webkit-tap-highlight-color: transparent;
-  appearance: none; cursor: pointer; user-select: none;
-  border: 1px solid rgba(255,255,255,.14); color: var(--ink);
-  background: linear-gradient(180deg, rgba(106,161,255,.22), rgba(106,161,255,.12));
-  border-radius: 14px; padding: 12px 14px; font-size: 15px; font-weight: 600;
-  box-shadow: 0 10px 30px rgba(0,0,0,.35), 0 2px 8px rgba(0,0,0,.25); 
-  transition: transform .1s ease, filter .2s ease, background .2s ease;
-}
-button:hover { filter: brightness(1.05); }
-button:active { transform: translateY(1px) scale(.998); }
-.ghost { background: rgba(255,255,255,.06); }
-
-.progress { margin-top: 8px; font-size: 13px; color: var(--muted); display: flex; justify-content: space-between; align-items: center; }
-.kbd { font-family: ui-monospace, SFMono-Regular, Menlo, Monaco, Consolas, "Liberation Mono", monospace; font-size: 12px; color: #cfe1ff; opacity: .9; }
-
-.hidden { 
-  display: none !important; 
-  visibility: hidden !important;
-  opacity: 0 !important;
-  height: 0 !important;
-  overflow: hidden !important;
-}
-
-
-
-
-
- /* Reset Button Styles */
- .reset-section {
-   background: rgba(255,255,255,.02);
-   border: 1px solid rgba(255,255,255,.06);
-   border-radius: 12px;
-   padding: 12px 16px;
-   margin-bottom: 16px;
-   display: flex;
-   align-items: center;
-   gap: 12px;
-   flex-wrap: wrap;
- }
-
- .reset-btn {
-   background: linear-gradient(180deg, rgba(239,68,68,.25), rgba(239,68,68,.15)) !important;
-   border: 1px solid rgba(239,68,68,.3) !important;
-   color: #fca5a5 !important;
-   font-size: 14px !important;
-   padding: 6px 12px !important;
-   border-radius: 8px !important;
-   transition: all 0.2s ease;
-   display: flex;
-   align-items: center;
-   gap: 6px;
- }
-
- .reset-btn:hover {
-   background: linear-gradient(180deg, rgba(239,68,68,.35), rgba(239,68,68,.25)) !important;
-   transform: translateY(-1px);
- }
-
- .reset-hint {
-   font-size: 11px;
-   color: var(--muted);
-   opacity: 0.8;
- }
-
- /* File Upload Styles */
- .file-input {
-   background: rgba(255,255,255,.02);
-   border: 1px solid rgba(255,255,255,.06);
-   border-radius: 12px;
-   padding: 12px 16px;
-   margin-bottom: 16px;
-   display: flex;
-   align-items: center;
-   gap: 12px;
-   flex-wrap: wrap;
- }
-
-.file-input input[type="file"] {
-  display: none;
-}
-
-.file-input label {
-  cursor: pointer;
-  color: var(--accent);
-  font-weight: 500;
-  font-size: 14px;
-  display: flex;
-  align-items: center;
-  gap: 6px;
-  padding: 6px 12px;
-  background: rgba(106,161,255,.1);
-  border: 1px solid rgba(106,161,255,.2);
-  border-radius: 8px;
-  transition: all 0.2s ease;
-}
-
-.file-input label:hover {
-  background: rgba(106,161,255,.15);
-  transform: translateY(-1px);
-}
-
-/* Lightboard Settings Button - matches file-input label styling */
-.lightboard-settings-btn {
-  cursor: pointer;
-  color: var(--accent);
-  font-weight: 500;
-  font-size: 14px;
-  display: flex;
-  align-items: center;
-  gap: 6px;
-  padding: 6px 12px;
-  background: rgba(106,161,255,.1);
-  border: 1px solid rgba(106,161,255,.2);
-  border-radius: 8px;
-  transition: all 0.2s ease;
-}
-
-.lightboard-settings-btn:hover {
-  background: rgba(106,161,255,.15);
-  transform: translateY(-1px);
-}
-
- .file-input .hint {
-   font-size: 11px;
-   color: var(--muted);
-   opacity: 0.8;
- }
-
-
- /* Settings Modal Styles */
- .settings-section {
-   margin-bottom: 20px;
- }
-
- .settings-section label {
-   display: block;
-   font-weight: 600;
-   color: var(--accent);
-   margin-bottom: 8px;
-   font-size: 14px;
- }
-
- .settings-select {
-   width: 100%;
-   padding: 10px 12px;
-   border: 1px solid rgba(255,255,255,.14);
-   border-radius: 8px;
-   background: rgba(255,255,255,.06);
-   color: var(--ink);
-   font-size: 14px;
-   font-weight: 500;
-   transition: all 0.2s ease;
- }
-
- .settings-select:focus {
-   outline: none;
-   border-color: var(--accent);
-   background: rgba(255,255,255,.1);
-   box-shadow: 0 0 0 2px rgba(99,102,241,.2);
- }
-
-.loaded-files {
-  margin-left: auto;
-  font-size: 11px;
-  color: var(--muted);
-}
-
-.loaded-files h3 {
-  display: none;
-}
-
-.file-list {
-  list-style: none;
-  padding: 0;
-  margin: 0;
-  display: flex;
-  gap: 8px;
-  flex-wrap: wrap;
-}
-
-.file-list li {
-  background: rgba(255,255,255,.03);
-  border: 1px solid rgba(255,255,255,.06);
-  border-radius: 6px;
-  padding: 4px 8px;
-  font-size: 11px;
-  color: var(--muted);
-  opacity: 0.8;
-}
-
-.file-list .success {
-  color: #4ade80;
-  opacity: 0.9;
-}
-
-.file-list .error {
-  color: #f87171;
-  opacity: 0.9;
-}
-
-/* Category Selector Styles */
-.category-selector {
-  background: linear-gradient(180deg, rgba(255,255,255,.04), rgba(255,255,255,.02));
-  border: 1px solid rgba(255,255,255,.12);
-  border-radius: 18px; padding: clamp(18px, 3.5vw, 28px);
-  box-shadow: var(--shadow);
-  margin-bottom: 20px;
-}
-
-.category-selector h2 {
-  margin: 0 0 16px 0;
-  font-size: clamp(18px, 2.5vw, 24px);
-  color: var(--accent);
-}
-
-.category-grid {
-  display: grid;
-  grid-template-columns: repeat(auto-fit, minmax(200px, 1fr));
-  gap: 12px;
-}
-
-.category-btn {
-  background: linear-gradient(180deg, rgba(106,161,255,.15), rgba(106,161,255,.08));
-  border: 1px solid rgba(255,255,255,.12);
-  border-radius: 12px;
-  padding: 16px;
-  text-align: center;
-  cursor: pointer;
-  transition: all 0.2s ease;
-  font-weight: 600;
-}
-
-.category-btn:hover {
-  background: linear-gradient(180deg, rgba(106,161,255,.25), rgba(106,161,255,.15));
-  transform: translateY(-2px);
-  box-shadow: 0 8px 25px rgba(0,0,0,.3);
-}
-
- .category-btn.selected {
-   background: linear-gradient(180deg, rgba(155,225,255,.25), rgba(155,225,255,.15));
-   border-color: var(--accent-2);
- }
-
-               /* Game Status in Quiz Mode */
-    .game-status {
-      position: relative;
-      height: 80px;
-      margin-bottom: 20px;
-      text-align: center;
-      overflow: visible;
-    }
-
-   .player-display {
-     display: flex;
-     justify-content: center;
-     gap: 20px;
-     align-items: center;
-     height: 100%;
-   }
-
-               .player-tile {
-       background: linear-gradient(180deg, rgba(255,255,255,.02), rgba(255,255,255,.01));
-       border: 1px solid rgba(255,255,255,.08);
-       border-radius: 12px;
-       padding: 12px 18px;
-       min-width: 100px;
-       transition: all 0.3s ease;
-       opacity: 0.4;
-       filter: grayscale(1);
-       transform: scale(0.9);
-     }
-
-         .player-tile.winner {
-       background: linear-gradient(135deg, rgba(99,102,241,.25), rgba(139,92,246,.25));
-       border: 1px solid rgba(99,102,241,.35);
-       opacity: 1;
-       filter: grayscale(0);
-       transform: scale(1.05) !important;
-       box-shadow: 0 8px 25px rgba(99,102,241,.3);
-     }
-
-               .player-name {
-       font-weight: 600;
-       font-size: 16px;
-       color: var(--ink);
-       text-align: center;
-       cursor: pointer;
-       user-select: none;
-       transition: color 0.2s ease;
-     }
-
-     .player-name:hover {
-       /* No hover effects */
-     }
-
-     .player-tile:not(.scorable) .player-name:hover {
-       /* No hover effects */
-     }
-
-     .player-name.editing {
-       background: rgba(255,255,255,.1);
-       border-radius: 4px;
-       padding: 2px 6px;
-       outline: 2px solid var(--accent);
-     }
-
-     .player-score {
-       font-size: 12px;
-       color: var(--muted);
-       margin-top: 4px;
-       font-weight: 500;
-     }
-
-           .player-tile.scorable {
-        cursor: pointer;
-        /* No size changes - only winner class should change size */
-      }
-
-             .player-tile.scorable:hover {
-         /* No hover effects - tiles stay at their current size */
-       }
-
-       .player-tile.scorable:active {
-         /* No active effects */
-       }
-
-      .player-tile:not(.scorable) {
-        cursor: default;
-        transform: scale(0.9) !important;
-      }
-
-             .player-tile:not(.scorable):hover {
-         transform: scale(0.9) !important;
-         box-shadow: none !important;
-       }
-
-       .player-tile:not(.scorable):active {
-         transform: scale(0.9) !important;
-       }
-
-       .player-tile:not(.scorable) .player-name:hover {
-         color: var(--ink) !important;
-       }
-
-           /* Exit Button Styles */
-      .exit-btn {
-        background: rgba(255,255,255,.04) !important;
-        border: 1px solid rgba(255,255,255,.08) !important;
-        color: var(--muted) !important;
-        font-size: 16px !important;
-        padding: 6px 10px !important;
-        border-radius: 8px !important;
-        opacity: 0.7;
-        transition: opacity 0.2s ease;
-        min-width: auto !important;
-        width: auto !important;
-      }
-
-      .exit-btn:hover {
-        opacity: 1;
-        background: rgba(255,255,255,.08) !important;
-      }
-
-                                 @media (max-width: 520px) {
-        .controls { grid-template-columns: 1fr 1fr; }
-        .category-grid { grid-template-columns: 1fr; }
-        #connDot { display: none; }
-        .progress { display: none; }
-        #toggle { display: none; }
-                 .exit-btn { font-size: 14px !important; padding: 4px 8px !important; }
-       }
-
-       /* Modal Dialog Styles */
-       .modal-overlay {
-         position: fixed;
-         top: 0;
-         left: 0;
-         right: 0;
-         bottom: 0;
-         background: rgba(0, 0, 0, 0.7);
-         display: flex;
-         align-items: center;
-         justify-content: center;
-         z-index: 1000;
-         backdrop-filter: blur(4px);
-         transition: opacity 0.3s ease;
-       }
-
-       .modal-overlay.hidden {
-         opacity: 0;
-         pointer-events: none;
-       }
-
-       .modal-dialog {
-         background: linear-gradient(180deg, rgba(255,255,255,.08), rgba(255,255,255,.04));
-         border: 1px solid rgba(255,255,255,.12);
-         border-radius: 16px;
-         padding: 0;
-         max-width: 400px;
-         width: 90vw;
-         box-shadow: 0 20px 60px rgba(0,0,0,.5), 0 8px 25px rgba(0,0,0,.3);
-         transform: scale(0.9);
-         transition: transform 0.3s ease;
-       }
-
-       .modal-overlay:not(.hidden) .modal-dialog {
-         transform: scale(1);
-       }
-
-       .modal-header {
-         padding: 20px 24px 16px;
-         border-bottom: 1px solid rgba(255,255,255,.08);
-       }
-
-       .modal-header h3 {
-         margin: 0;
-         font-size: 18px;
-         font-weight: 600;
-         color: var(--accent);
-       }
-
-       .modal-content {
-         padding: 20px 24px;
-       }
-
-       .modal-content p {
-         margin: 0;
-         font-size: 15px;
-         line-height: 1.4;
-         color: var(--text);
-       }
-
-       .modal-actions {
-         padding: 16px 24px 20px;
-         display: flex;
-         gap: 12px;
-         justify-content: flex-end;
-       }
-
-       .modal-btn {
-         padding: 10px 20px;
-         border-radius: 10px;
-         font-size: 14px;
-         font-weight: 600;
-         border: 1px solid rgba(255,255,255,.14);
-         cursor: pointer;
-         transition: all 0.2s ease;
-         min-width: 80px;
-       }
-
-       .modal-btn.cancel {
-         background: rgba(255,255,255,.06);
-         color: var(--muted);
-       }
-
-       .modal-btn.cancel:hover {
-         background: rgba(255,255,255,.1);
-         color: var(--text);
-       }
-
-       .modal-btn.confirm {
-         background: linear-gradient(180deg, rgba(239,68,68,.25), rgba(239,68,68,.15));
-         color: #fca5a5;
-         border-color: rgba(239,68,68,.3);
-       }
-
-       .modal-btn.confirm:hover {
-         background: linear-gradient(180deg, rgba(239,68,68,.35), rgba(239,68,68,.25));
-         transform: translateY(-1px);
-       }
-
-                @media (max-width: 520px) {
-           .modal-dialog {
-             width: 95vw;
-             margin: 20px;
-           }
-           
-           .modal-actions {
-             flex-direction: column;
-           }
-           
-           .modal-btn {
-             width: 100%;
-           }
-           
-                        .file-input .hint {
-               display: none;
-             }
-             
-             .reset-hint {
-               display: none;
-             }
-         }
- </style>
-</head><body>
-  <div id=connDot class="bad"></div>
-  
-     <div class="app app-container">
-     <!-- Quiz Interface -->
-     <div id="quizInterface">
-             <!-- Reset Button -->
-       <div class="reset-section">
-         <button id="resetAllData" class="reset-btn">🗑️ Reset All Data</button>
-         <div class="reset-hint">This will clear all loaded categories, scores, and player names</div>
-       </div>
-
-       <!-- Lightboard Settings Button -->
-       <div class="file-input" id="lightboardModeSection">
-         <button id="lightboardSettingsBtn" class="lightboard-settings-btn">
-           💡 Lightboard
-         </button>
-         <div class="hint">Configure game mode and player colors</div>
-       </div>
-
-       <!-- File Upload Section -->
-       <div class="file-input" id="fileInputSection">
-         <label for="csvFile">📁 Load CSV Files</label>
-         <input type="file" id="csvFile" accept=".csv" multiple>
-         <div class="hint">Hold Ctrl/Cmd for multiple files</div>
-         
-         <div class="loaded-files hidden" id="loadedFiles">
-           <h3>Loaded Files:</h3>
-           <ul class="file-list" id="fileList"></ul>
-         </div>
-       </div>
-
-      <!-- Category Selector -->
-      <div class="category-selector hidden" id="categorySelector">
-        <h2>Choose a Quiz Category</h2>
-        <div class="category-grid" id="categoryGrid">
-          <div class="category-btn">Loading categories...</div>
-        </div>
-      </div>
-
-             <!-- Quiz Display -->
-       <div class="quiz-display hidden" id="quizDisplay">
-                   <div class="bar">
-            <h1 id="quizTitle">Quick‑Fire Quiz</h1>
-            <div class="pill"><span id="counter">Loading...</span></div>
-            <button id="exitBtn" class="exit-btn" title="Exit to Categories">↩</button>
-          </div>
-
-                                       <!-- Game Status in Quiz Mode -->
-                       <div class="game-status" id="gameStatus">
-              <div class="player-display">
-                <div class="player-tile" id="player2Tile">
-                  <div class="player-name">Player 2</div>
-                  <div class="player-score" id="player2Score">0</div>
-                </div>
-                <div class="player-tile" id="player3Tile">
-                  <div class="player-name">Player 3</div>
-                  <div class="player-score" id="player3Score">0</div>
-                </div>
-              </div>
-            </div>
-
-         <div class="quiz-card" id="card" aria-live="polite">
-           <div class="category-badge hidden" id="categoryBadge"></div>
-           <p class="q" id="q">Loading…</p>
-           <p class="a" id="a"><strong>Answer:</strong> <span id="answerText"></span></p>
-         </div>
-
-                   <div class="controls" aria-label="Controls">
-            <button id="prev" title="Previous (←)">◀ Prev</button>
-            <button id="toggle" class="ghost" title="Show/Hide Answer (Space)">Show Answer</button>
-            <button id="next" title="Next (→)">Next ▶</button>
-          </div>
-          
-          
-
-                   <div class="progress">
-            <div>Shortcuts: <span class="kbd">←/→</span> prev/next, <span class="kbd">Space</span> show</div>
-            <div class="kbd">Tip: Click the card to toggle the answer.</div>
-          </div>
-        </div>
-     </div>
-
-           <!-- Exit Confirmation Dialog -->
-      <div class="modal-overlay hidden" id="confirmModal">
-        <div class="modal-dialog">
-          <div class="modal-header">
-            <h3>Exit Quiz?</h3>
-          </div>
-          <div class="modal-content">
-            <p>Are you sure you want to exit this quiz and return to categories?</p>
-          </div>
-          <div class="modal-actions">
-            <button class="modal-btn cancel" id="cancelExit">Cancel</button>
-            <button class="modal-btn confirm" id="confirmExit">Exit</button>
-          </div>
-        </div>
-      </div>
-
-      <!-- Reset Data Confirmation Dialog -->
-      <div class="modal-overlay hidden" id="resetModal">
-        <div class="modal-dialog">
-          <div class="modal-header">
-            <h3>Reset All Data?</h3>
-          </div>
-          <div class="modal-content">
-            <p>Are you sure you want to reset all data? This will clear:</p>
-            <ul style="margin: 12px 0; padding-left: 20px; color: var(--muted);">
-              <li>All loaded categories</li>
-              <li>Player scores</li>
-              <li>Player names</li>
-              <li>Current quiz progress</li>
-            </ul>
-            <p style="color: #fca5a5; font-weight: 600;">This action cannot be undone.</p>
-          </div>
-          <div class="modal-actions">
-            <button class="modal-btn cancel" id="cancelReset">Cancel</button>
-            <button class="modal-btn confirm" id="confirmReset">Reset All Data</button>
-          </div>
-        </div>
-      </div>
-
-      <!-- Lightboard Settings Dialog -->
-      <div class="modal-overlay hidden" id="lightboardModal">
-        <div class="modal-dialog">
-          <div class="modal-header">
-            <h3>🎮 Lightboard Settings</h3>
-          </div>
-          <div class="modal-content">
-            <div class="settings-section">
-              <label for="lightboardMode">Game Mode:</label>
-              <select id="lightboardMode" class="settings-select">
-                <option value="1">Territory</option>
-                <option value="2">Swap Sides</option>
-                <option value="3">Split Scoring</option>
-                <option value="4">Score Order</option>
-                <option value="5">Race</option>
-                <option value="6">Tug O War</option>
-              </select>
-            </div>
-            
-            <div class="settings-section">
-              <label for="lightboardP2Color">Player 2 Color:</label>
-              <select id="lightboardP2Color" class="settings-select">
-                <option value="0">Red</option>
-                <option value="1">Blue</option>
-                <option value="2">Green</option>
-                <option value="3">Magenta</option>
-                <option value="4">Orange</option>
-              </select>
-            </div>
-            
-            <div class="settings-section">
-              <label for="lightboardP3Color">Player 3 Color:</label>
-              <select id="lightboardP3Color" class="settings-select">
-                <option value="0">Red</option>
-                <option value="1">Blue</option>
-                <option value="2">Green</option>
-                <option value="3">Magenta</option>
-                <option value="4">Orange</option>
-              </select>
-            </div>
-            
-            <div class="settings-section">
-              <label for="damageMultiplier">Damage Multiplier:</label>
-              <select id="damageMultiplier" class="settings-select">
-                <option value="1">Single (1x)</option>
-                <option value="2">Double (2x)</option>
-                <option value="3">Triple (3x)</option>
-                <option value="4">Quadruple (4x)</option>
-                <option value="5">Quintuple (5x)</option>
-              </select>
-            </div>
-          </div>
-          <div class="modal-actions">
-            <button class="modal-btn cancel" id="cancelLightboard">Cancel</button>
-            <button class="modal-btn confirm" id="confirmLightboard">Apply Settings</button>
-          </div>
-        </div>
-      </div>
-     
-   </div>
-
-<script>
-// WebSocket connection
-const ws=new WebSocket('ws://'+location.hostname+':81');
-const connDot=document.getElementById('connDot');
-
-// WebSocket connection handlers
-ws.onopen = function() {
-  console.log('WebSocket connected');
-  // Send current lightboard settings to ESP32 when connection is established
-  ws.send(JSON.stringify({
-    action: 'lightboardSettings',
-    mode: lightboardGameMode,
-    p2Color: lightboardP2ColorIndex,
-    p3Color: lightboardP3ColorIndex
-  }));
+// The page lives in oldmaster.html; tools/build_oldmaster_ui.js minifies and
+// gzips it into OLDMASTER_UI_GZ (npm run build:oldmaster-ui).
+#include "oldmaster_ui.h"
+
+#if WEB_ASYNC
+AsyncWebServer server(80);
+AsyncWebServer wsServer(81); // the page connects to ws://<host>:81
+AsyncWebSocket ws("/");
+#else
+WebServer server(80);
+WebSocketsServer ws(81);
+
+// Page body goes out in pieces of one TCP segment, servicing the WebSocket in
+// between so a page load doesn't stall the UI that's already connected
+static const size_t UI_CHUNK_BYTES = 1436;
+static const char* UI_REQUEST_HEADERS[] = {"If-None-Match"};
+#endif
+int32_t g_activeWsClient = -1;
+
+// ---- WebSocket wire format ----
+// Binary frames: an opcode byte, then a fixed payload per opcode. The page
+// keeps a copy of these values (OP in oldmaster.html).
+enum UiOp : uint8_t {
+  // page -> master
+  UI_OP_HELLO       = 0x01, // []                      re-send status and winner
+  UI_OP_RESET       = 0x02, // []                      full game reset
+  UI_OP_RESET_QUIZ  = 0x03, // []                      next question, board kept
+  UI_OP_AWARD       = 0x04, // [player, multiplier]
+  UI_OP_LB_MODE     = 0x05, // [mode]
+  UI_OP_LB_SETTINGS = 0x06, // [mode, p2Color, p3Color]
+  // master -> page
+  UI_OP_STATUS      = 0x81, // [UI_STATUS_* bits]
+  UI_OP_WINNER      = 0x82, // [player id, UI_WINNER_NONE or UI_WINNER_TIE]
+  // queued by the server callbacks, never on the wire
+  UI_EVT_CONNECT    = 0xF0,
+  UI_EVT_DISCONNECT = 0xF1,
 };
-
- // Quiz elements
- const quizInterface = document.getElementById('quizInterface');
- const resetAllData = document.getElementById('resetAllData');
- const fileInputSection = document.getElementById('fileInputSection');
- const lightboardModeSection = document.getElementById('lightboardModeSection');
- const loadedFiles = document.getElementById('loadedFiles');
- const fileList = document.getElementById('fileList');
-const categorySelector = document.getElementById('categorySelector');
-const categoryGrid = document.getElementById('categoryGrid');
-const quizDisplay = document.getElementById('quizDisplay');
-const quizTitle = document.getElementById('quizTitle');
-const qEl = document.getElementById('q');
-const aEl = document.getElementById('a');
-const answerText = document.getElementById('answerText');
-const categoryBadge = document.getElementById('categoryBadge');
-const counterEl = document.getElementById('counter');
-const btnPrev = document.getElementById('prev');
-const btnNext = document.getElementById('next');
-const btnToggle = document.getElementById('toggle');
-const btnExit = document.getElementById('exitBtn');
-const card = document.getElementById('card');
-const csvFileInput = document.getElementById('csvFile');
-
- // Modal elements
- const confirmModal = document.getElementById('confirmModal');
- const cancelExit = document.getElementById('cancelExit');
- const confirmExit = document.getElementById('confirmExit');
- const resetModal = document.getElementById('resetModal');
- const cancelReset = document.getElementById('cancelReset');
- const confirmReset = document.getElementById('confirmReset');
- const lightboardModal = document.getElementById('lightboardModal');
- const lightboardSettingsBtn = document.getElementById('lightboardSettingsBtn');
- const cancelLightboard = document.getElementById('cancelLightboard');
- const confirmLightboard = document.getElementById('confirmLightboard');
-
-// Game status elements in quiz mode
-const gameStatus = document.getElementById('gameStatus');
-const player2Tile = document.getElementById('player2Tile');
-const player3Tile = document.getElementById('player3Tile');
-const player2Name = document.querySelector('#player2Tile .player-name');
-const player3Name = document.querySelector('#player3Tile .player-name');
-const player2ScoreEl = document.getElementById('player2Score');
-const player3ScoreEl = document.getElementById('player3Score');
-
-// Lightboard elements (moved to modal)
-let lightboardGameMode = 1; // Default to Territory mode
-let lightboardP2ColorIndex = 0; // Red
-let lightboardP3ColorIndex = 1; // Blue
-let damageMultiplier = 3; // Default to triple damage
-
-// Quiz state
-let QA = [];
-let order = [];
-let idx = 0;
-let availableCategories = [];
-
-// Player names with persistence
-let player2NameText = 'Player 2';
-let player3NameText = 'Player 3';
-
-// Quiz state persistence
-let currentCategory = null;
-let currentQuestionIndex = 0;
-let savedOrder = null; // Store the shuffled order to restore exactly
-
-// Scoring system
-let player2Score = 0;
-let player3Score = 0;
-let roundComplete = false;
-
-// Sample quiz data (you can replace this with your CSV data)
-const sampleQuestions = [
-  { q: "What is the capital of France?", a: "Paris", category: "Geography" },
-  { q: "What is 2 + 2?", a: "4", category: "Math" },
-  { q: "What is the largest planet in our solar system?", a: "Jupiter", category: "Science" },
-  { q: "Who wrote Romeo and Juliet?", a: "William Shakespeare", category: "Literature" },
-  { q: "What is the chemical symbol for gold?", a: "Au", category: "Science" },
-  { q: "What year did World War II end?", a: "1945", category: "History" },
-  { q: "What is the main component of the sun?", a: "Hydrogen", category: "Science" },
-  { q: "What is the largest ocean on Earth?", a: "Pacific Ocean", category: "Geography" },
-  { q: "What is the square root of 144?", a: "12", category: "Math" },
-  { q: "Who painted the Mona Lisa?", a: "Leonardo da Vinci", category: "Art" }
-];
-
-// Load data from localStorage
-function loadPersistedData() {
-  try {
-    // Load player names
-    const savedPlayer2Name = localStorage.getItem('player2Name');
-    const savedPlayer3Name = localStorage.getItem('player3Name');
-    if (savedPlayer2Name) player2NameText = savedPlayer2Name;
-    if (savedPlayer3Name) player3NameText = savedPlayer3Name;
-    
-    // Load scores
-    const savedPlayer2Score = localStorage.getItem('player2Score');
-    const savedPlayer3Score = localStorage.getItem('player3Score');
-    if (savedPlayer2Score) player2Score = parseInt(savedPlayer2Score);
-    if (savedPlayer3Score) player3Score = parseInt(savedPlayer3Score);
-    
-    // Update player name displays
-    player2Name.textContent = player2NameText;
-    player3Name.textContent = player3NameText;
-    updateScoreDisplay();
-    
-    // Load categories from localStorage
-    const savedCategories = localStorage.getItem('quizCategories');
-    if (savedCategories) {
-      availableCategories = JSON.parse(savedCategories);
-      if (availableCategories.length > 0) {
-        showCategorySelector();
-        createCategoryButtons(availableCategories);
-        
-        // Load current quiz state
-        const savedCurrentCategory = localStorage.getItem('currentCategory');
-        const savedQuestionIndex = localStorage.getItem('currentQuestionIndex');
-        const savedOrderData = localStorage.getItem('savedOrder');
-        
-        if (savedCurrentCategory && savedQuestionIndex !== null) {
-          currentCategory = savedCurrentCategory;
-          currentQuestionIndex = parseInt(savedQuestionIndex);
-          
-          // Restore the saved order if available
-          if (savedOrderData) {
-            try {
-              savedOrder = JSON.parse(savedOrderData);
-            } catch (error) {
-              console.error('Error parsing saved order:', error);
-              savedOrder = null;
-            }
-          }
-          
-          // Restore the quiz to where you left off
-          restoreQuizState();
-        }
-        
-        return; // Don't show sample questions if we have saved categories
-      }
-    }
-  } catch (error) {
-    console.error('Error loading persisted data:', error);
-  }
-  
-  // Fallback to sample questions if no saved data
-  availableCategories = [{
-    filename: 'sample.csv',
-    name: 'Sample Questions',
-    questions: sampleQuestions
-  }];
-  showCategorySelector();
-  createCategoryButtons(availableCategories);
-}
-
-// Save data to localStorage with deferred execution for better performance
-function savePersistedData() {
-  const saveData = () => {
-    try {
-      // Save player names
-      localStorage.setItem('player2Name', player2NameText);
-      localStorage.setItem('player3Name', player3NameText);
-      
-      // Save scores
-      localStorage.setItem('player2Score', player2Score.toString());
-      localStorage.setItem('player3Score', player3Score.toString());
-      
-      // Save categories
-      localStorage.setItem('quizCategories', JSON.stringify(availableCategories));
-      
-      // Save current quiz state
-      if (currentCategory) {
-        localStorage.setItem('currentCategory', currentCategory);
-        localStorage.setItem('currentQuestionIndex', currentQuestionIndex.toString());
-        // Save the current question order to restore exactly
-        if (order.length > 0) {
-          localStorage.setItem('savedOrder', JSON.stringify(order));
-        }
-      }
-    } catch (error) {
-      console.error('Error saving persisted data:', error);
-    }
-  };
-
-  // Use requestIdleCallback for better performance if available
-  if (window.requestIdleCallback) {
-    requestIdleCallback(saveData);
-  } else {
-    // Fallback for browsers that don't support requestIdleCallback
-    setTimeout(saveData, 0);
-  }
-}
-
-// Initialize quiz
-function initQuiz() {
-  loadPersistedData();
-  loadLightboardSettings();
-}
-
-function setOrder(randomize) {
-  order = [...Array(QA.length).keys()];
-  if (randomize) shuffle(order);
-  idx = 0;
-}
-
-function shuffle(arr) {
-  for (let i = arr.length - 1; i > 0; i--) {
-    const j = Math.floor(Math.random() * (i + 1));
-    [arr[i], arr[j]] = [arr[j], arr[i]];
-  }
-  return arr;
-}
-
-function render(hideAnswer = true) {
-  if (QA.length === 0) return;
-  
-  const qa = QA[order[idx]];
-  
-  // Batch DOM updates for better performance
-  const updates = [
-    { element: qEl, property: 'textContent', value: qa.q },
-    { element: answerText, property: 'textContent', value: qa.a },
-    { element: counterEl, property: 'textContent', value: `${idx+1} / ${QA.length}` }
-  ];
-  
-  // Apply all updates at once
-  updates.forEach(update => {
-    if (update.element && update.property && update.value !== undefined) {
-      update.element[update.property] = update.value;
-    }
-  });
-  
-  // Handle answer visibility efficiently
-  if (hideAnswer) {
-    aEl.classList.remove('show');
-    btnToggle.textContent = 'Show Answer';
-  }
-  
-  // Handle category badge efficiently
-  if (qa.category) {
-    categoryBadge.textContent = qa.category;
-    categoryBadge.classList.remove('hidden');
-  } else {
-    categoryBadge.classList.add('hidden');
-  }
-}
-
-// Consolidated navigation function
-function navigate(direction) {
-  if (direction === 'next') {
-    idx = idx < order.length - 1 ? idx + 1 : 0;
-  } else {
-    idx = idx > 0 ? idx - 1 : order.length - 1;
-  }
-  
-  render();
-  currentQuestionIndex = idx;
-  savePersistedData();
-  
-  // Reset game state for quiz navigation (doesn't reset lightboard)
-  ws.send(JSON.stringify({action: 'reset', quizNav: true}));
-  hideWinner();
-  aEl.classList.remove('show');
-  btnToggle.textContent = 'Show Answer';
-}
-
-function next() {
-  navigate('next');
-}
-
-function prev() {
-  navigate('prev');
-}
-
-function toggleAnswer() {
-  aEl.classList.toggle('show');
-  btnToggle.textContent = aEl.classList.contains('show') ? 'Hide Answer' : 'Show Answer';
-}
-
-// Initialize quiz mode status
-function initQuizMode() {
-  // Reset player tiles to default state
-  player2Tile.classList.remove('winner');
-  player3Tile.classList.remove('winner');
-  updateScoreDisplay();
-}
-
-// Update score display
-function updateScoreDisplay() {
-  player2ScoreEl.textContent = player2Score;
-  player3ScoreEl.textContent = player3Score;
-}
-
-// Add scorable state to player tiles
-function addScorableState() {
-  // Only add scorable class if the tile is not already a winner
-  if (!player2Tile.classList.contains('winner')) {
-    player2Tile.classList.add('scorable');
-  }
-  if (!player3Tile.classList.contains('winner')) {
-    player3Tile.classList.add('scorable');
-  }
-  roundComplete = true;
-}
-
-// Remove scorable state from player tiles
-function removeScorableState() {
-  player2Tile.classList.remove('scorable');
-  player3Tile.classList.remove('scorable');
-  roundComplete = false;
-}
-
-// Award point to player
-function awardPoint(player) {
-  if (!roundComplete) return;
-  
-  // Update score based on damage multiplier
-  if (player === 'Player 2') {
-    player2Score += damageMultiplier;
-    // Send message to ESP32 to award points to Player 2
-    ws.send(JSON.stringify({action: 'awardPoint', player: 2, multiplier: damageMultiplier}));
-  } else if (player === 'Player 3') {
-    player3Score += damageMultiplier;
-    // Send message to ESP32 to award points to Player 3
-    ws.send(JSON.stringify({action: 'awardPoint', player: 3, multiplier: damageMultiplier}));
-  }
-  
-  updateScoreDisplay();
-  savePersistedData();
-  
-  // Reset game and advance to next question
-  removeScorableState();
-  hideWinner();
-  aEl.classList.remove('show');
-  btnToggle.textContent = 'Show Answer';
-  // Add a small delay before advancing to next question to prevent flashing
-  setTimeout(() => {
-    next();
-  }, 120);
-}
-
-// Quiz event listeners
-btnNext.addEventListener('click', next);
-btnPrev.addEventListener('click', prev);
-btnToggle.addEventListener('click', toggleAnswer);
-btnExit.addEventListener('click', showExitConfirmation);
-
-// Consolidated scoring event listener
-function handlePlayerClick(player) {
-  return function(e) {
-    if (roundComplete && !isEditingName) {
-      e.preventDefault();
-      e.stopPropagation();
-      awardPoint(player);
-    }
-  };
-}
-
-player2Tile.addEventListener('click', handlePlayerClick('Player 2'));
-player3Tile.addEventListener('click', handlePlayerClick('Player 3'));
-
-// Secret long-press functionality for mobile
-let pressTimer;
-let isLongPress = false;
-
-card.addEventListener('touchstart', function(e) {
-  isLongPress = false;
-  pressTimer = setTimeout(() => {
-    isLongPress = true;
-    toggleAnswer();
-  }, 800); // 800ms long press
-});
-
-card.addEventListener('touchend', function(e) {
-  clearTimeout(pressTimer);
-});
-
-card.addEventListener('touchmove', function(e) {
-  clearTimeout(pressTimer);
-});
-
-// Regular click for desktop
-card.addEventListener('click', function(e) {
-  if (!isLongPress) {
-    toggleAnswer();
-  }
-});
-
-// Keyboard shortcuts
-window.addEventListener('keydown', (e) => {
-  if (e.key === 'ArrowRight') { e.preventDefault(); next(); }
-  else if (e.key === 'ArrowLeft') { e.preventDefault(); prev(); }
-  else if (e.key === ' ' || e.code === 'Space') { e.preventDefault(); toggleAnswer(); }
-});
-
-// Game functions
-function showWinner(player) {
-  // Remove winner class from all tiles
-  player2Tile.classList.remove('winner');
-  player3Tile.classList.remove('winner');
-  
-  // Add winner class to the winning player's tile
-  if (player === 'Player 2') {
-    player2Tile.classList.add('winner');
-  } else if (player === 'Player 3') {
-    player3Tile.classList.add('winner');
-  }
-  
-  // Enable scoring immediately
-  addScorableState();
-}
-
-function hideWinner() {
-  player2Tile.classList.remove('winner');
-  player3Tile.classList.remove('winner');
-  removeScorableState();
-}
-
-function resetGame() {
-  ws.send(JSON.stringify({action:'reset'}));
-  hideWinner();
-}
-
-function showExitConfirmation() {
-  confirmModal.classList.remove('hidden');
-}
-
-function hideExitConfirmation() {
-  confirmModal.classList.add('hidden');
-}
-
-function exitToCategories() {
-  // Reset game state
-  hideWinner();
-  aEl.classList.remove('show');
-  btnToggle.textContent = 'Show Answer';
-  
-  // Clear current quiz state
-  currentCategory = null;
-  currentQuestionIndex = 0;
-  savedOrder = null;
-  localStorage.removeItem('currentCategory');
-  localStorage.removeItem('currentQuestionIndex');
-  localStorage.removeItem('savedOrder');
-  
-  // Reset scores
-  player2Score = 0;
-  player3Score = 0;
-  roundComplete = false;
-  localStorage.removeItem('player2Score');
-  localStorage.removeItem('player3Score');
-  updateScoreDisplay();
-  removeScorableState();
-  
-  // Hide modal
-  hideExitConfirmation();
-  
-  // Reset lightboard when exiting quiz
-  ws.send(JSON.stringify({action: 'reset'}));
-  
-  // Return to category selector
-  showCategorySelector();
-}
-
-// WebSocket event handling
-ws.onmessage=e=>{
-  const d=JSON.parse(e.data);
-  if(d.connected!==undefined){
-    if(d.connected){
-      connDot.className='ok';
-    }else{
-      connDot.className='bad';
-      hideWinner();
-    }
-  }
-  if(d.lightboardConnected!==undefined){
-    // Update lightboard connection status in UI if needed
-    console.log('Lightboard connected:', d.lightboardConnected);
-  }
-     if(d.winner!==undefined){
-     if(d.winner&&d.winner!=='none'){
-       showWinner(d.winner);
-       // Automatically reveal answer when someone wins
-       aEl.classList.add('show');
-       btnToggle.textContent = 'Hide Answer';
-     }else{
-       hideWinner();
-       // Hide answer when game resets
-       aEl.classList.remove('show');
-       btnToggle.textContent = 'Show Answer';
-     }
-   }
-  // Handle toolboard controls for quiz
-  if(d.quizAction){
-    switch(d.quizAction) {
-      case 'next': next(); break;
-      case 'prev': prev(); break;
-      case 'toggle': toggleAnswer(); break;
-    }
-  }
+enum : uint8_t {
+  UI_STATUS_P2      = 1 << 0,
+  UI_STATUS_P3      = 1 << 1,
+  UI_STATUS_LB      = 1 << 2,
+  UI_STATUS_P2_SYNC = 1 << 3,
+  UI_STATUS_P3_SYNC = 1 << 4,
 };
+static const uint8_t UI_WINNER_NONE = 0;
+static const uint8_t UI_WINNER_TIE = 0xFF;
+
+// Frames are queued by the server callbacks and run from loop(), so game state
+// is only ever touched from loop() whichever web stack is built
+struct UiCommand {
+  uint32_t client;
+  uint8_t  len;
+  uint8_t  data[4]; // opcode + payload
+};
+static const int UI_QUEUE_LEN = 8;
+QueueHandle_t uiQueue = nullptr;
+uint32_t uiQueueDrops = 0;
 
-// === CSV PARSER ===
-function parseCSV(csv) {
-  const lines = csv.split('\n');
-  const headers = lines[0].split(',').map(h => h.replace(/"/g, ''));
-  const data = [];
-  
-  for (let i = 1; i < lines.length; i++) {
-    if (lines[i].trim() === '') continue;
-    
-    const values = [];
-    let current = '';
-    let inQuotes = false;
-    
-    for (let j = 0; j < lines[i].length; j++) {
-      const char = lines[i][j];
-      
-      if (char === '"') {
-        inQuotes = !inQuotes;
-      } else if (char === ',' && !inQuotes) {
-        values.push(current.trim());
-        current = '';
-      } else {
-        current += char;
-      }
-    }
-    values.push(current.trim());
-    
-    const row = {};
-    headers.forEach((header, index) => {
-      row[header] = values[index] ? values[index].replace(/^"|"$/g, '') : '';
-    });
-    data.push(row);
-  }
-  
-  return data;
-}
-
-   // === RESET FUNCTIONALITY ===
-  resetAllData.addEventListener('click', showResetConfirmation);
-  
-  function showResetConfirmation() {
-    resetModal.classList.remove('hidden');
-  }
-  
-  function hideResetConfirmation() {
-    resetModal.classList.add('hidden');
-  }
-
-  // Lightboard modal functions
-  function showLightboardSettings() {
-    // Load current settings from localStorage first
-    loadLightboardSettings();
-    
-    // Set current values in modal
-    document.getElementById('lightboardMode').value = lightboardGameMode;
-    document.getElementById('lightboardP2Color').value = lightboardP2ColorIndex;
-    document.getElementById('lightboardP3Color').value = lightboardP3ColorIndex;
-    document.getElementById('damageMultiplier').value = damageMultiplier;
-    lightboardModal.classList.remove('hidden');
-  }
-
-  function hideLightboardSettings() {
-    lightboardModal.classList.add('hidden');
-  }
-
-  function applyLightboardSettings() {
-    const newMode = parseInt(document.getElementById('lightboardMode').value);
-    const newP2Color = parseInt(document.getElementById('lightboardP2Color').value);
-    const newP3Color = parseInt(document.getElementById('lightboardP3Color').value);
-    const newMultiplier = parseInt(document.getElementById('damageMultiplier').value);
-    
-    // Update local variables
-    lightboardGameMode = newMode;
-    lightboardP2ColorIndex = newP2Color;
-    lightboardP3ColorIndex = newP3Color;
-    damageMultiplier = newMultiplier;
-    
-    // Save settings to localStorage
-    saveLightboardSettings();
-    
-    // Send settings to server
-    ws.send(JSON.stringify({
-      action: 'lightboardSettings',
-      mode: newMode,
-      p2Color: newP2Color,
-      p3Color: newP3Color
-    }));
-    
-    hideLightboardSettings();
-  }
-
-  function saveLightboardSettings() {
-    localStorage.setItem('lightboardGameMode', lightboardGameMode.toString());
-    localStorage.setItem('lightboardP2ColorIndex', lightboardP2ColorIndex.toString());
-    localStorage.setItem('lightboardP3ColorIndex', lightboardP3ColorIndex.toString());
-    localStorage.setItem('damageMultiplier', damageMultiplier.toString());
-  }
-
-  function loadLightboardSettings() {
-    const savedMode = localStorage.getItem('lightboardGameMode');
-    const savedP2Color = localStorage.getItem('lightboardP2ColorIndex');
-    const savedP3Color = localStorage.getItem('lightboardP3ColorIndex');
-    const savedMultiplier = localStorage.getItem('damageMultiplier');
-    
-    if (savedMode !== null) {
-      lightboardGameMode = parseInt(savedMode);
-    }
-    if (savedP2Color !== null) {
-      lightboardP2ColorIndex = parseInt(savedP2Color);
-    }
-    if (savedP3Color !== null) {
-      lightboardP3ColorIndex = parseInt(savedP3Color);
-    }
-    if (savedMultiplier !== null) {
-      damageMultiplier = parseInt(savedMultiplier);
-    }
-  }
-  
-  function resetAllDataFunction() {
-  // Clear all localStorage data
-  localStorage.clear();
-  
-  // Reset all variables to default state
-  availableCategories = [];
-  player2Score = 0;
-  player3Score = 0;
-  player2NameText = 'Player 2';
-  player3NameText = 'Player 3';
-  currentCategory = null;
-  currentQuestionIndex = 0;
-  savedOrder = null;
-  QA = [];
-  order = [];
-  idx = 0;
-  roundComplete = false;
-  
-  // Reset lightboard settings to defaults
-  lightboardGameMode = 1;
-  lightboardP2ColorIndex = 0;
-  lightboardP3ColorIndex = 1;
-  damageMultiplier = 3;
-  
-  // Update UI
-  player2Name.textContent = player2NameText;
-  player3Name.textContent = player3NameText;
-  updateScoreDisplay();
-  removeScorableState();
-  
-  // Clear file list
-  fileList.innerHTML = '';
-  loadedFiles.classList.add('hidden');
-  
-  // Reset lightboard when resetting all data
-  ws.send(JSON.stringify({action: 'reset'}));
-  
-  // Show sample questions
-  availableCategories = [{
-    filename: 'sample.csv',
-    name: 'Sample Questions',
-    questions: sampleQuestions
-  }];
-  showCategorySelector();
-  createCategoryButtons(availableCategories);
-  
-  // Hide modal
-  hideResetConfirmation();
-}
- 
- // === FILE HANDLING ===
- csvFileInput.addEventListener('change', handleFileSelect);
-
-function handleFileSelect(event) {
-  const files = event.target.files;
-  if (files.length === 0) return;
-
-  // Clear previous categories
-  availableCategories = [];
-  fileList.innerHTML = '';
-  
-  let loadedCount = 0;
-  const totalFiles = files.length;
-
-  // Helper function to finish loading
-  const finishLoading = () => {
-    if (availableCategories.length > 0) {
-      showCategorySelector();
-      createCategoryButtons(availableCategories);
-      savePersistedData();
-    }
-  };
-
-  // Helper function to process file
-  const processFile = (file) => {
-    if (file.type === 'text/csv' || file.name.endsWith('.csv')) {
-      const reader = new FileReader();
-      
-      reader.onload = function(e) {
-        try {
-          const csvText = e.target.result;
-          const csvData = parseCSV(csvText);
-          
-          // Convert CSV data to the expected format
-          const categoryName = file.name.replace('.csv', '').replace(/_/g, ' ').replace(/\b\w/g, l => l.toUpperCase());
-          const questions = csvData.map(row => {
-            const question = row.Question || row.question || row.Q || row.q || Object.values(row)[0];
-            const answer = row.Answer || row.answer || row.A || row.a || Object.values(row)[1];
-            // Use the filename as the category name for all questions in this file
-            const category = row.Category || row.category || row.Cat || row.cat || categoryName;
-            return { q: question, a: answer, category: category };
-          }).filter(qa => qa.q && qa.a);
-          
-          if (questions.length > 0) {
-            const categoryName = file.name.replace('.csv', '').replace(/_/g, ' ').replace(/\b\w/g, l => l.toUpperCase());
-            availableCategories.push({
-              filename: file.name,
-              name: categoryName,
-              questions: questions
-            });
-            
-            addFileToList(file.name, `${questions.length} questions`, 'success');
-          } else {
-            addFileToList(file.name, 'No questions', 'error');
-          }
-        } catch (error) {
-          console.error('Error parsing CSV:', error);
-          addFileToList(file.name, 'Error', 'error');
-        }
-        
-        loadedCount++;
-        if (loadedCount === totalFiles) finishLoading();
-      };
-      
-      reader.onerror = function() {
-        addFileToList(file.name, 'Read failed', 'error');
-        loadedCount++;
-        if (loadedCount === totalFiles) finishLoading();
-      };
-      
-      reader.readAsText(file);
-    } else {
-      addFileToList(file.name, 'Not CSV', 'error');
-      loadedCount++;
-      if (loadedCount === totalFiles) finishLoading();
-    }
-  };
-  
-  Array.from(files).forEach(processFile);
-  loadedFiles.classList.remove('hidden');
-}
-
-function addFileToList(filename, message, status) {
-  const li = document.createElement('li');
-  li.className = status;
-  li.innerHTML = `${filename.replace('.csv', '')}: ${message}`;
-  fileList.appendChild(li);
-}
-
-// === CATEGORY SELECTION ===
-function showCategorySelector() {
-  categorySelector.classList.remove('hidden');
-  quizDisplay.classList.add('hidden');
-  fileInputSection.classList.remove('hidden');
-  resetAllData.parentElement.classList.remove('hidden');
-  lightboardModeSection.classList.remove('hidden');
-}
-
- function showQuizDisplay() {
-   categorySelector.classList.add('hidden');
-   quizDisplay.classList.remove('hidden');
-   fileInputSection.classList.add('hidden');
-   resetAllData.parentElement.classList.add('hidden');
-   lightboardModeSection.classList.add('hidden');
- }
-
-function createCategoryButtons(categories) {
-  if (categories.length === 0) {
-    categoryGrid.innerHTML = `
-      <div class="category-btn" style="grid-column: 1 / -1; color: var(--muted);">
-        No valid CSV files loaded. Please select CSV files with Question,Answer format.
-      </div>
-    `;
-    return;
-  }
-
-  // Add "Combine All" button if there are multiple categories
-  let buttonsHTML = '';
-  if (categories.length > 1) {
-    const totalQuestions = categories.reduce((sum, cat) => sum + cat.questions.length, 0);
-    buttonsHTML += `
-      <div class="category-btn combine-all" style="grid-column: 1 / -1; background: linear-gradient(180deg, rgba(155,225,255,.25), rgba(155,225,255,.15)); border-color: var(--accent-2);">
-        <div style="font-size: 18px; margin-bottom: 4px;">🎯 Combine All Categories</div>
-        <div style="font-size: 12px; color: var(--muted);">${totalQuestions} total questions from ${categories.length} categories</div>
-      </div>
-    `;
-  }
-
-  // Add individual category buttons
-  buttonsHTML += categories.map(category => `
-    <div class="category-btn" data-filename="${category.filename}">
-      <div style="font-size: 18px; margin-bottom: 4px;">${category.name}</div>
-      <div style="font-size: 12px; color: var(--muted);">${category.questions.length} questions</div>
-    </div>
-  `).join('');
-
-  categoryGrid.innerHTML = buttonsHTML;
-
-  // Add click handlers
-  categoryGrid.querySelectorAll('.category-btn').forEach(btn => {
-    btn.addEventListener('click', () => {
-      if (btn.classList.contains('combine-all')) {
-        loadCombinedCategories(categories);
-      } else {
-        const filename = btn.dataset.filename;
-        loadCategory(filename);
-      }
-    });
-  });
-}
-
-// Consolidated category loading function
-function loadCategoryData(categoryData, isCombined = false) {
-  if (isCombined) {
-    // Combine all questions from all categories
-    QA = [];
-    const categoryNames = [];
-    
-    categoryData.forEach(category => {
-      const questionsWithCategory = category.questions.map(qa => ({
-        ...qa,
-        category: category.name
-      }));
-      QA = QA.concat(questionsWithCategory);
-      categoryNames.push(category.name);
-    });
-    
-    quizTitle.textContent = `Mixed: ${categoryNames.join(', ')}`;
-    currentCategory = 'combined';
-  } else {
-    QA = categoryData.questions;
-    quizTitle.textContent = categoryData.name;
-    currentCategory = categoryData.filename;
-  }
-  
-  currentQuestionIndex = 0;
-  showQuizDisplay();
-  setOrder(true);
-  render(true);
-  savePersistedData();
-}
-
-function loadCategory(filename) {
-  const category = availableCategories.find(cat => cat.filename === filename);
-  if (!category) {
-    alert('Category not found');
-    return;
-  }
-  loadCategoryData(category);
-}
-
-function loadCombinedCategories(categories) {
-  loadCategoryData(categories, true);
-}
-
-// Player name editing functionality
-let nameEditTimer;
-let isEditingName = false;
-
-function setupPlayerNameEditing() {
-  // Use double-tap for mobile editing (more reliable than long press)
-  let lastTap = 0;
-  let tapTimer;
-  
-  // Player 2 name editing
-  player2Name.addEventListener('touchend', function(e) {
-    if (roundComplete) return; // Don't allow editing during scoring phase
-    
-    const currentTime = new Date().getTime();
-    const tapLength = currentTime - lastTap;
-    
-    if (tapLength < 500 && tapLength > 0) {
-      // Double tap detected
-      e.preventDefault();
-      startEditingName(player2Name, 'Player 2');
-    } else {
-      // Single tap - wait for potential double tap
-      tapTimer = setTimeout(() => {
-        // Single tap confirmed
-      }, 500);
-    }
-    lastTap = currentTime;
-  });
-
-  // Player 3 name editing
-  let lastTap3 = 0;
-  let tapTimer3;
-  
-  player3Name.addEventListener('touchend', function(e) {
-    if (roundComplete) return; // Don't allow editing during scoring phase
-    
-    const currentTime = new Date().getTime();
-    const tapLength = currentTime - lastTap3;
-    
-    if (tapLength < 500 && tapLength > 0) {
-      // Double tap detected
-      e.preventDefault();
-      startEditingName(player3Name, 'Player 3');
-    } else {
-      // Single tap - wait for potential double tap
-      tapTimer3 = setTimeout(() => {
-        // Single tap confirmed
-      }, 500);
-    }
-    lastTap3 = currentTime;
-  });
-
-  // Desktop double-click for editing
-  player2Name.addEventListener('dblclick', function(e) {
-    if (roundComplete) return; // Don't allow editing during scoring phase
-    e.preventDefault();
-    startEditingName(player2Name, 'Player 2');
-  });
-
-  player3Name.addEventListener('dblclick', function(e) {
-    if (roundComplete) return; // Don't allow editing during scoring phase
-    e.preventDefault();
-    startEditingName(player3Name, 'Player 3');
-  });
-}
-
-function startEditingName(nameElement, defaultName) {
-  if (isEditingName) return;
-  
-  isEditingName = true;
-  nameElement.classList.add('editing');
-  
-  const currentName = nameElement.textContent;
-  const input = document.createElement('input');
-  input.type = 'text';
-  input.value = currentName;
-     input.style.cssText = `
-     background: transparent;
-     border: none;
-     color: var(--ink);
-     font-weight: 600;
-     font-size: 16px;
-     text-align: center;
-     width: 100%;
-     outline: none;
-     font-family: inherit;
-     -webkit-user-select: text;
-     user-select: text;
-     margin: 0;
-     padding: 0;
-     box-sizing: border-box;
-   `;
-  
-  // Clear any existing content and add the input
-  nameElement.innerHTML = '';
-  nameElement.appendChild(input);
-  
-  // Force focus and selection on mobile
-  setTimeout(() => {
-    input.focus();
-    input.select();
-    // Force keyboard to appear on mobile
-    input.click();
-  }, 100);
-  
-     function finishEditing() {
-     const newName = input.value.trim() || defaultName;
-     nameElement.textContent = newName;
-     nameElement.classList.remove('editing');
-     isEditingName = false;
-     
-     // Update stored names and save
-     if (nameElement === player2Name) {
-       player2NameText = newName;
-     } else if (nameElement === player3Name) {
-       player3NameText = newName;
-     }
-     savePersistedData();
-   }
-  
-  input.addEventListener('blur', finishEditing);
-     input.addEventListener('keydown', function(e) {
-     if (e.key === 'Enter') {
-       finishEditing();
-     } else if (e.key === 'Escape') {
-       // Restore original name without saving
-       nameElement.textContent = currentName;
-       nameElement.classList.remove('editing');
-       isEditingName = false;
-     }
-   });
-  
-  // Handle mobile keyboard "Done" button
-  input.addEventListener('input', function(e) {
-    // This ensures the input is properly handled on mobile
-  });
-}
-
- // Modal event listeners
- cancelExit.addEventListener('click', hideExitConfirmation);
- confirmExit.addEventListener('click', exitToCategories);
- cancelReset.addEventListener('click', hideResetConfirmation);
- confirmReset.addEventListener('click', resetAllDataFunction);
- lightboardSettingsBtn.addEventListener('click', showLightboardSettings);
- cancelLightboard.addEventListener('click', hideLightboardSettings);
- confirmLightboard.addEventListener('click', applyLightboardSettings);
- 
- // Close modals when clicking overlay
- confirmModal.addEventListener('click', function(e) {
-   if (e.target === confirmModal) {
-     hideExitConfirmation();
-   }
- });
- 
- resetModal.addEventListener('click', function(e) {
-   if (e.target === resetModal) {
-     hideResetConfirmation();
-   }
- });
-
- lightboardModal.addEventListener('click', function(e) {
-   if (e.target === lightboardModal) {
-     hideLightboardSettings();
-   }
- });
- 
- // Close modals with Escape key
- document.addEventListener('keydown', function(e) {
-   if (e.key === 'Escape') {
-     if (!confirmModal.classList.contains('hidden')) {
-       hideExitConfirmation();
-     } else if (!resetModal.classList.contains('hidden')) {
-       hideResetConfirmation();
-     } else if (!lightboardModal.classList.contains('hidden')) {
-       hideLightboardSettings();
-     }
-   }
- });
-
-// Restore quiz state to where you left off
-function restoreQuizState() {
-  const restoreOrder = () => {
-    if (savedOrder && savedOrder.length === QA.length) {
-      order = [...savedOrder];
-      idx = currentQuestionIndex;
-    } else {
-      setOrder(true);
-      idx = currentQuestionIndex;
-    }
-    render(true);
-  };
-
-  if (currentCategory === 'combined') {
-    // Restore combined categories
-    QA = [];
-    const categoryNames = [];
-    
-    availableCategories.forEach(category => {
-      const questionsWithCategory = category.questions.map(qa => ({
-        ...qa,
-        category: category.name
-      }));
-      QA = QA.concat(questionsWithCategory);
-      categoryNames.push(category.name);
-    });
-
-    quizTitle.textContent = `Mixed: ${categoryNames.join(', ')}`;
-    showQuizDisplay();
-    restoreOrder();
-  } else {
-    // Restore specific category
-    const category = availableCategories.find(cat => cat.filename === currentCategory);
-    if (category) {
-      QA = category.questions;
-      quizTitle.textContent = category.name;
-      showQuizDisplay();
-      restoreOrder();
-    }
-  }
-}
-
-// Lightboard mode change handler (removed - now handled by modal)
-
-// Initialize quiz on load
-document.addEventListener('DOMContentLoaded', function() {
-  initQuiz();
-  initQuizMode();
-  setupPlayerNameEditing();
-});
-</script>
-</body></html>
-)HTML";
+// What the page was last told; loop() pushes only when these change
+int16_t uiLastStatus = -1;
+int16_t uiLastWinner = -1;
 
 // (Local TDoA solver and ISR code removed - host-only)
 
@@ -2026,8 +249,6 @@ void OnDataRecv(const esp_now_recv_info_t *info, const uint8_t *data, int len) {
       if (gameActive) {
         winner = "Player 2";
         gameActive = false;
-        String j = "{\"winner\":\"" + winner + "\"}";
-        ws.broadcastTXT(j);
         Serial.println("Winner declared: Player 2");
       }
     } else if (player2Data.action == 3) {
@@ -2083,8 +304,6 @@ void OnDataRecv(const esp_now_recv_info_t *info, const uint8_t *data, int len) {
       if (gameActive) {
         winner = "Player 3";
         gameActive = false;
-        String j = "{\"winner\":\"" + winner + "\"}";
-        ws.broadcastTXT(j);
         Serial.println("Winner declared: Player 3");
       }
     } else if (player2Data.action == 3) {
@@ -2210,10 +429,6 @@ void awardPointToPlayer(uint8_t playerId) {
     player3HitTime = micros(); // Use current time as hit time
   }
   
-  // Broadcast winner to web interface
-  String j = "{\"winner\":\"" + winner + "\"}";
-  ws.broadcastTXT(j);
-  
   // Update lightboard game state
   updateLightboardGameState();
   
@@ -2255,10 +470,6 @@ void awardMultiplePointsToPlayer(uint8_t playerId, int multiplier) {
     player3HitTime = micros(); // Use current time as hit time
   }
   
-  // Broadcast winner to web interface
-  String j = "{\"winner\":\"" + winner + "\"}";
-  ws.broadcastTXT(j);
-  
   // Update lightboard game state
   updateLightboardGameState();
   
@@ -2286,10 +497,6 @@ void determineWinner() {
       Serial.printf("It's a tie! Time diff: %ld us\n", timeDiff);
     }
     
-    // Broadcast winner to web interface
-    String j = "{\"winner\":\"" + winner + "\"}";
-    ws.broadcastTXT(j);
-    
     // Update lightboard
     updateLightboardGameState();
   }
@@ -2322,10 +529,6 @@ void resetGame() {
   // Send reset to lightboard
   sendLightboardUpdate(5); // reset action
   
-  // Broadcast reset to web interface
-  String j = "{\"winner\":\"none\"}";
-  ws.broadcastTXT(j);
-  
   Serial.println("Game reset");
 }
 
@@ -2337,10 +540,6 @@ void resetGameForQuiz() {
   player3HitTime = 0;
   gameActive = true;
   
-  // Broadcast reset to web interface
-  String j = "{\"winner\":\"none\"}";
-  ws.broadcastTXT(j);
-  
   Serial.println("Game reset for quiz navigation");
 }
 
@@ -2364,100 +563,224 @@ void syncClock() {
 }
 
 // ===================== Web handler =====================
-void handleRoot(){ server.send(200,"text/html",HTML); }
+#if WEB_ASYNC
+void handleRoot(AsyncWebServerRequest *request) {
+  // no-cache = revalidate every load; the ETag changes whenever the page is rebuilt
+  if (request->hasHeader("If-None-Match") &&
+      request->header("If-None-Match") == OLDMASTER_UI_ETAG) {
+    AsyncWebServerResponse *response = request->beginResponse(304);
+    response->addHeader("ETag", OLDMASTER_UI_ETAG);
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response);
+    return;
+  }
+  // Streamed from flash by the TCP task as the window opens
+  AsyncWebServerResponse *response =
+      request->beginResponse_P(200, "text/html", OLDMASTER_UI_GZ, OLDMASTER_UI_GZ_LEN);
+  response->addHeader("Content-Encoding", "gzip");
+  response->addHeader("ETag", OLDMASTER_UI_ETAG);
+  response->addHeader("Cache-Control", "no-cache");
+  request->send(response);
+}
+#else
+void handleRoot(){
+  // no-cache = revalidate every load; the ETag changes whenever the page is rebuilt
+  server.sendHeader("ETag", OLDMASTER_UI_ETAG);
+  server.sendHeader("Cache-Control", "no-cache");
+  if (server.header("If-None-Match") == OLDMASTER_UI_ETAG) {
+    server.send(304);
+    return;
+  }
 
-void handleWebSocketEvent(uint8_t num, WStype_t type, uint8_t * payload, size_t length) {
-  String j; // Declare outside switch to avoid scoping issues
-  
-  switch(type) {
-    case WStype_DISCONNECTED:
-      Serial.printf("[%u] Disconnected!\n", num);
-      if ((int32_t)num == g_activeWsClient) {
-        g_activeWsClient = -1;
-      }
-      break;
-    case WStype_CONNECTED:
-      Serial.printf("[%u] Connected!\n", num);
-      // allow only one UI client at a time to conserve resources
-      if (g_activeWsClient >= 0 && g_activeWsClient != (int32_t)num) {
-        ws.disconnect((uint8_t)g_activeWsClient);
-      }
-      g_activeWsClient = (int32_t)num;
-      
-      // Send initial state to new client
-      j = "{";
-      j += "\"connected\":" + String(player2Connected ? "true" : "false") + ",";
-      j += "\"player3Connected\":" + String(player3Connected ? "true" : "false") + ",";
-      j += "\"lightboardConnected\":" + String(lightboardConnected ? "true" : "false") + ",";
-      j += "\"winner\":\"" + winner + "\"";
-      j += "}";
-      ws.sendTXT(num, j);
-      break;
-    case WStype_TEXT:
-      if (length > 0) {
-        String message = String((char*)payload);
-        if (message.indexOf("reset") != -1) {
-          // Check if this is a quiz navigation reset or a full game reset
-          if (message.indexOf("quizNav") != -1) {
-            resetGameForQuiz();
-          } else {
-            resetGame();
-          }
-        } else if (message.indexOf("awardPoint") != -1) {
-          // Handle point award from web interface
-          DynamicJsonDocument doc(1024);
-          deserializeJson(doc, message);
-          if (doc.containsKey("player")) {
-            int player = doc["player"];
-            int multiplier = 1;
-            if (doc.containsKey("multiplier")) {
-              multiplier = doc["multiplier"];
-            }
-            
-            if (player == 2 || player == 3) {
-              // Award multiple points based on multiplier
-              awardMultiplePointsToPlayer(player, multiplier);
-            }
-          }
-        } else if (message.indexOf("lightboardMode") != -1) {
-          // Handle lightboard mode change from web interface
-          DynamicJsonDocument doc(1024);
-          deserializeJson(doc, message);
-          if (doc.containsKey("mode")) {
-            int newMode = doc["mode"];
-            if (newMode >= 1 && newMode <= 6) {
-              lightboardGameMode = newMode;
-              Serial.printf("Lightboard mode changed to: %d\n", newMode);
-              sendLightboardUpdate(4); // mode-change action
-            }
-          }
-        } else if (message.indexOf("lightboardSettings") != -1) {
-          // Handle lightboard settings change from web interface
-          DynamicJsonDocument doc(1024);
-          deserializeJson(doc, message);
-          if (doc.containsKey("mode") && doc.containsKey("p2Color") && doc.containsKey("p3Color")) {
-            int newMode = doc["mode"];
-            int newP2Color = doc["p2Color"];
-            int newP3Color = doc["p3Color"];
-            
-            if (newMode >= 1 && newMode <= 6 && newP2Color >= 0 && newP2Color <= 4 && newP3Color >= 0 && newP3Color <= 4) {
-              lightboardGameMode = newMode;
-              lightboardP2ColorIndex = newP2Color;
-              lightboardP3ColorIndex = newP3Color;
-              Serial.printf("Lightboard settings updated: mode=%d, p2Color=%d, p3Color=%d\n", newMode, newP2Color, newP3Color);
-              sendLightboardUpdate(4); // mode-change action
-            }
-          }
-        } else if (message.indexOf("mode") != -1) {
-          // Handle mode change from web interface
-          // This could be used to switch between quiz and game modes
-          Serial.println("Mode change requested from web interface");
-        }
-      }
-      break;
+  server.sendHeader("Content-Encoding", "gzip");
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN); // chunked
+  server.send(200, "text/html", "");
+  for (size_t off = 0; off < OLDMASTER_UI_GZ_LEN; off += UI_CHUNK_BYTES) {
+    size_t n = min(UI_CHUNK_BYTES, OLDMASTER_UI_GZ_LEN - off);
+    server.sendContent_P((PGM_P)(OLDMASTER_UI_GZ + off), n);
+    ws.loop();
+  }
+  server.sendContent(""); // terminating chunk
+}
+#endif
+
+void uiSend(int32_t client, const uint8_t *frame, size_t len) {
+#if WEB_ASYNC
+  if (client < 0) ws.binaryAll(frame, len);
+  else ws.binary((uint32_t)client, frame, len);
+#else
+  if (client < 0) ws.broadcastBIN(frame, len);
+  else ws.sendBIN((uint8_t)client, frame, len);
+#endif
+}
+
+uint8_t uiStatusFlags() {
+  return (player2Connected ? UI_STATUS_P2 : 0) |
+         (player3Connected ? UI_STATUS_P3 : 0) |
+         (lightboardConnected ? UI_STATUS_LB : 0) |
+         (clockSynced ? UI_STATUS_P2_SYNC : 0) |
+         (player3ClockSynced ? UI_STATUS_P3_SYNC : 0);
+}
+
+uint8_t uiWinnerCode() {
+  if (winner == "Player 2") return 2;
+  if (winner == "Player 3") return 3;
+  if (winner == "Tie") return UI_WINNER_TIE;
+  return UI_WINNER_NONE;
+}
+
+void uiSendStatus(int32_t client) {
+  const uint8_t frame[2] = {UI_OP_STATUS, uiStatusFlags()};
+  uiSend(client, frame, sizeof(frame));
+}
+
+void uiSendWinner(int32_t client) {
+  const uint8_t frame[2] = {UI_OP_WINNER, uiWinnerCode()};
+  uiSend(client, frame, sizeof(frame));
+}
+
+// ---- Page -> master handlers (run from loop()) ----
+void uiOnHello(const UiCommand &c) {
+  uiSendStatus(c.client);
+  uiSendWinner(c.client);
+}
+
+void uiOnReset(const UiCommand &) {
+  resetGame();
+}
+
+void uiOnResetQuiz(const UiCommand &) {
+  resetGameForQuiz();
+}
+
+void uiOnAward(const UiCommand &c) {
+  uint8_t player = c.data[1];
+  if (player == 2 || player == 3) {
+    awardMultiplePointsToPlayer(player, c.data[2]);
+  }
+}
+
+void uiOnLightboardMode(const UiCommand &c) {
+  uint8_t newMode = c.data[1];
+  if (newMode >= 1 && newMode <= 6) {
+    lightboardGameMode = newMode;
+    Serial.printf("Lightboard mode changed to: %d\n", newMode);
+    sendLightboardUpdate(4); // mode-change action
   }
 }
 
+void uiOnLightboardSettings(const UiCommand &c) {
+  uint8_t newMode = c.data[1], newP2Color = c.data[2], newP3Color = c.data[3];
+  if (newMode >= 1 && newMode <= 6 && newP2Color <= 4 && newP3Color <= 4) {
+    lightboardGameMode = newMode;
+    lightboardP2ColorIndex = newP2Color;
+    lightboardP3ColorIndex = newP3Color;
+    Serial.printf("Lightboard settings updated: mode=%d, p2Color=%d, p3Color=%d\n", newMode, newP2Color, newP3Color);
+    sendLightboardUpdate(4); // mode-change action
+  }
+}
+
+// Indexed by opcode; len counts the opcode byte
+struct UiHandler {
+  uint8_t len;
+  void (*fn)(const UiCommand &c);
+};
+static const UiHandler UI_HANDLERS[] = {
+  {0, nullptr},                // 0x00
+  {1, uiOnHello},              // UI_OP_HELLO
+  {1, uiOnReset},              // UI_OP_RESET
+  {1, uiOnResetQuiz},          // UI_OP_RESET_QUIZ
+  {3, uiOnAward},              // UI_OP_AWARD
+  {2, uiOnLightboardMode},     // UI_OP_LB_MODE
+  {4, uiOnLightboardSettings}, // UI_OP_LB_SETTINGS
+};
+static const uint8_t UI_NUM_HANDLERS = sizeof(UI_HANDLERS) / sizeof(UI_HANDLERS[0]);
+
+// Called from the server callbacks: one check against the table, then queued
+void uiPost(uint32_t client, const uint8_t *data, size_t len) {
+  UiCommand c = {client, (uint8_t)len, {0}};
+  if (len == 0 || len > sizeof(c.data)) return;
+  uint8_t op = data[0];
+  bool local = op == UI_EVT_CONNECT || op == UI_EVT_DISCONNECT;
+  if (!local && (op >= UI_NUM_HANDLERS || !UI_HANDLERS[op].fn || UI_HANDLERS[op].len != len)) return;
+  memcpy(c.data, data, len);
+  if (xQueueSend(uiQueue, &c, 0) != pdTRUE) uiQueueDrops++;
+}
+
+void uiOnConnect(uint32_t client) {
+  Serial.printf("[%u] Connected!\n", client);
+  // allow only one UI client at a time to conserve resources
+  if (g_activeWsClient >= 0 && g_activeWsClient != (int32_t)client) {
+#if WEB_ASYNC
+    ws.close((uint32_t)g_activeWsClient);
+#else
+    ws.disconnect((uint8_t)g_activeWsClient);
+#endif
+  }
+  g_activeWsClient = (int32_t)client;
+}
+
+// Runs every loop(): drains the page's commands, then pushes status and winner
+// to the page when they changed
+void uiPoll() {
+  UiCommand c;
+  while (xQueueReceive(uiQueue, &c, 0) == pdTRUE) {
+    if (c.data[0] == UI_EVT_CONNECT) {
+      uiOnConnect(c.client);
+      uiOnHello(c);
+    } else if (c.data[0] == UI_EVT_DISCONNECT) {
+      Serial.printf("[%u] Disconnected!\n", c.client);
+      if ((int32_t)c.client == g_activeWsClient) g_activeWsClient = -1;
+    } else {
+      UI_HANDLERS[c.data[0]].fn(c);
+    }
+  }
+
+  int16_t status = uiStatusFlags();
+  if (status != uiLastStatus) {
+    uiSendStatus(-1);
+    uiLastStatus = status;
+  }
+  int16_t w = uiWinnerCode();
+  if (w != uiLastWinner) {
+    uiSendWinner(-1);
+    uiLastWinner = w;
+  }
+
+#if WEB_ASYNC
+  static unsigned long lastCleanupMs = 0;
+  if (millis() - lastCleanupMs >= 1000) {
+    ws.cleanupClients(); // frees clients that have gone away
+    lastCleanupMs = millis();
+  }
+#endif
+}
+
+#if WEB_ASYNC
+void handleWebSocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type,
+                          void *arg, uint8_t *data, size_t len) {
+  static const uint8_t connect = UI_EVT_CONNECT, disconnect = UI_EVT_DISCONNECT;
+  if (type == WS_EVT_CONNECT) {
+    uiPost(client->id(), &connect, 1);
+  } else if (type == WS_EVT_DISCONNECT) {
+    uiPost(client->id(), &disconnect, 1);
+  } else if (type == WS_EVT_DATA) {
+    // Every frame fits one TCP segment; anything fragmented isn't ours
+    AwsFrameInfo *info = (AwsFrameInfo *)arg;
+    if (info->opcode == WS_BINARY && info->final && info->index == 0 && info->len == len) {
+      uiPost(client->id(), data, len);
+    }
+  }
+}
+#else
+void handleWebSocketEvent(uint8_t num, WStype_t type, uint8_t * payload, size_t length) {
+  static const uint8_t connect = UI_EVT_CONNECT, disconnect = UI_EVT_DISCONNECT;
+  if (type == WStype_CONNECTED) uiPost(num, &connect, 1);
+  else if (type == WStype_DISCONNECTED) uiPost(num, &disconnect, 1);
+  else if (type == WStype_BIN) uiPost(num, payload, length);
+}
+#endif
+
 // ===================== Setup =====================
 void setup(){
   Serial.begin(115200);
@@ -2490,11 +813,22 @@ void setup(){
     Serial.println(F("SoftAP start FAILED"));
   }
 
+  uiQueue = xQueueCreate(UI_QUEUE_LEN, sizeof(UiCommand));
+#if WEB_ASYNC
+  server.on("/", HTTP_GET, handleRoot);
+  server.onNotFound([](AsyncWebServerRequest *request){ request->send(404, "text/plain", "Not found"); });
+  server.begin();
+  ws.onEvent(handleWebSocketEvent);
+  wsServer.addHandler(&ws);
+  wsServer.begin();
+#else
+  server.collectHeaders(UI_REQUEST_HEADERS, 1);
   server.on("/", handleRoot);
   server.onNotFound([](){ server.send(404, "text/plain", "Not found"); });
   server.begin();
   ws.begin();
   ws.onEvent(handleWebSocketEvent);
+#endif
 
   // ESP-NOW setup
   if (esp_now_init() != ESP_OK) {
@@ -2565,11 +899,11 @@ if (esp_now_add_peer(&lightboardPeerInfo) == ESP_OK) {
 
 // ===================== Loop =====================
 void loop(){
+#if !WEB_ASYNC
   server.handleClient();
   ws.loop();
-
-  const unsigned long nowUs = micros();
-  const unsigned long nowMs = millis();
+#endif
+  uiPoll();
 
   // Clock synchronization
   syncClock();
@@ -2579,17 +913,6 @@ void loop(){
 
   // if (g_capturing && (nowUs - g_t0) >= CAPTURE_WINDOW_US) { ... }
 
-  // Periodic status broadcast
-  if (nowMs - g_lastBroadcastMs >= BROADCAST_INTERVAL_MS){
-    String j = "{\"connected\":" + String(player2Connected ? "true" : "false") + 
-               ",\"player3Connected\":" + String(player3Connected ? "true" : "false") + 
-               ",\"lightboardConnected\":" + String(lightboardConnected ? "true" : "false") + 
-               ",\"clockSynced\":" + String(clockSynced ? "true" : "false") + 
-               ",\"player3ClockSynced\":" + String(player3ClockSynced ? "true" : "false") + "}";
-    ws.broadcastTXT(j);
-    g_lastBroadcastMs = nowMs;
-  }
-
   // Check for connection timeout
   if (player2Connected && (millis() - lastHeartbeat > heartbeatTimeout)) {
     player2Connected = false;
@@ -0,0 +1,840 @@
+// Generated by tools/build_oldmaster_ui.js from oldmaster.html - do not edit.
+// 66547 bytes -> 51376 minified -> 13251 gzipped
+#pragma once
+
+#include <pgmspace.h>
+
+#define OLDMASTER_UI_ETAG "\"982ca7f4c2a1bfd8\""
+
+static const size_t OLDMASTER_UI_GZ_LEN = 13251;
+static const uint8_t OLDMASTER_UI_GZ[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xed,0x7d,0x5d,0x93,0xdb,0xb8,
+  0xb2,0xd8,0xbb,0x7e,0x05,0x2c,0xef,0x59,0x91,0x31,0xc5,0xd1,0xc7,0xcc,0xec,0x58,
+  0x1a,0xc9,0x19,0x8f,0xbd,0x67,0x7d,0xcb,0x5f,0xeb,0xf1,0xde,0x4d,0x32,0x3b,0xf7,
+  0x18,0x12,0x21,0x89,0x3b,0x14,0x29,0x93,0xd4,0x68,0xe6,0x68,0xa7,0xea,0xe4,0xe5,
+  0x3c,0xde,0xdc,0x7b,0x53,0x95,0xfb,0x78,0x2a,0x2f,0xa9,0xca,0x4b,0xf2,0x96,0xca,
+  0xef,0xd9,0x3f,0x90,0xf3,0x13,0x52,0xdd,0x00,0x48,0x80,0x04,0xa9,0x19,0xdb,0x9b,
+  0x4a,0xdd,0x64,0x3f,0x6c,0x11,0x6c,0x34,0x80,0x46,0xa3,0xbb,0xd1,0xe8,0x06,0x8f,
+  0x1f,0x78,0xd1,0x34,0xbd,0x59,0x31,0xb2,0x48,0x97,0xc1,0xf8,0x58,0xfc,0xc9,0xa8,
+  0x37,0x3e,0x5e,0xb2,0x94,0x92,0x90,0x2e,0xd9,0xe8,0xca,0x67,0x9b,0x55,0x14,0xa7,
+  0x64,0x1a,0x85,0x29,0x0b,0xd3,0x51,0x73,0xe3,0x7b,0xe9,0x62,0xe4,0xb1,0x2b,0x7f,
+  0xca,0xda,0xf8,0xe0,0x10,0x3f,0xf4,0x53,0x9f,0x06,0xed,0x64,0x4a,0x03,0x36,0xea,
+  0x3a,0x64,0x49,0xaf,0xfd,0xe5,0x7a,0x99,0x17,0xac,0x13,0x16,0xe3,0x13,0x9d,0x04,
+  0x6c,0x14,0x46,0x0e,0x91,0x98,0xdb,0x33,0x3f,0x1d,0x4d,0xa3,0x2b,0x16,0x37,0x45,
+  0xc3,0xd3,0x05,0x8d,0x13,0x96,0x8e,0x9a,0xeb,0x74,0xd6,0x3e,0x6a,0x8e,0x1b,0xc7,
+  0xa9,0x9f,0x06,0x6c,0xfc,0x3e,0x8a,0x82,0xa7,0x11,0x8d,0x3d,0xf2,0xfd,0xda,0xff,
+  0xe3,0xf1,0x1e,0x2f,0x6d,0x1c,0x27,0xe9,0x0d,0xfc,0x3d,0x88,0xa3,0x28,0xdd,0x92,
+  0x76,0x3b,0x65,0xd7,0xe9,0xe0,0x21,0x3b,0x60,0xdf,0xb0,0xc9,0x90,0xb4,0xdb,0xd1,
+  0xe5,0xe0,0x61,0xb7,0x33,0x79,0x7c,0xd4,0x85,0xa7,0x09,0xf5,0x06,0x0f,0xd9,0x6c,
+  0x7f,0x7f,0x7f,0x1f,0x1e,0xe9,0x74,0xca,0xc2,0x74,0xf0,0xf0,0xb0,0x7f,0x78,0x38,
+  0xeb,0xe6,0x25,0xbd,0xc1,0xc3,0xa3,0xc9,0xc1,0x74,0x76,0x88,0x75,0xe6,0x83,0x87,
+  0x9d,0x49,0xb7,0xd7,0xeb,0xc0,0xd3,0x94,0xc6,0x1e,0x60,0xec,0xd2,0x7e,0x1f,0x9e,
+  0xfd,0xf0,0x72,0xf0,0x90,0xd1,0x59,0x67,0x36,0x83,0xc7,0xe5,0x3a,0x65,0xde,0xe0,
+  0x21,0xa5,0x93,0x43,0xaf,0x3f,0x24,0xb7,0x0d,0xa0,0xec,0x96,0xb4,0x37,0x6c,0x72,
+  0xe9,0xa7,0xd8,0xbb,0x76,0xe2,0xff,0x91,0xb5,0xa9,0xf7,0xf3,0x3a,0x49,0x07,0xdd,
+  0x4e,0xe7,0x77,0x43,0x52,0x51,0xcc,0x6b,0x3b,0x93,0xc8,0xbb,0xd9,0x2e,0xfd,0xb0,
+  0xbd,0x60,0xfe,0x7c,0xc1,0x5f,0xde,0x36,0xb0,0x94,0x2c,0x69,0x3c,0xf7,0xc3,0x41,
+  0x67,0x48,0x66,0x51,0x98,0xb6,0x67,0x74,0xe9,0x07,0x37,0x83,0xe4,0x26,0x49,0xd9,
+  0xb2,0xbd,0xf6,0x9d,0x33,0x36,0x8f,0x18,0xf9,0xe1,0x85,0xf3,0x2e,0x9a,0x44,0x69,
+  0xe4,0x9c,0xc4,0x3e,0x0d,0x86,0x64,0x1a,0x05,0x51,0x3c,0xb8,0xa2,0xb1,0xc5,0x29,
+  0x66,0x0f,0x1b,0x13,0x3a,0xbd,0x9c,0xc7,0xd1,0x3a,0xf4,0x06,0x31,0xf5,0x60,0x42,
+  0xe7,0xf0,0x37,0x0b,0x53,0xab,0xdb,0xeb,0x74,0x56,0xd7,0xe4,0x10,0xff,0xa4,0x29,
+  0x39,0xe8,0xfc,0x8e,0xb4,0x7b,0x9d,0xdf,0x39,0xe4,0x61,0x97,0xf5,0x1e,0xf7,0x27,
+  0x04,0x7f,0x73,0x22,0x91,0x43,0xfe,0xf0,0x4d,0x67,0xd2,0xed,0x13,0xe8,0xab,0x3d,
+  0x6c,0x78,0x7e,0xb2,0x0a,0xe8,0xcd,0x60,0x16,0xb0,0xeb,0x21,0xa1,0x81,0x3f,0x0f,
+  0xdb,0x7e,0xca,0x96,0x09,0x96,0xb4,0x93,0x94,0xc6,0xe9,0x90,0xc0,0xd0,0xfd,0xd9,
+  0x4d,0x5b,0xb0,0xdb,0x00,0xa6,0x82,0xc5,0x43,0xb2,0xa2,0x9e,0xe7,0x87,0xf3,0x41,
+  0x6f,0x7f,0x75,0x0d,0x54,0x71,0xe9,0x6a,0x85,0x40,0xd4,0x0f,0x59,0x2c,0x89,0xd0,
+  0x4e,0xa3,0xd5,0x60,0x49,0xaf,0xad,0xce,0xea,0xda,0x21,0x53,0x1a,0x4c,0xad,0x83,
+  0xce,0xd5,0x82,0xb4,0x49,0x1f,0x3a,0x6e,0xdb,0x58,0x15,0xe6,0x6f,0x4b,0x94,0xc1,
+  0x06,0x7e,0xc8,0x68,0xac,0x0c,0xf6,0xa8,0xe3,0xb1,0xb9,0x43,0xe2,0xf9,0x84,0x5a,
+  0xbd,0x83,0x03,0x47,0xfe,0xdf,0x71,0x3b,0xfb,0xb6,0xb9,0xbc,0x67,0x03,0x01,0xa3,
+  0xd8,0x63,0xf1,0xa0,0xbb,0xba,0x26,0x49,0x14,0xf8,0x9e,0x11,0xf2,0xc8,0x1e,0x12,
+  0x0e,0xd8,0x86,0x06,0xd7,0xc9,0xa0,0x7b,0x08,0x83,0xca,0x86,0x78,0xb4,0xba,0x26,
+  0xbd,0xde,0xea,0x1a,0xf0,0x5d,0xb7,0x93,0x05,0xf5,0xa2,0xcd,0xa0,0x43,0xba,0x40,
+  0xfa,0x3e,0xfc,0x81,0x58,0x3b,0x0e,0xfe,0xeb,0xf6,0x6d,0x58,0x7f,0x09,0x4b,0x49,
+  0x87,0x40,0xc3,0x9d,0x8a,0x6e,0x0b,0x16,0x43,0xc2,0x67,0x64,0xc5,0xf5,0x3b,0x58,
+  0xfa,0xa1,0x75,0xd0,0x43,0x9a,0x3d,0xee,0x5d,0x6d,0x6c,0x72,0xdb,0x78,0x38,0x8d,
+  0xc2,0xf0,0x19,0xac,0xa7,0x55,0x94,0xf8,0xa9,0x1f,0x85,0x83,0x99,0x7f,0xcd,0xbc,
+  0x21,0xf9,0x63,0xdb,0x0f,0x3d,0x76,0x3d,0x38,0x90,0xb5,0xbb,0x38,0x25,0x92,0x31,
+  0xf1,0x41,0x1f,0xde,0x41,0xe7,0x77,0xc3,0x06,0xcc,0x0c,0x4e,0x08,0x0b,0xaf,0xac,
+  0x84,0xce,0x58,0x9b,0xc6,0x8c,0xb6,0xb1,0xe7,0x30,0x6d,0x0e,0x81,0x09,0x22,0x8f,
+  0x48,0xb7,0xb7,0xba,0xb6,0x87,0x24,0x46,0x74,0x95,0x35,0xf0,0x75,0xa1,0x8e,0x24,
+  0x7f,0xaf,0x8e,0xfc,0xbd,0x03,0xce,0x04,0xd1,0xe5,0x56,0xe1,0x00,0xbe,0x0c,0xa2,
+  0x4b,0x9c,0x1a,0x85,0xe6,0xf0,0x6f,0x4f,0x52,0x5c,0x47,0xd4,0x3d,0xb0,0x1d,0x7c,
+  0x0f,0x43,0xe6,0x00,0xdd,0x43,0xa7,0x7b,0x74,0xe0,0x74,0x7b,0x8f,0x1d,0x77,0xff,
+  0xc0,0xbe,0x6d,0xb8,0x13,0xea,0x95,0x9b,0x99,0x50,0xef,0xf3,0xda,0xe9,0xf5,0x1f,
+  0x3b,0x87,0x47,0xf0,0x9f,0x68,0x86,0xae,0x56,0x64,0x2b,0xa6,0x83,0xc0,0x6c,0x3e,
+  0xee,0xf0,0xd9,0x3c,0xbc,0xda,0xe0,0x70,0x17,0x5d,0xb2,0xe5,0xe2,0x61,0xc3,0xe7,
+  0x89,0x7c,0xd3,0xe9,0x0c,0x49,0xc0,0xd2,0x14,0xe4,0xf2,0x8a,0x4e,0x81,0xf3,0x88,
+  0xdb,0x87,0xd9,0x13,0x02,0x25,0x6b,0x54,0x08,0x16,0x10,0x4e,0x03,0x32,0x0d,0xe8,
+  0x72,0x65,0x71,0x66,0xe9,0xbb,0xfd,0xab,0x8d,0x43,0xfa,0x7c,0xc6,0xb8,0x40,0x21,
+  0x7c,0x8c,0x42,0x88,0x72,0x5a,0x4f,0x68,0x4c,0xb6,0x44,0x0a,0x00,0xc2,0x25,0xc0,
+  0x9c,0xae,0x06,0xc8,0xd3,0xba,0x30,0x20,0x92,0x35,0x8b,0x92,0x80,0x40,0x2f,0x59,
+  0x7b,0xc2,0xd2,0x0d,0x63,0xa1,0xec,0x65,0x7b,0x12,0xa5,0x69,0xb4,0x1c,0x20,0x0b,
+  0x0c,0x11,0x75,0x7b,0x13,0x03,0x6a,0xf8,0x13,0x5b,0x5f,0xf9,0x41,0x40,0xb4,0xf5,
+  0x5e,0x26,0xb3,0xdb,0x39,0xcc,0x56,0xe5,0x80,0xd4,0xac,0x5f,0xbe,0x7c,0xb5,0xa1,
+  0xa2,0xbc,0xb7,0xf3,0xf5,0x4b,0x60,0xfd,0xf2,0xee,0xe8,0xeb,0x80,0x3c,0x7e,0xfc,
+  0xb8,0x40,0xcd,0x6e,0x5f,0x88,0xb3,0x8f,0x6b,0xff,0x8f,0xa8,0x58,0xc8,0x56,0x15,
+  0xc3,0xe4,0xce,0xa2,0xa9,0x42,0x32,0xe9,0x82,0xa9,0x76,0x64,0xdd,0x5e,0x06,0x98,
+  0xf5,0xb8,0x7b,0xa4,0x4a,0x26,0x31,0xf9,0x50,0x08,0x93,0x7f,0x00,0x93,0x0f,0xd2,
+  0xca,0xd6,0x24,0x15,0xa9,0x10,0x55,0x6e,0x9f,0x73,0x32,0xf0,0xf9,0x51,0xe1,0x15,
+  0xac,0xca,0x46,0x1a,0xd3,0x50,0xc8,0x1a,0x82,0xbf,0x67,0x51,0xbc,0x24,0x6e,0x2f,
+  0x21,0x8c,0x26,0xcc,0x51,0x56,0x4c,0x56,0x38,0x6c,0x14,0xd8,0x00,0x18,0x73,0xd8,
+  0x50,0x34,0x25,0x41,0xc5,0x95,0xab,0x1f,0xce,0x7d,0x0d,0x64,0x14,0xcf,0x8f,0xd9,
+  0x94,0xb7,0x37,0x8d,0x82,0xf5,0x32,0x1c,0x36,0x4a,0x5c,0x27,0xd8,0xb1,0x91,0x89,
+  0x41,0x12,0xb3,0x80,0xa6,0xfe,0x15,0x1b,0x36,0xd4,0x79,0x1b,0xd0,0x29,0x14,0x92,
+  0x6d,0xde,0xf5,0x01,0x41,0xf3,0xc7,0x72,0x1f,0x3f,0x3e,0xd2,0x17,0x3c,0xe9,0x90,
+  0x43,0x60,0x92,0xa3,0x32,0x85,0x38,0x37,0xc8,0xd5,0x6a,0x58,0x73,0x39,0xd1,0x91,
+  0x39,0xb2,0x71,0x76,0xdd,0xbe,0xb2,0x74,0x87,0x44,0xa5,0x41,0xd7,0xed,0xb3,0x25,
+  0x57,0x9b,0x44,0x91,0xe8,0x84,0x4e,0x92,0x28,0x58,0xa7,0x0c,0x3a,0xc7,0xe9,0x87,
+  0x42,0x61,0x96,0xe2,0x0f,0x2e,0x82,0x11,0x57,0xae,0x5d,0xab,0x24,0x02,0x67,0x8a,
+  0x1e,0x97,0x08,0x3d,0x4d,0x22,0x3c,0xf4,0x0e,0x67,0x3d,0xb0,0x8d,0x22,0x90,0x33,
+  0xe9,0x0d,0xa2,0xbc,0xf2,0x13,0x7f,0xe2,0x07,0xf8,0xb8,0xf0,0x3d,0x8f,0x2f,0xe9,
+  0xeb,0xac,0xcb,0x9d,0x21,0x01,0x9b,0x70,0x16,0x00,0xb9,0x24,0x40,0xc6,0x88,0x9d,
+  0x4a,0x56,0xbc,0xff,0x0b,0x4e,0x17,0x37,0x59,0x44,0x1b,0xb2,0xcd,0xfb,0xd8,0xd5,
+  0xfb,0x88,0xbf,0x03,0xa6,0x77,0x92,0xf3,0x16,0xb7,0x29,0x52,0x36,0x8f,0xe2,0x1b,
+  0x10,0xee,0x73,0x76,0x9f,0x45,0xdc,0x85,0xf5,0xd7,0x93,0x6b,0xf0,0xc0,0x36,0x15,
+  0x77,0x8e,0x6a,0x16,0xb1,0x06,0x69,0x58,0xc3,0xb0,0x84,0x1b,0x19,0xe5,0x0e,0xa5,
+  0x70,0x6a,0xa8,0x62,0x28,0x2f,0x90,0xfa,0xe1,0xb0,0xd3,0x19,0x36,0x0c,0x22,0xbd,
+  0x0d,0x2d,0x18,0x38,0xa8,0xc1,0x99,0x03,0x11,0x71,0x0e,0xe2,0xbf,0xa5,0xb9,0x40,
+  0xba,0xb8,0x5e,0x60,0x5d,0xc5,0x51,0x90,0xa8,0xfa,0x60,0x1e,0xfb,0xde,0x10,0xff,
+  0x6c,0xa7,0x6c,0xb9,0x0a,0x68,0xca,0xda,0x7c,0x3d,0x82,0x04,0x9a,0xc5,0xf2,0x7f,
+  0x4d,0x67,0x68,0x2c,0x79,0xc8,0x67,0x61,0xb2,0x4e,0xd3,0x28,0x24,0xdb,0x46,0x66,
+  0x6b,0xd3,0x55,0x7b,0xe1,0xcf,0x17,0x01,0x8c,0xa9,0x2d,0x46,0x83,0xeb,0x73,0x45,
+  0x63,0x16,0xa6,0xc3,0x06,0x5d,0xad,0x18,0x8d,0x69,0x38,0x65,0x03,0x12,0x46,0x21,
+  0x1b,0x92,0xe9,0x3a,0x4e,0x00,0x6c,0x15,0xf9,0x5c,0x11,0xf1,0xad,0x0b,0x0b,0xd8,
+  0x34,0x15,0x30,0x77,0x13,0xa7,0xfb,0x45,0x45,0xe1,0x87,0x97,0xba,0x91,0xbd,0x83,
+  0x31,0x3a,0x87,0x4e,0xf7,0xb0,0x2b,0xe6,0xb5,0x67,0x9b,0x8a,0xbb,0x8a,0x74,0xcf,
+  0x85,0xf6,0xbe,0x26,0xb4,0x61,0x1e,0xca,0xab,0xb6,0x7b,0x90,0x15,0x68,0x53,0xfe,
+  0x1b,0x0a,0xf2,0xae,0x14,0xe4,0x33,0x3f,0x48,0x59,0xac,0x4a,0xf6,0x8c,0x26,0x8a,
+  0x64,0x97,0xf3,0x39,0x58,0x80,0x20,0x00,0x89,0x88,0xd5,0x06,0x64,0x82,0x82,0x29,
+  0x64,0x49,0x62,0x75,0xdd,0x0e,0x17,0x99,0x02,0xd4,0x24,0x84,0xf1,0x27,0x30,0xd5,
+  0xbf,0xb5,0xba,0x20,0x07,0x34,0xa1,0x7c,0xdb,0x70,0xe7,0x8b,0x28,0x49,0xef,0x66,
+  0x20,0x80,0x35,0x11,0x47,0xf3,0x98,0x25,0xc0,0xc0,0x2a,0x0b,0x1e,0x19,0x15,0xbb,
+  0xd1,0x4e,0x28,0xd8,0x41,0xbb,0xec,0x1c,0xa3,0x71,0x74,0xdb,0x70,0x2f,0x27,0x9e,
+  0xd4,0x12,0x62,0xcb,0x47,0xd6,0x7e,0x7b,0x19,0x85,0x11,0x22,0x70,0xc8,0xd9,0xb7,
+  0xaf,0xa2,0x30,0x6a,0xbf,0x63,0xf3,0x75,0x40,0x63,0x87,0xbc,0x62,0x61,0x10,0x39,
+  0xe4,0x55,0x14,0xd2,0x69,0xe4,0x90,0xd3,0x28,0x4c,0xa2,0x80,0x26,0x0e,0x69,0xbe,
+  0xf4,0x27,0x2c,0xa6,0x30,0x5f,0xf0,0x36,0x6a,0x3a,0x24,0x43,0xa3,0x0f,0xaa,0xa7,
+  0x0c,0xea,0xe1,0x74,0xc6,0xba,0x9a,0x54,0x77,0x1f,0x63,0xc7,0xb8,0xb0,0x26,0xdb,
+  0x5c,0xe5,0xc2,0xa2,0x21,0x0f,0xfc,0x25,0x6c,0xf7,0x29,0xac,0xba,0xb2,0xf0,0xd7,
+  0x5e,0xe7,0x7a,0x42,0x2b,0xce,0x54,0x83,0x0e,0x5c,0xd0,0x12,0xda,0xcb,0xdb,0x86,
+  0x1b,0x33,0xd8,0x2f,0x24,0x5c,0xd1,0x17,0x04,0xb3,0xd1,0x5c,0xba,0xdb,0xf2,0x06,
+  0x7e,0x28,0x2d,0xbc,0x9e,0x26,0x6a,0xf9,0xc2,0x3b,0x44,0x83,0xa4,0x60,0xac,0x1e,
+  0x1a,0x4c,0x12,0xd3,0x44,0x37,0xb8,0xc4,0xe3,0xe2,0xb9,0x60,0xdb,0xe6,0x83,0x9b,
+  0xa4,0xe1,0xbd,0xcc,0xc6,0x7c,0xfb,0xd0,0xcb,0xf4,0x8d,0x52,0xd8,0x3d,0xb0,0x6d,
+  0x8d,0x8a,0x55,0xf4,0xc8,0xab,0xf4,0xf5,0x0a,0x92,0x45,0x66,0x53,0x7a,0x40,0x0f,
+  0xb4,0x57,0x2a,0x3b,0xc1,0x86,0x46,0x7d,0x57,0x52,0x52,0x86,0x5e,0xa8,0x6a,0x4d,
+  0x7b,0xad,0x0a,0x1d,0x1a,0x04,0xa4,0x93,0x4b,0x92,0x3b,0x13,0x1a,0xa7,0x45,0x25,
+  0xab,0x94,0x3d,0x9f,0x44,0xdc,0xbe,0x89,0xb8,0xbd,0x22,0x71,0xcd,0x92,0xaa,0xdd,
+  0x45,0xb3,0x3a,0xeb,0xcb,0xc2,0x0f,0x53,0xb2,0xd5,0xa8,0xd7,0x85,0xce,0x9a,0x24,
+  0x8c,0xb2,0x7e,0xdc,0x23,0xc4,0x31,0xf3,0x03,0xd6,0xf6,0xc3,0xd5,0x3a,0xfd,0x97,
+  0xb6,0x00,0x94,0x91,0xe1,0x9f,0xe7,0xe0,0xd1,0x1c,0x35,0xa1,0xb8,0x79,0x51,0x94,
+  0x41,0xc5,0x1a,0x01,0x9d,0xb0,0x80,0x6c,0x1b,0x45,0x95,0x6f,0xb2,0x7b,0xec,0x82,
+  0x7d,0x74,0x00,0xca,0xb2,0xc0,0xcc,0xf7,0xe5,0x34,0x83,0x51,0x56,0x9a,0x1c,0x5d,
+  0xdd,0xd7,0x58,0x81,0x9a,0xb5,0x50,0x61,0x05,0xd6,0xac,0x11,0x03,0x65,0x8c,0xcc,
+  0x6f,0xe8,0x54,0xa6,0xf2,0x6b,0xb8,0x18,0x2d,0xb0,0x09,0x38,0x6f,0xdb,0x09,0x4b,
+  0x53,0x3f,0x9c,0x27,0x42,0x6c,0xfd,0x7f,0xe2,0xd7,0x11,0xe8,0x4b,0xce,0x81,0x32,
+  0xbf,0xee,0xe7,0xc9,0x93,0xac,0x87,0xb9,0x5a,0x35,0xee,0xc3,0x4d,0xa0,0x72,0xd1,
+  0x65,0xb3,0x35,0x09,0xa2,0xe9,0xe5,0x1d,0x77,0x1f,0x76,0x49,0x92,0x1c,0x15,0xb7,
+  0x32,0xfb,0xe5,0x86,0xc1,0x74,0x27,0xdb,0x86,0xf0,0x8f,0xa1,0x63,0x5d,0x11,0x52,
+  0x9d,0x7c,0xfe,0xef,0x68,0xd6,0x1b,0xa7,0x77,0xb7,0xf9,0xd8,0x30,0xec,0x06,0x4a,
+  0x3d,0x2f,0xf3,0x79,0x3d,0xdf,0x14,0x86,0x39,0x98,0x45,0xd3,0x75,0x42,0xb6,0x8d,
+  0x68,0x9d,0x82,0x9e,0xd2,0x77,0x2c,0x6d,0x33,0x49,0xeb,0xbb,0xde,0x2d,0xb9,0x77,
+  0x34,0x6f,0xe5,0xe3,0xc7,0x4e,0xb7,0xd3,0x73,0x7a,0xfb,0x5d,0xce,0xfa,0xc0,0xcb,
+  0x11,0xf5,0x98,0xd7,0x06,0x7e,0x4b,0x72,0xd6,0xe0,0xbb,0x42,0xba,0x4e,0xa3,0xe1,
+  0x1d,0xf9,0xae,0x88,0x6a,0xd1,0xaf,0x96,0xe8,0x81,0x0f,0x46,0x7c,0x03,0xfe,0x6a,
+  0xe3,0x81,0x90,0x04,0xc8,0x7d,0x06,0x92,0x77,0xf0,0x67,0x41,0x58,0xa0,0x5c,0x38,
+  0xaa,0xd5,0x32,0xd8,0x42,0xe0,0xef,0xd6,0xa0,0xfd,0xcf,0xd0,0xa0,0xba,0x68,0xda,
+  0xe7,0x3b,0xac,0xe1,0x67,0xe9,0x7d,0xec,0xb7,0x9b,0xac,0xa7,0x53,0xdc,0xb6,0x64,
+  0xc6,0xd9,0x3e,0xf5,0xd8,0x51,0x47,0xab,0xf5,0xb8,0x58,0x8b,0xc5,0x71,0x14,0x2b,
+  0x75,0x66,0x47,0xdf,0x74,0xbf,0xe9,0x1a,0xea,0x64,0xfe,0x0f,0xce,0x86,0x51,0xfc,
+  0x2f,0xc0,0x8f,0xc9,0x89,0xcb,0x9f,0xec,0x61,0xa5,0x84,0x2b,0x0f,0x7d,0xd1,0xcb,
+  0xb8,0x5e,0x78,0xd1,0x41,0xc7,0xe8,0x2a,0x4b,0xf7,0x9a,0xf1,0x2e,0xec,0x63,0x17,
+  0xcc,0x6b,0x54,0x6d,0x08,0x5c,0x25,0xea,0x4a,0x40,0x07,0x4a,0xa3,0xc2,0x81,0x12,
+  0xb3,0x15,0xa3,0xa9,0x05,0xeb,0x0e,0x8e,0x5a,0x1d,0x70,0x0c,0xc2,0x11,0x59,0x8f,
+  0x1f,0x11,0x74,0x67,0x31,0x10,0x56,0x31,0xb3,0x34,0x6f,0xd6,0xfd,0x76,0x16,0x45,
+  0x9d,0x64,0x2a,0xae,0xf5,0x65,0xed,0x9e,0xc8,0x82,0x85,0x89,0xeb,0x45,0x39,0xd8,
+  0xca,0x14,0x7d,0xc9,0xac,0xa8,0x11,0xa3,0x65,0xd5,0x53,0xa0,0xc1,0xfd,0xb7,0x01,
+  0xba,0x45,0x60,0xa6,0x04,0xec,0xb3,0x2a,0xb5,0x76,0xcf,0xe0,0x56,0xc7,0x83,0xc1,
+  0x83,0xa2,0x33,0xc6,0x2e,0x75,0xd7,0xe5,0x9c,0xc8,0xbc,0x4f,0xf6,0x43,0xf6,0xcc,
+  0x7e,0x48,0xde,0xe3,0x6a,0x5d,0xd2,0x16,0x0a,0x60,0x4e,0x97,0x0c,0x4e,0x74,0x53,
+  0x54,0x45,0x26,0xd7,0xb9,0xdc,0xcb,0x1f,0x75,0x0c,0xbb,0x03,0xbe,0xb4,0x4c,0xb3,
+  0x9a,0x6f,0xf6,0xa5,0x3f,0x16,0x9a,0x83,0x55,0xc0,0xe2,0xb6,0x58,0x0f,0xea,0xca,
+  0xe0,0xc2,0xbd,0xd2,0xa9,0x8f,0x5c,0xcf,0x5b,0x33,0x5a,0x8b,0x99,0xff,0x1c,0x4d,
+  0x86,0xbc,0xa5,0xd4,0x0f,0xd8,0xa7,0x0b,0xb8,0x9e,0x59,0xc0,0x75,0xef,0xba,0x2e,
+  0xe0,0x08,0xea,0x4e,0x3b,0xaf,0x23,0x79,0x16,0x92,0x5b,0x3e,0x66,0x43,0xb4,0x2f,
+  0x57,0x82,0x22,0xd7,0xf7,0x87,0x0d,0xe9,0x70,0x9b,0xc7,0xf4,0x86,0x7b,0xcd,0xba,
+  0x3a,0xc3,0xf2,0xc2,0x8e,0xfb,0xd8,0x2e,0x52,0xc7,0xdd,0xf8,0x61,0xb8,0x7b,0xc9,
+  0xf4,0x0f,0x72,0x22,0x69,0x86,0x44,0xce,0x7f,0xfd,0xc7,0xce,0x63,0x28,0x3d,0xe4,
+  0x7b,0xe7,0x4a,0x12,0xa9,0xd5,0xe1,0x1c,0xa5,0xa1,0x78,0xf2,0x0d,0x23,0xe9,0x98,
+  0x46,0x82,0xee,0xc4,0x82,0xd3,0xa1,0x7a,0x01,0x6a,0x2d,0x6a,0x14,0x80,0xd0,0x19,
+  0x69,0x5d,0x6b,0x72,0x45,0xd5,0xe3,0x87,0x25,0x3d,0xce,0x4d,0xc2,0x3b,0x49,0x33,
+  0x83,0x53,0x5a,0x9d,0x56,0x44,0x5b,0xb0,0x14,0x95,0xbe,0x65,0xf2,0x4c,0x9f,0xb4,
+  0x41,0x18,0xa5,0x96,0x9b,0x4c,0xa3,0x18,0xa2,0x74,0x6c,0xb2,0xa3,0x0a,0x14,0xbb,
+  0xcc,0xf3,0xc1,0xfe,0xdc,0x69,0x15,0x75,0xcb,0x3c,0xbb,0xaf,0xb1,0x2c,0x70,0x2c,
+  0x92,0x24,0xb3,0x5c,0xf3,0x73,0xfc,0xb2,0x2e,0x14,0x5d,0x80,0xbe,0xb2,0xc2,0x3e,
+  0xa6,0x57,0x69,0x1f,0xa9,0x0e,0xdb,0x0a,0x63,0xbb,0xc0,0xc5,0x92,0x16,0xa6,0x7d,
+  0x6a,0x05,0x68,0x05,0x6d,0xf3,0xf7,0xd2,0x47,0xbd,0x83,0xf8,0x79,0x8b,0x1e,0x9b,
+  0xd1,0x75,0x90,0x56,0xac,0xbc,0xa2,0xbf,0xb3,0x1a,0x65,0xd6,0xb3,0xdd,0x78,0x54,
+  0xb6,0x2f,0x79,0x6f,0xeb,0x1b,0xc9,0x86,0xf7,0x99,0xbd,0x35,0x73,0x5f,0x69,0xbd,
+  0x14,0x11,0xb2,0x6b,0xdf,0xe4,0x10,0x35,0xda,0x99,0x77,0x72,0x72,0x16,0x24,0xaf,
+  0xc9,0xcf,0xa9,0x72,0x59,0xa5,0xb3,0xf3,0xb0,0xd6,0xd9,0xd9,0xb9,0x9f,0xb3,0x53,
+  0x91,0xd3,0xdf,0xe8,0x2b,0x5f,0xbc,0x51,0xd7,0xbe,0xa2,0x01,0xc0,0x0a,0xd4,0x10,
+  0x55,0x95,0x2b,0x94,0xcc,0x68,0xaf,0x0a,0xd4,0x1d,0xb4,0x3d,0x2a,0xce,0xcb,0xbf,
+  0x5e,0x32,0xcf,0xa7,0xc4,0x82,0xd3,0x53,0xd1,0x26,0x46,0x1c,0x01,0x9f,0xab,0x87,
+  0x82,0xf5,0xa7,0x80,0xfa,0x51,0x2b,0x37,0x83,0x6b,0xaa,0x0c,0x95,0x40,0x26,0xf5,
+  0xc0,0x91,0x1f,0xf4,0xe9,0x87,0x39,0xa5,0x97,0x0f,0xd3,0x68,0x3e,0x87,0x95,0x6f,
+  0xa8,0x97,0x33,0x19,0xa9,0xf1,0x67,0x93,0xe2,0x3e,0x4e,0x7b,0x79,0x0b,0x34,0x5e,
+  0x46,0x1e,0x0d,0xda,0x40,0x5f,0x6e,0xb8,0xe4,0xa6,0x12,0x8f,0xb6,0xe2,0xa7,0xaa,
+  0x1d,0x79,0xa4,0xda,0x19,0x36,0xb2,0x43,0xf9,0x46,0x7e,0x64,0x5f,0x9e,0x8d,0x8e,
+  0x43,0xc4,0x7f,0xee,0x37,0xf6,0xdd,0x3c,0x63,0x95,0x46,0x52,0x7e,0x82,0xdb,0xe9,
+  0x88,0xb6,0xbc,0x38,0x5a,0xb5,0xb3,0xe3,0xb8,0x60,0x1d,0x5b,0x7c,0xeb,0x62,0x66,
+  0xc4,0xbe,0xa2,0x84,0xb4,0x01,0xe7,0x47,0x45,0x4a,0x64,0x40,0x43,0x08,0xd8,0x36,
+  0xbb,0x62,0x61,0x9a,0x28,0xfb,0x7c,0x5e,0x17,0xe2,0x12,0xa3,0xf9,0xa7,0x5b,0x5f,
+  0x47,0x76,0xc5,0xae,0xf3,0x73,0x76,0x25,0xfa,0xb6,0x1d,0x3d,0x0d,0x19,0x9f,0xef,
+  0x73,0xab,0x4b,0x3c,0x3d,0xee,0x5c,0x6d,0x8a,0x66,0x45,0x8f,0x87,0x56,0x16,0x0c,
+  0x7b,0x7e,0xc8,0x5a,0x69,0xf3,0x57,0x98,0x61,0xe6,0xb3,0xd7,0x9a,0x49,0xe0,0x62,
+  0x97,0xcf,0x84,0x4d,0x8a,0x44,0x2e,0x9b,0x48,0xb6,0x82,0x02,0xa2,0x85,0x51,0x34,
+  0xe4,0x5a,0x1c,0x46,0x01,0x1b,0x59,0x41,0x13,0x41,0xa8,0xcc,0xef,0xbf,0xcb,0xac,
+  0x2d,0xa2,0x46,0x97,0x8f,0xe2,0xb6,0x51,0x97,0xdb,0xd1,0x9d,0x83,0x16,0x54,0xc4,
+  0x82,0xbf,0x8d,0x9d,0x36,0x80,0xad,0xaa,0xdb,0x3f,0xc0,0x58,0x07,0x3d,0x06,0x67,
+  0xbf,0xd0,0xbe,0x88,0xac,0xcd,0xd0,0x52,0x74,0x82,0x26,0x6a,0xeb,0xa8,0x19,0x90,
+  0x64,0x3d,0x53,0xa4,0x92,0xb2,0x33,0x2f,0x2d,0x51,0xf4,0x55,0xb1,0xd0,0x53,0x1a,
+  0xe0,0xaa,0x4f,0xf7,0x6e,0x72,0xbc,0x45,0x9e,0xed,0x18,0x3d,0xa7,0xa6,0x88,0x80,
+  0x3b,0x7a,0x45,0xef,0xb3,0xe5,0x56,0x74,0xd2,0x51,0x47,0x23,0x3c,0xec,0x5f,0xa7,
+  0x10,0x90,0x11,0xec,0x56,0xe1,0x25,0xa7,0xaa,0xe2,0x39,0x2c,0x62,0xab,0xf6,0xa4,
+  0x97,0xec,0xd4,0xda,0x19,0x44,0x8c,0x51,0x38,0xf3,0xe3,0xe5,0x97,0x3e,0x74,0x2d,
+  0x1e,0x9c,0x16,0xb7,0xda,0xe5,0x53,0x57,0x73,0xbf,0x7e,0x9b,0x53,0xcb,0x9d,0x07,
+  0x0c,0xb5,0x3a,0xbe,0x20,0x57,0xa4,0x34,0x3c,0x00,0x69,0x28,0xd7,0x57,0x4f,0xe7,
+  0x84,0x7c,0xad,0x54,0x45,0xeb,0x15,0xb8,0x5e,0x73,0xf0,0x9b,0x0f,0x3c,0xca,0xde,
+  0x63,0xed,0x7c,0xb5,0xf4,0xfa,0xb6,0x71,0xbc,0x27,0xf2,0x0b,0x8e,0xf7,0x78,0x72,
+  0x04,0x44,0xdd,0x8f,0x1b,0xc7,0x9e,0x7f,0x45,0x7c,0x6f,0x24,0xcd,0x8b,0x69,0x40,
+  0x93,0x64,0xd4,0x9c,0x50,0xaf,0x39,0x3e,0xde,0xf3,0xfc,0x2b,0x01,0x22,0xca,0x21,
+  0x42,0x57,0x0b,0x59,0x6f,0xe6,0x28,0x9a,0x10,0x44,0xf8,0x02,0x96,0xcc,0x8c,0x4e,
+  0x59,0x53,0xaf,0xa8,0x85,0x2f,0xc0,0x3b,0x11,0xe4,0x04,0xf5,0xf0,0xdd,0x49,0x10,
+  0x3c,0xa3,0x29,0x6d,0xea,0x15,0x26,0x69,0xd8,0x1c,0xff,0xf5,0x2f,0xff,0xfc,0x8f,
+  0xff,0xeb,0x7f,0xfe,0x07,0xf2,0x0e,0x8a,0xc8,0x49,0x10,0x10,0x80,0x3c,0xde,0xe3,
+  0x28,0x4c,0xed,0x00,0x19,0x9a,0xe3,0xf7,0x0b,0x3f,0x21,0x1b,0x08,0x9b,0x9d,0x06,
+  0x8c,0xc6,0xb8,0x76,0xb9,0x23,0x9e,0x08,0xe3,0xcb,0x67,0x89,0x43,0x70,0xf3,0x95,
+  0x38,0x84,0x86,0x1e,0xe1,0xb6,0x3a,0xe6,0x8c,0x24,0x72,0xf8,0x65,0x2a,0xe4,0x13,
+  0xd2,0xc4,0x01,0xe4,0x87,0x5e,0xaf,0x22,0x8f,0x9d,0x19,0x07,0x99,0xc3,0x9c,0x89,
+  0xa3,0x8e,0xa7,0x69,0x98,0x8d,0xb6,0xe2,0xd8,0xac,0x39,0x6e,0xfc,0xf5,0x2f,0xff,
+  0xf4,0x9f,0xc9,0xcb,0xec,0x75,0xc3,0x3c,0x6c,0x3e,0xe0,0x53,0x58,0x37,0xf3,0x75,
+  0xcc,0x08,0x78,0xae,0xc8,0x32,0xf2,0x98,0x3a,0x2a,0x5c,0x7e,0xf7,0x18,0x16,0x3c,
+  0xbf,0x80,0x47,0x65,0x44,0xfc,0xd8,0x6b,0x16,0xc5,0xa3,0xe6,0x34,0xb9,0xfa,0x16,
+  0xce,0xa7,0xc7,0x7f,0xfd,0xcb,0x7f,0xfc,0xf7,0xe4,0x65,0x44,0x3d,0x72,0x7a,0xf6,
+  0xb7,0x04,0xca,0x92,0xe3,0x3d,0x04,0x1c,0x37,0x8e,0x39,0xdf,0x2a,0xc7,0xd9,0x88,
+  0x5a,0xd6,0x25,0xa0,0xd8,0x56,0xe9,0xa8,0xe9,0x4e,0x93,0xab,0x26,0x59,0xae,0x83,
+  0xd4,0x5f,0x21,0x97,0x96,0x06,0xf7,0x5d,0x14,0x78,0xe4,0x34,0x8d,0x83,0xbd,0xd3,
+  0xa5,0x07,0x3d,0xc8,0xa0,0xc9,0x8c,0x37,0x59,0x1a,0x90,0x7e,0xea,0x82,0xa6,0x81,
+  0x98,0x30,0x7c,0x81,0x3d,0x85,0x41,0x2d,0xfa,0xe3,0x97,0x9c,0x2f,0xb0,0x68,0x70,
+  0xbc,0xb7,0xe8,0x8f,0x1b,0xc7,0xeb,0x40,0xa3,0x0c,0x1c,0x25,0xe4,0x84,0x79,0x09,
+  0x4f,0xe3,0xe3,0xbd,0x75,0x90,0xd3,0xb2,0xdc,0x03,0x83,0x53,0x5d,0xe9,0x86,0x7c,
+  0x7b,0x26,0x5e,0x62,0x5f,0x7a,0xe3,0xd3,0x45,0x14,0x25,0x8c,0x50,0xcc,0x0f,0x22,
+  0xa7,0x02,0xe8,0x78,0x6f,0xd1,0xab,0x40,0x0e,0x5b,0x07,0x1d,0xe3,0xef,0xa1,0xa4,
+  0x02,0x1a,0xf9,0x0a,0xc6,0x0b,0xfe,0x8e,0x7c,0x21,0xb8,0xae,0x5b,0x18,0x47,0x79,
+  0x38,0x18,0x26,0x2c,0xfd,0x93,0xea,0x48,0xe0,0xc5,0x33,0x5e,0x5e,0x68,0x76,0x42,
+  0xf9,0xb0,0xba,0x19,0xdc,0x7b,0xc8,0x77,0x6a,0x8e,0xbf,0x5f,0xfb,0xd3,0xcb,0x5f,
+  0xff,0xf4,0x8f,0xdf,0xfa,0x31,0x13,0x99,0x50,0x8b,0xae,0x5e,0x17,0x42,0xde,0x9b,
+  0xe3,0xe3,0x64,0x45,0xf9,0x1a,0x9a,0x46,0x6b,0x10,0x2f,0x59,0xef,0xb1,0xcb,0xf0,
+  0x36,0x13,0x55,0xca,0x82,0x83,0xcd,0x8d,0xba,0xc4,0xe4,0x66,0xa7,0x49,0x30,0xe1,
+  0x6a,0xd4,0x7c,0x7e,0xed,0xa7,0x24,0x8d,0x24,0x81,0x7d,0xe0,0x85,0x5f,0xff,0xfc,
+  0x5f,0x95,0x05,0x56,0x26,0x80,0xe2,0x11,0xe6,0x03,0x87,0x82,0x33,0xfe,0x5c,0xe8,
+  0xbb,0xe6,0xcc,0x35,0xbf,0x4c,0xb3,0xf5,0xc0,0x0b,0x7a,0xef,0x71,0x3d,0x99,0x40,
+  0x41,0x22,0x35,0xc7,0x6f,0xf9,0x42,0xee,0x19,0x7a,0xa6,0x7a,0x92,0x34,0x9c,0x67,
+  0x58,0x32,0xee,0x54,0xcf,0x6a,0x45,0x6f,0xfa,0x77,0xec,0x4d,0xff,0x1e,0xbd,0xe9,
+  0x57,0xf4,0xa6,0x9e,0xe3,0x20,0x30,0x5d,0xf2,0x37,0xfc,0xa2,0xb1,0x4f,0xdb,0x81,
+  0x7f,0xc5,0x46,0xcd,0x55,0x14,0xf8,0x29,0xab,0x64,0x75,0x8c,0x62,0x36,0x2d,0xb9,
+  0xa7,0xf0,0x26,0x57,0x71,0xab,0xac,0x3d,0xc1,0xcf,0x19,0x8f,0xfd,0xfa,0xa7,0xff,
+  0x72,0xbc,0xb7,0x52,0x41,0x28,0x07,0xa1,0xc0,0x99,0x69,0x1c,0x85,0xf3,0xf1,0x49,
+  0x98,0x6c,0x58,0x3c,0x00,0x15,0x8b,0xcf,0x24,0x67,0x59,0x8a,0xaf,0xde,0xb3,0x6b,
+  0x14,0x16,0x82,0x57,0x57,0x66,0x59,0x21,0xdc,0x07,0x72,0x7c,0x20,0x40,0x47,0xcd,
+  0x53,0x59,0xaa,0x73,0xf7,0x2a,0x66,0x57,0x19,0x27,0xbf,0x8d,0xd9,0x95,0x1f,0xad,
+  0x13,0x62,0xfd,0xfa,0xe7,0x7f,0xb0,0x9b,0xe3,0x5f,0xff,0xf9,0x4f,0x04,0xca,0x14,
+  0x56,0x56,0xaa,0x72,0x87,0x40,0xb6,0x2e,0x30,0x6e,0x34,0x43,0x75,0xb6,0x88,0x36,
+  0x7b,0xdf,0xf9,0x1e,0x23,0x7c,0x50,0xc4,0x3a,0x83,0xf8,0x49,0xbb,0x39,0x86,0x37,
+  0xa2,0xd0,0x8c,0x37,0x84,0x41,0x4a,0x3c,0xaf,0xd9,0x75,0x0a,0xdd,0xf9,0x27,0xbb,
+  0x39,0xc6,0xdf,0xbf,0xfe,0xa7,0xff,0x51,0xbb,0xb2,0xa4,0x0f,0x43,0x4c,0x25,0x34,
+  0x17,0xa7,0xd3,0x35,0xec,0x9c,0x39,0x35,0x05,0xdc,0xe5,0xc4,0x83,0x65,0xfa,0x0f,
+  0x7b,0xbf,0xfe,0xf9,0x9f,0x04,0x41,0x09,0x10,0x63,0x0f,0x9a,0x77,0x0c,0xb0,0xd8,
+  0x7f,0x09,0x09,0xd1,0xf1,0x86,0xc6,0x11,0xf0,0xbd,0xbf,0x1a,0x90,0xd3,0xc0,0x9f,
+  0x5e,0x92,0x74,0xc1,0x08,0x66,0xb1,0xa4,0x11,0x11,0xfe,0x13,0x28,0xe2,0x93,0xe9,
+  0xde,0x95,0x77,0x75,0xaf,0x88,0xc6,0x85,0xdc,0xc0,0x7d,0x05,0x00,0x4d,0x53,0x25,
+  0x6e,0x60,0x1a,0x5f,0xf1,0x1d,0xa5,0x50,0x5b,0x28,0xc3,0x40,0x78,0x3e,0x11,0x3a,
+  0xab,0xaa,0x17,0x62,0xaf,0x05,0xd5,0x56,0xe3,0x93,0x98,0x91,0x9b,0x68,0x4d,0x92,
+  0xb5,0xf8,0xb1,0xa1,0x21,0x8a,0x42,0x86,0x22,0x11,0xcc,0x26,0x58,0x77,0x68,0x3b,
+  0xc4,0x2c,0x5d,0xc7,0x21,0xbc,0xcc,0x55,0xc5,0x93,0x2a,0x16,0xd6,0x0c,0x5e,0x85,
+  0x63,0xb5,0xd7,0x60,0xe4,0xf2,0xbd,0x8c,0x5c,0x92,0xf0,0x1b,0x46,0xd2,0x1c,0x9f,
+  0xe2,0xef,0x32,0x7f,0x95,0x11,0x70,0x0a,0x6a,0xe4,0xe4,0x28,0xe0,0xcf,0x32,0xa7,
+  0x7d,0xc2,0x24,0xa1,0x29,0xf9,0xf9,0x53,0xa4,0x5b,0xad,0x5f,0x66,0x9e,0xb0,0x6b,
+  0x68,0xcf,0x7a,0x80,0x93,0x14,0x2c,0xdd,0x01,0x9f,0x9f,0x75,0x40,0xd0,0xe6,0x1f,
+  0x35,0xe5,0xce,0x04,0xcf,0xd3,0x3a,0x99,0x47,0x4f,0xc4,0xb2,0xe0,0x7e,0xc5,0x18,
+  0xe4,0x8d,0x16,0x9f,0x3f,0x3e,0x31,0x19,0xce,0xc7,0x7b,0x81,0xcf,0x5f,0x0b,0x3d,
+  0xc0,0xed,0xe8,0x52,0xb1,0xb0,0xa5,0x65,0xe9,0xe9,0x3a,0x86,0x94,0x05,0xce,0x60,
+  0x72,0xd1,0x8b,0xd7,0xdc,0x98,0x5a,0xc9,0x5e,0x17,0x76,0x91,0xe5,0x28,0x7f,0x61,
+  0xe2,0x73,0x7e,0x03,0x9e,0x0a,0xa3,0x94,0x4c,0x18,0x59,0x87,0x5e,0x14,0x32,0xf7,
+  0x37,0xe0,0x52,0x9c,0xcc,0xcf,0x64,0x53,0x81,0xa3,0x72,0x37,0xf3,0xe9,0x1c,0xab,
+  0xed,0x43,0x3e,0x93,0x6d,0xff,0xfa,0x97,0xbf,0xff,0x6f,0xca,0xbe,0x83,0xc8,0x5d,
+  0xcb,0xdd,0xf9,0x57,0x79,0x57,0x8c,0x9e,0x2b,0xec,0x24,0xf4,0xfd,0x53,0x73,0xfc,
+  0x7b,0xd8,0xbd,0xc0,0xcf,0x41,0xbe,0x8f,0x10,0xe1,0x6f,0xe5,0xed,0x56,0xd3,0xd0,
+  0x08,0x80,0x42,0x1b,0xd1,0x0a,0x39,0xe3,0x8a,0x06,0x6b,0x36,0x6a,0x76,0x9b,0xe3,
+  0xf7,0x2c,0x8e,0xfd,0x14,0xad,0x69,0xfe,0xae,0x04,0xd4,0x6b,0x8e,0xcf,0x36,0x74,
+  0x45,0xce,0x7c,0x0f,0xd8,0xb6,0x02,0xaa,0x0f,0x7a,0x25,0xf0,0x53,0x02,0xf6,0x8c,
+  0x1f,0xce,0x2b,0x01,0xf7,0x9b,0x63,0x34,0x79,0xc8,0x1b,0xf0,0x80,0x54,0x82,0x1d,
+  0x34,0xc7,0xef,0x50,0x4d,0x55,0xbc,0x3f,0x6c,0x8e,0xdf,0xaf,0xe7,0xe4,0x0d,0xf9,
+  0x91,0xaa,0x48,0xf6,0xf8,0x50,0x8d,0xf3,0x71,0x67,0x9a,0xbf,0xed,0x9d,0xc2,0x42,
+  0xcb,0xad,0x4b,0x82,0xcf,0xbb,0x68,0x2f,0xab,0xdd,0x99,0xfc,0x1d,0xe0,0x79,0xaf,
+  0x72,0x88,0xdd,0xe6,0xf8,0x69,0xb0,0x66,0x75,0x13,0xf3,0xfb,0x98,0xb1,0xb0,0x6e,
+  0x4e,0x5e,0xd1,0x39,0x0b,0x61,0x31,0x55,0xcf,0xc6,0x9b,0x98,0x86,0x73,0xf6,0xc5,
+  0x69,0xd8,0xd7,0x69,0xd8,0xbf,0x23,0x0d,0xfb,0xff,0xcf,0xd3,0xd0,0xa3,0x4b,0x3a,
+  0x67,0xaf,0xf8,0x56,0xde,0x07,0xf1,0xf3,0x0c,0x4b,0x48,0x5e,0x64,0xa6,0x62,0xa9,
+  0xe2,0x7d,0xe4,0xc0,0x99,0x1f,0x82,0x51,0x67,0x75,0xaf,0xed,0x3a,0x62,0x3d,0x8b,
+  0xd6,0x70,0x6a,0x6e,0xf5,0x6a,0xc0,0xfa,0xcd,0xf1,0xfb,0x18,0xdd,0x10,0x56,0xbf,
+  0x06,0x6c,0x1f,0x76,0xbc,0xd4,0x8b,0xd7,0x08,0xb9,0x5f,0x03,0x79,0x80,0x7b,0xe3,
+  0x30,0xe5,0x90,0x07,0x1a,0x64,0x89,0xd0,0x5f,0x54,0xbb,0xe5,0xe2,0xfe,0x33,0x55,
+  0x9c,0x8a,0xe8,0x64,0xb5,0x0a,0x6e,0x14,0xf5,0x51,0xaf,0xe7,0xc4,0x5f,0xc9,0x34,
+  0xf6,0x57,0xe9,0xb8,0x31,0x8d,0xc2,0x24,0x25,0xdf,0xff,0xf0,0xe2,0xdf,0xfd,0xe1,
+  0xdd,0x9b,0x1f,0xff,0x70,0x7a,0x72,0xfa,0xdd,0x73,0x32,0x22,0x87,0xfb,0x43,0x82,
+  0xff,0xec,0xed,0x91,0x15,0xdc,0xb2,0xe2,0x91,0x38,0xda,0x24,0xe4,0x92,0xad,0x52,
+  0xb2,0x62,0x31,0x99,0xd0,0xf0,0xb2,0x58,0xf9,0xe9,0x8b,0xf7,0x67,0x64,0x44,0xe0,
+  0xf2,0x93,0xac,0xb2,0xc7,0xa6,0x97,0x24,0x66,0xb3,0x84,0xac,0xe8,0xf4,0x92,0x58,
+  0x50,0x8f,0x1c,0x1f,0x93,0x5e,0xc7,0x26,0xbf,0x00,0x4e,0x15,0xc9,0xab,0x93,0x7f,
+  0x03,0x88,0x00,0x49,0x17,0x80,0x34,0xcc,0x43,0x15,0xf2,0xf4,0xcd,0xcb,0x1f,0x5e,
+  0xbd,0x06,0xc0,0x6d,0xe3,0xe3,0x00,0x1b,0xdb,0x72,0x43,0x68,0x40,0xce,0x5b,0x1f,
+  0xd7,0x2c,0x81,0xd9,0x69,0x39,0xa4,0xf5,0xb1,0x75,0xe1,0x28,0x99,0xcc,0x1d,0x72,
+  0xeb,0x34,0x68,0xa9,0x06,0xdf,0x78,0x00,0x3c,0xd5,0xe1,0xbb,0x08,0xbf,0xf6,0xfc,
+  0x68,0xa0,0xc1,0x43,0x09,0x82,0xc3,0x0f,0x70,0x57,0xc1,0xc3,0x72,0x9d,0xf8,0x53,
+  0xf8,0x81,0x05,0x1a,0x9e,0x1e,0xe0,0xc1,0xdd,0xb2,0x86,0x07,0x4b,0xa0,0x86,0x3f,
+  0xe5,0xdd,0x95,0xdb,0x67,0xf8,0x1d,0xb0,0x2b,0x16,0xe8,0x68,0xfa,0x80,0xe6,0x56,
+  0x92,0x02,0x9d,0x42,0x6c,0x1a,0xc1,0x01,0xd8,0x88,0x84,0x6c,0x43,0x60,0x1f,0x2c,
+  0x4a,0xac,0x16,0x5e,0x8b,0xd3,0x82,0xe0,0xf1,0x75,0xc8,0x2d,0x38,0x9c,0x4a,0xd8,
+  0xcd,0xbc,0xf4,0x43,0x66,0x81,0xa7,0x1f,0xe3,0x47,0x10,0x19,0x2e,0x8e,0x84,0x8c,
+  0xc8,0xf9,0x05,0x1c,0x23,0xa7,0x90,0xe0,0x8a,0x86,0xe4,0x88,0xb4,0x5a,0xbc,0xc4,
+  0x0f,0xbf,0x5f,0x47,0x29,0x02,0xcd,0x68,0xc0,0x23,0x22,0x63,0x62,0xc1,0xab,0x9f,
+  0xc9,0x08,0xec,0xde,0x9f,0xc9,0x31,0x1e,0x20,0xb8,0x01,0x0b,0xe7,0xe9,0x62,0x48,
+  0x7e,0x7e,0xf4,0x28,0x6f,0x02,0x2e,0xec,0x21,0x23,0x04,0x38,0xff,0xf9,0x62,0xd8,
+  0xf0,0x67,0xc4,0xe2,0x65,0xa3,0x11,0x69,0x35,0x5b,0x00,0xa9,0xb4,0xf1,0x40,0xfe,
+  0x1e,0x36,0x6e,0x09,0x0b,0x12,0x46,0xf4,0x0a,0x4e,0x8b,0x7c,0xfd,0x75,0x0e,0x05,
+  0xb5,0xf9,0x20,0xdc,0xd5,0x3a,0x59,0x58,0xa2,0xff,0x6e,0x1a,0xfb,0x4b,0xcb,0xe6,
+  0xe7,0x4e,0xca,0x80,0x04,0xca,0x6d,0x56,0xfc,0x68,0x84,0x1d,0xe4,0xde,0xfc,0x5a,
+  0x44,0x62,0xcb,0xc6,0x61,0x00,0xbe,0x4c,0xe0,0x77,0xd1,0xc6,0xe2,0xe6,0x5e,0xe2,
+  0x90,0x0a,0x42,0x97,0x67,0xc3,0x8d,0xd9,0x2a,0xa0,0x53,0x66,0xed,0xfd,0x14,0x3f,
+  0xf9,0x29,0x7c,0xf2,0xd5,0x9e,0x43,0x5a,0x2d,0x7e,0xe0,0x03,0x55,0xe3,0x68,0x03,
+  0x2c,0x7f,0x0b,0x11,0x87,0x88,0xdb,0x9d,0x45,0xf1,0x73,0x3a,0x5d,0x58,0xa2,0x31,
+  0xb8,0xe2,0xc5,0x63,0xd7,0x36,0x19,0x8d,0xc9,0xb6,0x11,0x47,0x9b,0x73,0x5e,0x7e,
+  0x41,0x46,0xa2,0xdd,0x73,0x04,0xb8,0x20,0x0f,0x46,0x23,0x30,0xe3,0xd9,0xcc,0x0f,
+  0x99,0x47,0x9e,0x14,0xde,0x0e,0x38,0x89,0xf2,0xb1,0xc6,0xd1,0x46,0x1b,0x28,0xb0,
+  0xde,0x29,0x9e,0xae,0xe4,0xc3,0xe4,0xa7,0x2d,0xf9,0x40,0x81,0xcb,0x3d,0x32,0x22,
+  0x59,0xdf,0xa6,0xd8,0xaf,0xa9,0x8b,0xec,0xef,0xfa,0xe1,0x34,0x58,0x7b,0x2c,0x11,
+  0xaf,0xdd,0x34,0x7a,0x19,0x6d,0x58,0x7c,0x4a,0x13,0x66,0xe5,0x43,0xf6,0xc9,0x88,
+  0x64,0x83,0xf5,0x43,0xef,0x05,0x74,0xd0,0x5a,0x00,0x22,0xc4,0x6f,0x2d,0xb2,0x86,
+  0x6d,0xce,0x51,0x3e,0x19,0x8f,0x48,0xc7,0x96,0x1b,0x6b,0x5f,0x62,0x12,0x27,0xc5,
+  0x19,0xba,0x73,0x5e,0xcd,0x95,0xab,0x4b,0x30,0xa4,0x04,0xd3,0xe8,0xf3,0xcb,0x2f,
+  0xe4,0xcd,0xe4,0x67,0x36,0x4d,0x5d,0x4e,0x27,0x4b,0x95,0x42,0xb6,0x9b,0x44,0x4b,
+  0x66,0x4d,0x95,0x3e,0x65,0x03,0xb6,0xb3,0x7e,0xb4,0xbb,0x19,0x31,0x0b,0x0d,0x6b,
+  0x84,0x0d,0xd9,0x06,0x58,0xe2,0x29,0x0d,0x2f,0xad,0x99,0xcf,0x02,0x0f,0xf9,0x5a,
+  0x54,0x14,0x7d,0xa0,0x49,0xe2,0xcf,0x43,0x6b,0xdb,0x48,0xe2,0xe9,0x80,0x84,0xeb,
+  0x20,0x70,0x48,0x2e,0x72,0x7f,0x78,0xf7,0x12,0x9d,0x29,0x28,0xb0,0x69,0xcc,0x48,
+  0xcc,0xa8,0x87,0x59,0xcb,0x64,0x16,0x47,0x4b,0x88,0x71,0x64,0x7a,0xad,0xbd,0x3d,
+  0x12,0xc5,0x58,0xe7,0x69,0x10,0x4d,0xe0,0xc7,0x0d,0x56,0x4c,0x02,0x7f,0xca,0x3c,
+  0x5e,0x8b,0x9f,0xfd,0x76,0x9c,0xc6,0x32,0xf5,0x97,0xfc,0x97,0xa0,0xe3,0x80,0x9c,
+  0x5f,0x38,0x0d,0x74,0x1d,0x63,0x31,0xde,0xd0,0x04,0xf1,0x18,0x6c,0x43,0x7e,0xf0,
+  0xc3,0xb4,0xdf,0x3b,0x89,0x63,0x7a,0x63,0x75,0x6c,0xa7,0xc1,0x42,0xaf,0xe2,0x0d,
+  0x4a,0x42,0x94,0x89,0x20,0xf1,0x44,0xaf,0xb8,0x7b,0x11,0xd9,0x65,0xc8,0x1f,0xde,
+  0xcc,0xce,0xe3,0x68,0x73,0xc1,0xd9,0x9c,0x25,0xe8,0x4b,0x81,0xf0,0x87,0x11,0x9e,
+  0xc4,0x35,0x04,0x4c,0xde,0x44,0xf7,0x30,0x6f,0x62,0x41,0x93,0x13,0x2e,0xc9,0x51,
+  0x7a,0x39,0x8d,0x29,0x9d,0x2e,0x18,0x87,0x7d,0x45,0x57,0x96,0xed,0x40,0x9b,0xb0,
+  0xc6,0xda,0x63,0xf2,0x36,0x8e,0x96,0x7e,0xc2,0x48,0x34,0x43,0xc2,0xe4,0x4a,0xd0,
+  0x21,0x01,0xa3,0xb0,0x16,0x19,0x44,0x0c,0x04,0x37,0x90,0xf7,0xef,0x91,0x99,0x1f,
+  0x27,0x69,0xe3,0x16,0x72,0xd6,0x71,0xce,0x60,0x4e,0x69,0x72,0x13,0x4e,0x49,0x36,
+  0xb3,0xd8,0xe5,0x6c,0x6e,0x93,0x68,0x1d,0x43,0xf6,0x35,0xde,0x64,0x06,0x6b,0x3a,
+  0x5f,0x37,0x7e,0xf2,0x43,0x1c,0x90,0x11,0x9e,0xe9,0x44,0x33,0xc2,0x21,0xb9,0xc8,
+  0x4b,0x52,0xd8,0x0c,0x09,0x71,0x9c,0xa4,0x31,0xa3,0x4b,0xc1,0xf4,0x50,0x27,0x47,
+  0x11,0xb3,0x64,0x15,0x85,0x09,0x23,0x23,0x42,0x37,0xd4,0x4f,0xc9,0x8c,0xa5,0xd3,
+  0x85,0x68,0x54,0xac,0x93,0x07,0x12,0xc8,0x8d,0x2e,0x6d,0x92,0x2e,0x60,0xe0,0x40,
+  0x8a,0xe7,0x90,0xcb,0x61,0x7d,0xf8,0x6a,0xcb,0xa1,0x6f,0x07,0xe4,0xab,0x6d,0x06,
+  0xca,0x5d,0xf3,0xb7,0x1f,0xec,0x61,0x83,0x37,0x4f,0x46,0x59,0x63,0x2e,0x9c,0x78,
+  0x2a,0x82,0x35,0x03,0xe0,0x88,0x5c,0xfe,0x6c,0x21,0x6d,0x78,0x37,0x39,0xab,0xa0,
+  0xce,0x71,0x08,0xf0,0x86,0xf8,0x29,0xa6,0x51,0x28,0x23,0x0e,0xcb,0x19,0x04,0x8a,
+  0x90,0x43,0xf0,0xf1,0x34,0xf2,0xb0,0x48,0xce,0xe0,0xf9,0x79,0xab,0xe5,0x90,0xce,
+  0xc5,0x85,0xcd,0x29,0x24,0x38,0x14,0x20,0x90,0xdd,0xa7,0x10,0x3c,0x26,0x1f,0x24,
+  0x3b,0xe4,0xda,0x0c,0xaa,0xac,0x22,0x80,0xe8,0x38,0x30,0xd5,0x67,0xd0,0x3d,0xfe,
+  0x84,0xd3,0xca,0x7f,0x16,0xb5,0x20,0xde,0x53,0x10,0xa0,0xa4,0xeb,0xa8,0xcd,0xaa,
+  0x63,0xd1,0x46,0xb2,0xa0,0x50,0xd7,0x9a,0x46,0x01,0x97,0x87,0x51,0x80,0x12,0x0b,
+  0x94,0x99,0x65,0x09,0x5c,0x63,0x2c,0xb7,0xc9,0xd7,0xa4,0x6b,0xe3,0xd4,0x77,0x65,
+  0x6d,0x16,0x7a,0xef,0x50,0x0d,0x58,0x2c,0xf4,0x84,0xa0,0xc7,0xe9,0x14,0x83,0xb5,
+  0xc5,0xb3,0x90,0xaa,0x5c,0x11,0x43,0x61,0x4e,0x0c,0x5d,0xf1,0x28,0x56,0x84,0xeb,
+  0xe1,0xdf,0x96,0x5c,0x3d,0x47,0x7c,0xf1,0xf0,0x9a,0xb6,0x9d,0xab,0xa7,0xbf,0xfb,
+  0x69,0xfd,0xed,0xf3,0x6f,0xbf,0xe5,0xea,0x49,0xd5,0x5a,0xaa,0xc6,0x42,0x5a,0x83,
+  0xb2,0x42,0x2b,0x81,0xf7,0xfe,0x92,0xdd,0x10,0x3f,0xd4,0x8c,0x38,0x1b,0xa7,0xe5,
+  0xfc,0x92,0xdd,0x80,0x96,0x32,0x29,0x16,0x15,0x1a,0xe1,0x90,0x85,0x14,0x9b,0x60,
+  0x41,0x13,0x20,0x67,0xe2,0x7e,0xb4,0x81,0x8a,0xd9,0x23,0xc5,0x47,0xce,0x65,0x82,
+  0x12,0xe4,0x58,0xb7,0x35,0x75,0x75,0x45,0x46,0x7c,0xbe,0x24,0xf0,0x13,0xb2,0x9b,
+  0x3a,0x58,0xc1,0xb6,0x85,0x79,0x20,0x54,0x27,0x1a,0x50,0x70,0x3c,0x3c,0x52,0x38,
+  0xd5,0x9d,0xb3,0xd4,0x82,0x66,0xc4,0x0a,0xe4,0x00,0xaa,0xa2,0xe1,0xbd,0xc9,0xab,
+  0xc9,0x5e,0x0f,0x85,0x7c,0xe4,0x06,0x89,0x40,0xa1,0x20,0x4e,0x04,0x62,0x07,0x1b,
+  0x45,0xf2,0x88,0x51,0x63,0x05,0xc9,0xcb,0xf6,0x10,0x25,0x30,0x2f,0x04,0xf6,0x19,
+  0x4a,0x89,0x29,0x2c,0x1d,0x5e,0x59,0x23,0x29,0x5a,0xb8,0xb6,0xad,0x2e,0x97,0x34,
+  0x5e,0x63,0xd0,0x83,0xb2,0x44,0x30,0xb8,0x28,0x5b,0x24,0xc3,0x86,0xc1,0x54,0x54,
+  0x16,0x89,0xb2,0x40,0x44,0x0f,0xc4,0xef,0xcc,0xb4,0x8d,0x25,0x04,0x17,0x1a,0x40,
+  0xb9,0x77,0x58,0x64,0xd9,0x82,0x9f,0x86,0xc3,0x7c,0xea,0xb6,0x04,0xfc,0x91,0x0e,
+  0x37,0x62,0xc8,0x6d,0x26,0xf5,0x38,0x16,0x17,0xfe,0xb2,0xc4,0xb8,0x00,0xd0,0x26,
+  0x93,0x98,0xd1,0x4b,0xc5,0x7c,0xf5,0xb9,0xf9,0xea,0x93,0x63,0x8e,0x23,0xb3,0x5f,
+  0x7d,0xcd,0x7e,0x95,0x56,0xd4,0xb9,0x7f,0x81,0x97,0xdb,0x3c,0x7a,0x24,0x26,0x12,
+  0x67,0xb1,0x73,0xdd,0x39,0xb1,0xc9,0x56,0xac,0x50,0x6b,0x15,0x25,0x78,0xb3,0x4b,
+  0x98,0xfa,0xe1,0x1a,0xe2,0x41,0x89,0xfa,0xcf,0xde,0x1e,0xf9,0x29,0x2c,0x2c,0x5c,
+  0xb1,0x64,0xf9,0x54,0xd8,0x3a,0xea,0x5e,0x0f,0x50,0x1b,0xad,0xe3,0x62,0x1b,0x7b,
+  0x7b,0xa4,0xa9,0xd7,0x3d,0x2d,0x1a,0xca,0x5c,0x9e,0x3d,0x7a,0x64,0xaa,0xeb,0x88,
+  0xba,0x0f,0x78,0x5d,0x94,0x4b,0xf2,0xa9,0xf3,0x58,0x7b,0x7a,0x06,0x4f,0x7c,0xd6,
+  0x8f,0x49,0xbf,0x6b,0x4b,0x49,0xf8,0x8b,0xd8,0xc0,0xe1,0x2b,0xd5,0xac,0x4a,0xf2,
+  0x0a,0xd0,0x35,0x64,0x30,0xbe,0x7e,0xc4,0xba,0xcb,0xc6,0x0e,0x46,0x38,0xd4,0x03,
+  0x79,0x3c,0xce,0x84,0xb1,0xad,0x11,0x57,0x9a,0x45,0xaa,0xcd,0x24,0x8c,0x22,0xae,
+  0x43,0x9f,0x48,0xe5,0x29,0xec,0x1d,0x61,0xfb,0xc8,0x97,0x50,0x46,0x06,0x02,0xc6,
+  0x11,0x26,0x0e,0x28,0x64,0x17,0x7e,0x96,0x4c,0xe4,0xfc,0x0d,0xc4,0xae,0x25,0x99,
+  0x29,0x84,0xe5,0xf8,0x1b,0xec,0x44,0xd5,0x30,0x92,0x83,0xfe,0xe5,0x17,0xd5,0x46,
+  0xd2,0xe4,0x51,0x6e,0x2f,0x29,0x16,0x91,0x0b,0x26,0x97,0xc5,0x5f,0x64,0x56,0x53,
+  0xe9,0x3d,0x14,0x67,0x96,0x93,0x93,0xdb,0x3e,0x8a,0xdd,0xc3,0x01,0xc5,0x1b,0xc5,
+  0x04,0x72,0xd0,0xb6,0x2f,0x99,0x28,0xb0,0x50,0x70,0xf7,0x02,0xee,0x27,0xdc,0xab,
+  0x3b,0xbc,0xb7,0xa8,0x9d,0xa5,0x66,0x81,0x72,0x8c,0x99,0xca,0x6c,0xdb,0x82,0x44,
+  0xe4,0x8b,0x2f,0x03,0x73,0xd1,0x8e,0xb4,0x14,0x44,0x2e,0x05,0xb8,0xa7,0xeb,0xd9,
+  0x0c,0x16,0x74,0xbe,0xbd,0x31,0x5b,0x2d,0x88,0x28,0x89,0xa7,0x0e,0xd9,0x92,0x8c,
+  0xb4,0x5b,0x82,0x9d,0x1c,0x90,0x0f,0x93,0x9b,0x94,0x25,0xa3,0xaf,0xb6,0x88,0xff,
+  0xb6,0xfd,0xd5,0x96,0x85,0x1e,0x69,0x93,0xee,0xed,0x07,0x72,0x4b,0x6e,0xef,0x6a,
+  0xec,0xc8,0x46,0x2a,0xcd,0x1d,0x61,0x85,0xdc,0xa4,0x99,0xc5,0x51,0x1a,0x71,0x56,
+  0xad,0x38,0x3c,0xb9,0x89,0xd2,0xd1,0xe2,0x12,0xe8,0x75,0x0e,0xc9,0x13,0x81,0x76,
+  0xc0,0xff,0x76,0x93,0xf5,0x04,0x31,0xa8,0x24,0x1b,0xa2,0x6d,0x0a,0x43,0x26,0xfe,
+  0x3c,0x8c,0x62,0xe6,0xa9,0xbb,0x86,0x6c,0xe2,0xa2,0x8d,0x98,0xb6,0x38,0xda,0xc0,
+  0x7c,0xa1,0x49,0xc3,0x42,0x0c,0x45,0x19,0xf1,0x29,0x41,0xab,0x17,0x55,0x51,0x8c,
+  0xf9,0xaa,0xb8,0xca,0x38,0x88,0x8d,0xb1,0x80,0x19,0x8c,0xc7,0x02,0x96,0x32,0x01,
+  0xa6,0x94,0x27,0xbc,0xae,0x23,0x31,0xe7,0x23,0x14,0x05,0xc0,0x5a,0x79,0xab,0x26,
+  0xae,0xe2,0xe4,0x46,0x06,0x47,0x83,0x5e,0x94,0x00,0x4b,0xe3,0xb3,0xdd,0x70,0xd3,
+  0x05,0x0b,0x2d,0x41,0xef,0xb1,0xbe,0xb3,0x46,0xd8,0xcc,0x3c,0x30,0xa8,0x68,0xac,
+  0x66,0x03,0xe9,0x45,0x37,0x20,0x1b,0x00,0xb6,0xc9,0x68,0x30,0x99,0x87,0xb8,0x73,
+  0x8c,0x19,0xef,0x0b,0x08,0x90,0x04,0xe3,0x82,0xef,0xcc,0x36,0x20,0x57,0x4a,0x2e,
+  0xd9,0x4d,0x62,0xd9,0x2e,0x1c,0xa5,0x5b,0x36,0xdf,0x4b,0x1a,0x89,0xa7,0xed,0xb3,
+  0xdf,0x47,0x4f,0x69,0xc2,0x0e,0xf7,0x2d,0x64,0x8a,0x5c,0x1d,0x55,0xf1,0x22,0x2e,
+  0xfc,0x09,0x72,0x9f,0x43,0xc4,0xd3,0x4d,0xca,0xde,0xcc,0x66,0x09,0x4b,0xd5,0x92,
+  0x97,0xdc,0x36,0x14,0xbb,0x09,0xe1,0x17,0x31,0xe9,0x44,0xce,0x96,0x99,0x4e,0x04,
+  0x57,0x49,0xe7,0xfa,0xa8,0xd3,0xe9,0x40,0x67,0x12,0x78,0x3c,0xc3,0x8d,0x09,0x8a,
+  0x9b,0xd3,0x05,0x8d,0xc1,0x2a,0x81,0xdb,0x46,0x83,0x1b,0x8b,0x1b,0xdb,0x05,0xc6,
+  0xf6,0x1d,0xc0,0x22,0x91,0xa0,0x28,0x12,0x44,0x98,0xa4,0x11,0xb5,0xf8,0xfe,0x49,
+  0x23,0xc2,0xb7,0x71,0xb4,0x14,0x64,0x48,0x31,0x10,0xe1,0xfd,0xcd,0x4a,0x71,0xaa,
+  0x40,0xef,0x69,0x1a,0x4d,0x2c,0x11,0x86,0x5b,0x4b,0x21,0x39,0x14,0xdb,0x3c,0xda,
+  0x44,0xd7,0xfe,0x88,0xe4,0xdc,0x07,0xe3,0x34,0x71,0xa7,0x62,0x70,0x27,0xa9,0xe5,
+  0x6b,0x0a,0x08,0xfb,0xc3,0xf9,0x4e,0xd0,0xbe,0x3c,0x06,0x50,0x50,0xef,0xa3,0xbf,
+  0x39,0x7b,0xf3,0x1a,0x79,0x42,0xd9,0xd8,0x0b,0xad,0x95,0x49,0x3a,0xa1,0x8b,0xf8,
+  0xb3,0xff,0x47,0x96,0xe9,0x1a,0x2c,0xc1,0xdf,0x8a,0x9a,0xd1,0x96,0x83,0xd4,0x32,
+  0x9c,0xeb,0xe0,0x77,0xae,0x62,0x34,0x6e,0x52,0x96,0x60,0xa6,0x63,0xca,0x00,0x9a,
+  0x92,0x11,0x58,0x4b,0x1a,0xa7,0x5c,0xad,0xac,0x72,0x64,0x37,0x73,0x0d,0x64,0xa4,
+  0x0f,0xcc,0x33,0x52,0xe8,0xe7,0x24,0x0a,0x71,0x6b,0xc5,0xc4,0x8e,0x4d,0x21,0x97,
+  0x41,0xe1,0x03,0x38,0x27,0x1d,0x54,0x91,0x04,0xe4,0xa5,0x2a,0x01,0xb1,0xa4,0x48,
+  0x40,0x2c,0x2c,0x12,0x10,0x0b,0x0d,0x04,0x54,0x38,0x91,0xa3,0xc7,0x77,0x8e,0xaa,
+  0x9f,0x35,0x7a,0x16,0xe1,0xe1,0x4d,0x11,0x5a,0x92,0x17,0x01,0x8c,0xe4,0x2d,0x62,
+  0x11,0x2f,0x1d,0x55,0xdb,0x6b,0xd4,0xe6,0x63,0x2a,0xe8,0x7b,0x8d,0xdc,0xef,0x68,
+  0xe8,0x81,0x99,0xc1,0xf8,0xbe,0x03,0x56,0x01,0x98,0xf2,0xf0,0x4c,0xc6,0xe3,0x31,
+  0x66,0x11,0x71,0x7a,0x5b,0x62,0x9f,0x09,0xaf,0xad,0x14,0x17,0xee,0xe1,0xb3,0xde,
+  0xd3,0x6f,0x1e,0x7f,0x7b,0x60,0x4b,0x50,0xa8,0x0e,0x06,0xfb,0x2b,0x9a,0x2e,0x5c,
+  0x7f,0xb9,0x0e,0xac,0x94,0xfc,0x1d,0x40,0xc3,0x7b,0xcc,0xf1,0xef,0x92,0x5f,0x08,
+  0xac,0x4d,0x80,0xb2,0x62,0xf2,0x48,0x01,0x8d,0x01,0x34,0x46,0xd0,0x6f,0x6c,0x87,
+  0x1c,0x02,0x68,0x6c,0xdb,0xe4,0xef,0x48,0x9c,0x77,0x42,0x85,0xea,0xee,0xdb,0xa2,
+  0x65,0x9b,0xec,0x91,0xfd,0xde,0xe3,0xfd,0xc7,0x87,0xdf,0xf4,0x1e,0x1f,0x0e,0x0d,
+  0x6c,0x75,0xb6,0x58,0xcf,0x66,0x01,0x03,0xc1,0xe8,0x80,0x0a,0xc5,0xd1,0x6a,0x0b,
+  0x9f,0xc6,0x72,0xa3,0x0c,0x86,0x03,0x48,0x81,0x31,0x0a,0x83,0x76,0x3b,0x97,0x30,
+  0x3f,0xcb,0xb1,0xcd,0x82,0x28,0x8a,0x2d,0xc0,0x63,0xd9,0xe4,0x5f,0x81,0xbf,0xf1,
+  0x11,0xc1,0x9c,0xec,0x73,0x1a,0xc7,0xe7,0xfe,0x05,0x4a,0xd8,0xf3,0x9f,0x2f,0x40,
+  0x60,0x9c,0xf3,0x9f,0xbc,0xc8,0xbf,0xb8,0x50,0x04,0x1d,0x8d,0x63,0xad,0xa7,0x93,
+  0xb5,0x1f,0xa0,0x9a,0x7c,0xc6,0xa6,0x97,0xb8,0x88,0xd0,0xa5,0xba,0x0e,0x81,0xb7,
+  0xe4,0x1c,0x09,0x3b,0x09,0xe2,0x86,0x46,0xa5,0x39,0xcc,0xcd,0xa8,0x59,0x92,0xed,
+  0xad,0xc2,0x4b,0xc5,0x49,0x2c,0x74,0xaf,0x98,0xcd,0xcc,0xa7,0x9c,0x08,0x64,0x92,
+  0x50,0xe7,0xae,0xeb,0xca,0xbd,0xad,0x14,0x22,0xb6,0xd0,0x5d,0x17,0x82,0x84,0xb2,
+  0xb1,0x50,0x92,0x05,0xae,0x93,0xe6,0xdd,0x3d,0x9f,0x5c,0xa0,0xfd,0xb1,0x43,0xcc,
+  0x86,0x42,0xbe,0x42,0x77,0xb9,0xdd,0x6f,0x4d,0x4a,0xa7,0x3e,0xe2,0x94,0x08,0xe4,
+  0xaf,0xad,0x39,0xa4,0x4b,0xd6,0xb0,0x3a,0x00,0x40,0x29,0xfa,0x59,0x66,0x7b,0xa0,
+  0x2f,0x4a,0x8e,0x98,0xcd,0x60,0x2b,0x94,0x19,0x67,0x33,0x64,0x28,0xfd,0xd0,0x89,
+  0x18,0x2a,0x83,0x05,0x52,0xae,0xfb,0x35,0xb1,0xf4,0x43,0xac,0x36,0xe9,0xda,0x5a,
+  0x7d,0x21,0xb5,0xce,0x18,0x03,0xce,0xc9,0x2a,0x5b,0x48,0xbe,0x98,0x4f,0x24,0x70,
+  0x54,0xce,0xcd,0x72,0x71,0x15,0x7b,0x01,0x51,0xd4,0x67,0x69,0x14,0x33,0x0b,0x42,
+  0xd0,0x75,0xc1,0x28,0x3d,0x97,0x96,0x15,0xb3,0x24,0x0a,0xae,0x98,0x43,0x62,0x06,
+  0x6e,0x63,0x6d,0xd6,0xa3,0x15,0x83,0x99,0xe3,0x6e,0x54,0xef,0xd9,0x53,0x17,0x0a,
+  0xac,0x96,0x44,0x9e,0xb4,0x1c,0xe8,0x7d,0x03,0x4a,0xdd,0x28,0x5c,0xaf,0x20,0x1d,
+  0x84,0x85,0x8c,0x79,0xdc,0xa3,0x8f,0xb8,0xf0,0x65,0xcc,0x92,0x75,0x90,0xba,0xd3,
+  0x98,0xd1,0x94,0x71,0xff,0x34,0xef,0x19,0x1e,0x82,0x25,0xad,0x1c,0x89,0xbc,0x59,
+  0x46,0x56,0x17,0xdd,0xb3,0x54,0x34,0x98,0x2e,0xc2,0x8f,0x56,0x25,0x02,0x07,0xc3,
+  0xec,0x6d,0x37,0x32,0xe0,0xce,0x91,0xf3,0x0b,0x68,0x72,0xd4,0x00,0xcb,0x31,0xe3,
+  0x1b,0xc1,0x3b,0x06,0x32,0xbe,0x63,0x78,0x5a,0x68,0xc5,0xfc,0xef,0xfb,0xd1,0x52,
+  0x54,0xaa,0x19,0x9c,0x84,0xe0,0xe3,0x43,0xf6,0x95,0x55,0x8c,0x5d,0x96,0xaf,0xf5,
+  0x5e,0x17,0xb6,0x69,0x09,0x10,0xe1,0x7b,0x31,0x00,0xe1,0xf7,0x99,0x04,0xd1,0x44,
+  0xe9,0x7c,0x71,0x78,0x62,0x87,0xa2,0x33,0x4f,0x0b,0x2c,0xf3,0x4d,0xec,0xa7,0xac,
+  0x65,0xdb,0xee,0x6a,0x9d,0x5a,0x80,0xc5,0x41,0x4f,0x98,0x6d,0x6a,0x18,0x62,0xd4,
+  0xb4,0x76,0x3f,0xa9,0xc5,0x28,0x0c,0x6e,0xa0,0xc1,0xcc,0x1b,0x66,0x6a,0x0a,0xe3,
+  0xec,0x64,0x5b,0x89,0xf5,0x79,0x43,0x43,0x64,0x16,0x6f,0xe7,0x78,0x4f,0x9e,0x7d,
+  0x17,0x0e,0xc1,0x37,0xc9,0x08,0xa6,0xfc,0x47,0x36,0x39,0x8b,0xa6,0x97,0x2c,0xb5,
+  0x5a,0x9b,0x64,0xb0,0xb7,0xd7,0x7a,0x14,0x44,0x53,0xbc,0xf4,0xd4,0x85,0x40,0x5e,
+  0xe8,0xf0,0xa3,0xd6,0xe0,0xa8,0x0b,0x9c,0xbd,0x49,0xdc,0x89,0x1f,0xd2,0xf8,0x06,
+  0x8c,0xbf,0x51,0x0b,0x6d,0x5b,0x6e,0xfc,0xb5,0xa4,0x7c,0x14,0x79,0x3f,0x23,0x2f,
+  0x9a,0xae,0x97,0x70,0x8a,0x38,0x67,0xe9,0xf3,0x80,0xc1,0xcf,0xa7,0x37,0x2f,0x3c,
+  0xab,0x25,0x00,0x5a,0x99,0x44,0x7d,0xf3,0x76,0xb4,0xfd,0xee,0xf9,0xcb,0x97,0x6f,
+  0x06,0x9d,0xeb,0x4e,0xd7,0x79,0xf7,0xfc,0xec,0xf9,0x7b,0xf8,0xd9,0xe3,0x3f,0xff,
+  0x00,0x52,0x06,0x9e,0xfb,0xce,0xc9,0x8f,0x27,0xef,0x9e,0xc1,0xcf,0x7d,0xe7,0xe5,
+  0xd3,0x3f,0xbc,0x7a,0xf3,0xec,0x39,0x3c,0x1c,0xc0,0xc3,0xd9,0xf3,0xf7,0xef,0x5f,
+  0xbc,0xfe,0xfd,0x19,0x14,0x1c,0x3a,0x67,0xef,0x4f,0xde,0xff,0x00,0xbf,0x8f,0xba,
+  0xce,0x8f,0x2f,0x5e,0xbf,0x7e,0xfe,0x0e,0x7e,0xf7,0x32,0x6f,0x1b,0x2f,0x3b,0x1b,
+  0x6d,0x3b,0x83,0x16,0x9c,0xa3,0xb4,0x9c,0xde,0xa0,0x25,0xa3,0x95,0x5a,0x4e,0x3f,
+  0x7b,0xe8,0xb7,0x20,0xfb,0x6d,0xd0,0x7a,0xef,0xb3,0xd6,0xad,0x72,0xb0,0xbc,0x49,
+  0xce,0x58,0xe8,0x59,0xae,0xeb,0xf2,0x9d,0x17,0x38,0x0a,0xac,0x4d,0x82,0x9e,0xb7,
+  0x1b,0x08,0xdf,0x67,0xa3,0xd1,0x28,0xa3,0xac,0xfb,0xe6,0xed,0xf3,0xd7,0x36,0xd9,
+  0x80,0xdf,0x32,0xf4,0x4a,0xfe,0x54,0xbe,0x77,0x83,0xb9,0xda,0x24,0x6e,0x14,0x0a,
+  0x51,0x25,0xdb,0xb2,0xa4,0x1e,0x8c,0x02,0xe6,0x06,0xd1,0xdc,0x6a,0x65,0x78,0x91,
+  0xd8,0x78,0xa1,0x0d,0x9f,0x1c,0xec,0xd3,0x9b,0xb7,0xae,0x42,0x0f,0x38,0x8c,0x95,
+  0xa1,0x13,0x10,0x05,0x07,0x01,0x6e,0x6a,0x99,0x08,0xba,0xc2,0x53,0x46,0xad,0xbc,
+  0x9f,0x97,0xdb,0x43,0xfd,0x08,0x3e,0x4b,0xc9,0x22,0x23,0x52,0x39,0xcd,0x1a,0x60,
+  0x4b,0x75,0x79,0x64,0xa9,0x59,0x75,0xd5,0x55,0xb8,0xbc,0x76,0x31,0x81,0xa8,0x0e,
+  0x43,0x11,0x36,0xc7,0x62,0xcc,0xae,0xaa,0x43,0x65,0xac,0xa0,0xe0,0xcb,0x93,0x7f,
+  0x6a,0xb1,0xe4,0x60,0xfa,0x88,0x20,0xf3,0x67,0xd7,0x48,0x00,0x26,0xaf,0x55,0xcc,
+  0xf3,0xa9,0xab,0x5d,0x84,0x2d,0x63,0x81,0xdc,0x9e,0xbb,0x60,0x00,0xb8,0xbc,0xb6,
+  0x92,0xa1,0xb3,0x8b,0x0f,0x04,0x98,0x5e,0x17,0xb3,0x76,0x76,0xd5,0x44,0x20,0xa5,
+  0xde,0xf3,0xa0,0xb6,0x46,0x0e,0x49,0xeb,0x21,0x15,0x9e,0xca,0x13,0x2a,0x6a,0x2b,
+  0x64,0x50,0x65,0xfa,0x3d,0x15,0x0e,0xfd,0x9d,0x04,0x44,0x40,0xa5,0x3e,0xcf,0x3e,
+  0xaa,0xef,0xa9,0x00,0xca,0x6b,0x4d,0xd2,0x10,0x52,0x31,0xea,0xea,0x40,0xfa,0x82,
+  0x56,0xe1,0xf5,0x8e,0xd1,0x85,0xda,0xb8,0x26,0x69,0xf8,0x9e,0xe7,0x28,0xd4,0x54,
+  0xe1,0x59,0x0c,0x5a,0x25,0xcc,0x1d,0xa8,0xa9,0x22,0x12,0xa8,0x54,0x02,0xc6,0x3b,
+  0x18,0x2f,0x56,0x18,0x4e,0xa4,0xf8,0xe1,0x9a,0xae,0xad,0xc5,0xe1,0x54,0x3a,0xe7,
+  0xc9,0x11,0xf5,0xa4,0xce,0xe1,0xd4,0x4e,0xca,0x6c,0x82,0xfa,0xae,0x4a,0xa8,0x52,
+  0xbb,0x3b,0xab,0xe6,0x60,0x05,0x39,0xb9,0xb3,0xc7,0x39,0x54,0xb1,0xbf,0x3c,0x18,
+  0x7c,0x67,0x87,0x11,0xac,0xd4,0xe3,0xdd,0x95,0x15,0xb8,0x0a,0xb9,0x5a,0xdf,0xf1,
+  0x02,0xa8,0x09,0x87,0x92,0xd5,0x7a,0x37,0x4c,0x4a,0x85,0x22,0x35,0x94,0xb0,0xf3,
+  0x9d,0x24,0xc9,0x61,0x4b,0x74,0xb9,0x23,0x9a,0x22,0x70,0x8e,0x27,0x4f,0xee,0xab,
+  0x43,0x90,0x43,0xe5,0x35,0x95,0x7c,0xbe,0xda,0x95,0x9f,0x83,0x15,0xeb,0xf6,0xef,
+  0x56,0xb7,0x6f,0xaa,0xdb,0x7b,0xcd,0xcf,0x8a,0xb3,0xba,0x1f,0xd7,0x2c,0xd7,0x28,
+  0x56,0xeb,0xa1,0xda,0x3d,0xf5,0x7e,0xa2,0x52,0x27,0xee,0x86,0xa8,0xbf,0x13,0x11,
+  0xcf,0x42,0xac,0x17,0x9d,0x2a,0x64,0xa9,0x23,0x77,0xae,0xdf,0xcf,0xea,0xc3,0x7e,
+  0xbe,0x6c,0x4d,0x41,0xf0,0x26,0x1e,0x56,0x3c,0xe3,0xd7,0x51,0x41,0x3a,0x4d,0x96,
+  0x15,0x80,0x7b,0xb9,0x42,0x45,0xd5,0xe4,0xe2,0xde,0x81,0xbd,0x3d,0xf2,0x8e,0x79,
+  0x45,0xb0,0xbe,0x06,0xc6,0xdb,0x80,0x60,0x6c,0x84,0x2b,0x06,0x2b,0x93,0x11,0xe9,
+  0x17,0x7b,0x91,0xf2,0x28,0x62,0x0e,0x8a,0xb5,0xbe,0x3f,0x51,0x9c,0xc3,0x79,0x34,
+  0x12,0x1f,0x1a,0x84,0xae,0xe6,0xa9,0xab,0x4a,0x60,0xe4,0x47,0xb1,0x89,0xcf,0x03,
+  0x3e,0x7c,0xef,0x3a,0x7f,0xa0,0x57,0xd4,0xc7,0xcf,0x17,0x1a,0x2b,0x2b,0x0c,0x24,
+  0x74,0x6c,0x6e,0x68,0xab,0x10,0x7d,0x03,0x44,0xbf,0xa5,0x45,0x66,0xca,0xc4,0x65,
+  0xe1,0x1f,0xd5,0xde,0x7d,0x2f,0x42,0x60,0x73,0xaa,0xaa,0xad,0xf3,0x8c,0x89,0x42,
+  0x69,0xbf,0x50,0x8a,0xf7,0x41,0x9c,0x46,0xcb,0x15,0x1c,0x62,0xe4,0xe7,0xf8,0xc2,
+  0xdf,0x4e,0xa1,0x5c,0xb6,0x82,0x03,0x6c,0x6c,0xc9,0xc7,0x01,0x69,0xfe,0xb8,0xa0,
+  0x10,0xc2,0x24,0x52,0xfc,0x56,0x7e,0x4a,0x03,0x08,0xa2,0xfa,0x16,0x3f,0x9e,0xf2,
+  0xa4,0xe9,0x10,0x3a,0x20,0xcd,0xb7,0x34,0xf6,0x93,0xa6,0x93,0x99,0x0c,0x03,0xd2,
+  0xfc,0x3d,0x8b,0xe6,0x31,0x5d,0x2d,0x6e,0x9a,0x10,0xe3,0xaa,0xe3,0xea,0x91,0x47,
+  0xa4,0x27,0xeb,0xee,0xeb,0xf5,0xc0,0x7b,0x62,0xa8,0x02,0xcd,0x07,0x34,0x9e,0x33,
+  0xce,0xe2,0x21,0x86,0xaf,0x92,0x68,0x1d,0xc3,0xdd,0x24,0x34,0x26,0xfc,0xbb,0x87,
+  0x12,0xe7,0xdf,0xac,0x57,0x3e,0x24,0x3e,0x6b,0x98,0xcf,0xa6,0x3e,0x0b,0xa7,0x4c,
+  0x43,0x1e,0x91,0x4d,0x1c,0xa5,0x8c,0xbc,0x8b,0x96,0x2c,0xc2,0xfc,0xbd,0xbf,0x59,
+  0x07,0x3e,0x4b,0x25,0xa2,0x1f,0xfd,0x20,0xf0,0xe9,0x92,0x9c,0x2d,0xe8,0x25,0x4b,
+  0xe0,0x9b,0x31,0x4c,0x47,0xfa,0x12,0xda,0xa1,0xe9,0x3a,0x66,0x15,0x9d,0x9e,0x2e,
+  0xd8,0xd2,0x9f,0xd2,0x80,0x24,0x37,0xcb,0x49,0x84,0x41,0xfc,0x64,0x1e,0x05,0x9e,
+  0x6c,0xe1,0x64,0xbd,0xbb,0x97,0x34,0x25,0x37,0x70,0x21,0x83,0xe7,0x7b,0xe4,0xc7,
+  0x28,0x0e,0x3c,0x48,0x6b,0x21,0x2f,0x5e,0xc0,0x49,0xa2,0xc4,0xd3,0x7d,0xbc,0x7f,
+  0xa0,0x63,0xfa,0xce,0x07,0xc7,0xc2,0x4d,0x45,0xbf,0x96,0xd4,0x87,0xc8,0xc5,0xe5,
+  0x2a,0x0a,0x21,0x5a,0x56,0xc4,0xc5,0x25,0xeb,0x50,0x22,0xfc,0xee,0xc6,0x8b,0xa3,
+  0x39,0x0b,0xef,0xd4,0xbd,0xc2,0x0c,0x45,0x53,0x46,0x43,0x12,0x85,0xe4,0x39,0x8d,
+  0xd3,0x45,0xce,0x25,0x53,0x7f,0xe6,0x4f,0xc9,0x1b,0x78,0x7b,0x77,0x6e,0xc1,0x7e,
+  0x7d,0x5c,0x63,0xe8,0x63,0x14,0x61,0x57,0xbb,0xfb,0xfb,0xd9,0xb8,0x7b,0x3b,0xf8,
+  0x27,0x22,0x2b,0x0a,0x17,0xd3,0x78,0x88,0x08,0x3e,0x83,0x42,0x5e,0xfa,0x09,0x95,
+  0xf5,0x5f,0xb2,0x28,0xa4,0xb1,0x17,0x11,0x8f,0x92,0xbf,0xf5,0xc3,0xa9,0xaf,0xa3,
+  0x3b,0x89,0xd3,0x26,0xb9,0x6d,0x5c,0x0c,0x4b,0x4e,0x9b,0x45,0xb4,0x39,0xd3,0x57,
+  0x8d,0xa5,0x84,0x96,0x24,0x60,0xc1,0xb6,0xe4,0x2b,0x87,0xe7,0x01,0x3b,0x72,0x89,
+  0xff,0x14,0xb6,0xc8,0xa3,0x46,0x61,0xd1,0xb9,0x4b,0xba,0xb2,0xf0,0x70,0xf4,0x43,
+  0xf3,0xab,0x6d,0xe2,0x7e,0xbc,0x6d,0x3a,0xf8,0x83,0xca,0x1f,0xb2,0x5f,0xb7,0xcd,
+  0x0f,0xb6,0xfb,0x73,0xe4,0x87,0x56,0xeb,0x27,0x34,0x06,0x2a,0x64,0xd4,0x16,0x0f,
+  0x4f,0xf0,0x22,0x3d,0xd2,0xe2,0xad,0xc1,0xbd,0x11,0x2d,0xa7,0x21,0xca,0xf8,0x00,
+  0x48,0xd6,0x85,0x96,0x83,0x2e,0xe6,0x81,0x38,0xaf,0xd7,0x43,0x1c,0x41,0xb0,0x42,
+  0x40,0xa9,0x75,0x3e,0x4d,0xae,0x2e,0xe0,0xf4,0x1e,0x22,0x1a,0x07,0xa4,0x05,0x67,
+  0x74,0x7b,0x80,0x97,0xdc,0xda,0x76,0xe3,0xf6,0x62,0xd8,0x00,0xe2,0x9c,0x16,0x36,
+  0x66,0x10,0xb1,0xc3,0xdd,0x8a,0xf2,0xcd,0x53,0xcc,0x6c,0x48,0x2c,0x43,0xef,0xcd,
+  0xd1,0x0c,0xe8,0x28,0xcb,0x81,0xac,0x84,0x5e,0xa9,0x7e,0xf4,0x69,0x51,0x40,0x2b,
+  0x81,0x6a,0x92,0x74,0xc0,0x3d,0x59,0x35,0x10,0x8b,0xca,0x89,0x14,0xdc,0x74,0x03,
+  0xb7,0xb1,0x89,0x22,0x4e,0x03,0xcd,0x47,0x26,0xb1,0xb8,0x92,0xae,0xd0,0x4f,0x82,
+  0x67,0xd1,0xc4,0xe2,0x3e,0x3e,0xc5,0x9b,0x81,0x05,0x56,0x0b,0x63,0x12,0xf0,0xd4,
+  0x1c,0xce,0xcf,0x71,0x0c,0x1e,0x4f,0xe7,0xc4,0xf0,0x95,0x96,0x43,0x32,0xef,0x20,
+  0x8f,0x6d,0xc0,0xf6,0x7f,0xf9,0x85,0xf0,0x60,0x0b,0x19,0xba,0x92,0xb5,0x9d,0x9d,
+  0x22,0xda,0x79,0xb4,0x4f,0x43,0xb9,0x97,0x02,0x7d,0xef,0xea,0xd4,0x97,0x7a,0x2d,
+  0xe7,0x3f,0x7b,0xc1,0x0b,0xf9,0xd4,0x97,0x4e,0xee,0xb4,0x86,0xf9,0x11,0x9e,0x2d,
+  0x1c,0x99,0x32,0x00,0x3a,0x6b,0xbc,0xc2,0xc9,0xf8,0x96,0xc5,0x89,0x9f,0xa4,0xcc,
+  0x03,0x7f,0x07,0x2e,0x13,0x4e,0x69,0xa9,0x7c,0xae,0x98,0xf7,0x56,0xb3,0xc4,0xc0,
+  0x47,0x17,0x80,0xeb,0x8f,0xce,0x31,0xb6,0xe1,0x45,0xca,0x96,0x99,0xc5,0xf3,0x5a,
+  0x33,0x98,0x94,0xda,0xfd,0x3b,0xd4,0xee,0xcb,0xda,0x40,0xea,0x62,0xcb,0xb6,0x41,
+  0x9f,0x17,0x61,0x4a,0x35,0xfb,0x6a,0xcd,0xbe,0xb9,0x66,0x9f,0xd7,0x2c,0x8f,0x57,
+  0x2a,0xe9,0xda,0x01,0x17,0x4c,0x3c,0x15,0xef,0x5d,0xea,0xe7,0x26,0x5e,0x71,0xcc,
+  0xf8,0xc2,0x2e,0x9a,0x11,0x18,0x9b,0xf1,0x22,0x4c,0x0d,0xa0,0xe5,0xc1,0x6b,0x28,
+  0xfa,0x75,0x28,0xfa,0x12,0x85,0x42,0x63,0x17,0x64,0xc7,0xa9,0xb8,0x73,0x6d,0x54,
+  0xa4,0xbe,0x04,0xed,0x57,0x82,0xf6,0x73,0xd0,0xf5,0xca,0xa3,0x29,0xc3,0x36,0x84,
+  0x43,0x06,0x24,0x8e,0x46,0x97,0x98,0x2d,0xa3,0x2b,0xc6,0x49,0x83,0x81,0xa9,0x19,
+  0xdf,0xb6,0xea,0x40,0x71,0x0c,0x98,0x8f,0x5a,0x98,0x03,0x69,0x8d,0x99,0x89,0xcf,
+  0x5d,0x84,0x1e,0xbb,0xd6,0x28,0xcf,0x5d,0x8e,0x64,0x5b,0x21,0xb3,0xb3,0xc8,0xa3,
+  0x82,0xa8,0x83,0x95,0xe8,0x22,0x55,0x55,0x34,0x99,0xcc,0x30,0x20,0x93,0x27,0xa0,
+  0x18,0x33,0x88,0x0d,0x22,0x6a,0xa3,0xde,0x52,0xa3,0xbc,0xbf,0x88,0xe8,0x56,0x88,
+  0x74,0x8a,0xd7,0xc3,0xd5,0x52,0x89,0x83,0x68,0x64,0xe2,0x45,0xfc,0x98,0x20,0x3b,
+  0x1f,0x41,0xcf,0x73,0x89,0x14,0x02,0x54,0x11,0x48,0x77,0x16,0xca,0x81,0xb8,0xd5,
+  0x67,0x25,0xe5,0x13,0xde,0x0f,0xa0,0x8b,0xe4,0x7a,0xb2,0xe5,0x3e,0x73,0xe8,0xcb,
+  0xf7,0x72,0xca,0xcd,0x32,0x0e,0xe6,0xb7,0x4c,0x30,0xbc,0xb0,0x2c,0x65,0x71,0x26,
+  0x68,0x31,0x8a,0xbc,0x28,0xb3,0x51,0x07,0xa8,0x4a,0xdc,0x6e,0xa0,0xc1,0xa0,0x56,
+  0xfa,0x02,0x52,0x5f,0xc4,0xb3,0x68,0x32,0x1f,0xa4,0x7d,0x71,0x7d,0x24,0x65,0x2e,
+  0x77,0x08,0xce,0x0c,0xcf,0x69,0xf0,0x67,0x37,0x42,0x3d,0xdf,0x5d,0x45,0x26,0xf4,
+  0x0a,0x26,0x03,0x55,0x23,0xbf,0x7b,0x54,0x9b,0x88,0x02,0xad,0xcb,0x3a,0x25,0xa7,
+  0xb4,0x70,0xbf,0x67,0x71,0x0e,0x38,0x11,0xe6,0xfe,0xab,0x3a,0xc5,0x29,0x0a,0xa0,
+  0xca,0x51,0xab,0xba,0xc4,0x29,0xca,0xa2,0x1d,0xb5,0x84,0x38,0x77,0x34,0xb1,0xeb,
+  0xa6,0x11,0x8f,0xb9,0xb2,0xec,0x5d,0x8d,0xea,0xd5,0xfb,0x86,0xea,0x18,0xf0,0xab,
+  0x6f,0x2a,0xed,0x4a,0x02,0x28,0x0b,0xb0,0x34,0x83,0xdb,0x46,0x6e,0x0a,0x17,0x10,
+  0x3a,0x0d,0x08,0x52,0x18,0x64,0xbb,0x67,0xa7,0xe1,0x7b,0xd7,0x03,0xe3,0x7e,0x95,
+  0xb3,0xcf,0xed,0x3d,0xd9,0xa0,0x6e,0x4d,0xde,0xf2,0x31,0x6e,0xfc,0xd0,0x8b,0x36,
+  0xae,0x38,0x64,0x7d,0xe1,0xc1,0xaa,0x0a,0x02,0x48,0x8d,0xb2,0xf3,0xd3,0x5c,0xb5,
+  0xd8,0x92,0xcc,0xa1,0x49,0x3c,0x96,0xbe,0xf7,0x97,0x2c,0x5a,0xa7,0xd9,0x6b,0x87,
+  0x74,0x8a,0x2c,0xe7,0x87,0x7e,0x0a,0xcb,0xdb,0xe2,0x94,0x2c,0xd9,0x34,0x43,0x2c,
+  0x7c,0x59,0x72,0xd7,0x15,0xa5,0x04,0x44,0x17,0x61,0x48,0x88,0x76,0xa5,0x1e,0x10,
+  0x90,0xbf,0x7b,0xe1,0xa1,0x76,0x28,0x79,0x2b,0x54,0x1b,0x4b,0xf1,0x58,0x40,0xcd,
+  0x61,0x03,0x1d,0x1f,0x7a,0xc4,0x89,0x62,0x10,0xa2,0x98,0xe0,0xa9,0x7a,0xb8,0x9c,
+  0x1d,0x52,0xfd,0x52,0x44,0x87,0x88,0x10,0x95,0x61,0x83,0xbb,0x42,0x78,0x44,0x08,
+  0xbd,0x86,0x0b,0x86,0xb3,0xe8,0x10,0xd9,0x5d,0x87,0x7c,0x7f,0xa2,0x84,0xdb,0x28,
+  0xa9,0x99,0x45,0xaf,0x85,0xef,0x5d,0x1b,0x0c,0x44,0x99,0xde,0x8b,0x31,0x78,0x4a,
+  0xca,0x13,0xe4,0x0b,0x7d,0x7f,0x82,0xb1,0xf9,0x05,0x1b,0x7e,0x54,0x70,0xe6,0x9c,
+  0x97,0xe2,0x40,0x2e,0xf4,0x14,0xcb,0x3c,0x7d,0x40,0x86,0x9c,0x16,0x8c,0xda,0x62,
+  0x2c,0x48,0xa6,0xe7,0xb3,0xec,0x4e,0x3d,0x5f,0x90,0xc7,0xd0,0xca,0xd3,0x1e,0xde,
+  0x7f,0x08,0x8d,0x8d,0x36,0xae,0x1c,0x34,0x58,0xf0,0xf0,0xfc,0xb1,0xf0,0xfc,0x7d,
+  0xf6,0x02,0x7e,0x88,0x3c,0xcd,0xce,0x85,0x7e,0x5e,0x23,0x70,0x89,0x3b,0xa5,0x44,
+  0x05,0xaa,0x3d,0x9d,0x64,0xc5,0x0a,0x9e,0x6e,0x86,0x87,0x5f,0x19,0x30,0x2a,0x3b,
+  0x97,0x40,0x8d,0x4c,0xa3,0xe5,0x04,0xa2,0xe0,0x5b,0xe4,0x89,0xae,0x0e,0x1a,0x03,
+  0x02,0x63,0x73,0x33,0x70,0xd1,0xc6,0xb4,0xf0,0x7c,0x4a,0x53,0xe5,0x15,0xfc,0xd4,
+  0xd0,0xe4,0x71,0x3d,0xb8,0x0b,0x97,0x24,0xc0,0x1d,0x37,0x1f,0x85,0xba,0xc9,0xe6,
+  0x5d,0xc5,0x40,0x2f,0x74,0x54,0xb1,0xd0,0x63,0xf1,0x19,0xfb,0xc8,0x7d,0x57,0xa5,
+  0x5d,0x20,0xbc,0xb5,0x16,0xbe,0xc7,0x4e,0x24,0xa9,0x20,0x81,0x45,0x46,0xb3,0xe7,
+  0xbc,0x28,0x0c,0x1f,0x69,0x12,0x08,0xed,0x80,0x68,0x1f,0x3d,0xca,0x1a,0x11,0x3e,
+  0x40,0x2a,0x37,0x7f,0x1f,0x69,0xc6,0x2f,0x2a,0x63,0x7a,0xd7,0xf7,0xdf,0xea,0xc9,
+  0xfa,0xaa,0xec,0xca,0x0c,0x14,0x6e,0xea,0xb0,0x8f,0xa8,0xd7,0xb3,0xde,0x64,0xdd,
+  0x05,0x5f,0x67,0x48,0xaf,0xfc,0x39,0x05,0x09,0x08,0x47,0xf2,0x0b,0x1f,0x6f,0xd5,
+  0xf2,0x13,0x02,0x17,0xf3,0x6f,0x68,0x82,0xed,0x88,0x61,0x71,0xe3,0x57,0xfa,0xed,
+  0x18,0x77,0xf3,0x0e,0xe0,0x40,0xd1,0x81,0x4b,0x83,0x56,0x2c,0x86,0x5b,0xb6,0x5b,
+  0x8a,0x09,0xdd,0x12,0xe9,0x35,0x03,0xf2,0x91,0xba,0x1f,0xb9,0xc3,0x24,0xab,0x97,
+  0x1f,0x07,0xde,0xa9,0x3a,0x2d,0x54,0xcf,0x4e,0xfe,0x76,0xd7,0xfe,0xf0,0xd5,0xd6,
+  0xf7,0xae,0x1f,0x75,0x6f,0xc9,0x1e,0xf9,0x6a,0x9b,0x4d,0x1e,0x04,0xfb,0x83,0xd3,
+  0x45,0x8c,0x2b,0x0b,0x79,0xe3,0xcf,0x79,0x96,0x1c,0x7f,0x76,0x45,0xcb,0x90,0x8d,
+  0x22,0x4a,0x64,0xbb,0x4a,0x11,0xcf,0x26,0x7a,0x50,0xcc,0xcf,0xd2,0x51,0x9c,0x17,
+  0xea,0x43,0xd4,0x9f,0x5a,0x1f,0xb5,0x82,0xcc,0xa9,0xca,0x78,0x10,0xcd,0xeb,0xe7,
+  0x81,0x8b,0x97,0x3d,0xc0,0x59,0xb6,0xd8,0x3f,0x58,0x2d,0xb0,0x1b,0xc1,0xb0,0xcd,
+  0x0e,0x1d,0x0b,0xdb,0x98,0x96,0x72,0x4d,0x5c,0x4b,0xb2,0xc5,0x47,0x9a,0x2d,0x38,
+  0x64,0x32,0xf5,0x7c,0xb5,0x50,0x5f,0x01,0x1d,0x16,0x00,0xcb,0x9d,0xe1,0x77,0x1f,
+  0xb5,0x54,0xe5,0x57,0x55,0x85,0x7a,0x9e,0x06,0x5f,0x58,0x5b,0x63,0xc8,0x63,0xdc,
+  0x36,0x94,0x15,0x02,0x4b,0x04,0x23,0x27,0xc9,0xef,0x72,0x7d,0x60,0x6b,0x71,0xfa,
+  0x5b,0x20,0x5c,0xb9,0x8a,0xae,0x3d,0x76,0x54,0xd7,0x74,0xb2,0x5c,0x20,0x56,0x76,
+  0x47,0xb0,0x94,0x02,0x59,0x01,0x97,0x77,0xfc,0x00,0x18,0xde,0x79,0x42,0x0f,0x41,
+  0xde,0xa0,0xda,0x2e,0x79,0x42,0xc4,0x00,0x08,0x5e,0xf8,0x9d,0x11,0x28,0xaf,0x31,
+  0x26,0x1d,0x01,0xd5,0x46,0x28,0xad,0x3e,0xdf,0x7c,0x84,0x22,0xa3,0xad,0x4e,0xff,
+  0x19,0x6c,0x57,0x35,0xb8,0x25,0x0f,0x0a,0xb2,0x87,0x0d,0xe0,0xb0,0x1f,0xf1,0x8b,
+  0x3a,0x00,0xf4,0x85,0x38,0x4c,0x09,0x60,0x84,0xb4,0x05,0xb2,0x6d,0x64,0x74,0xcc,
+  0x4e,0xca,0xd5,0x3b,0x10,0x62,0x76,0x55,0x80,0x92,0x07,0xf0,0x0a,0x14,0x3f,0x2f,
+  0xe7,0xad,0x58,0xe5,0xe5,0xc0,0x5f,0xef,0xee,0xac,0x5e,0x4b,0xdc,0x9a,0x9c,0xc8,
+  0x7a,0xe4,0x09,0x69,0x29,0x77,0x2d,0xb6,0x20,0x39,0xb3,0x72,0x74,0xd2,0x60,0x83,
+  0x43,0x2c,0xec,0x91,0x72,0x88,0x67,0x20,0x23,0xff,0x70,0x51,0x2b,0x73,0x4f,0xf4,
+  0x77,0xc2,0x99,0x1d,0x0e,0x4a,0x0f,0x4c,0x00,0x79,0x3f,0xc4,0x09,0x9d,0xd9,0x03,
+  0x82,0x2f,0xb3,0xae,0xd4,0x81,0xf6,0x05,0xa8,0xd2,0x2e,0xf5,0xbc,0x33,0xf1,0x39,
+  0x15,0xbe,0x63,0x96,0xab,0xe2,0x81,0x99,0x04,0x39,0x99,0xe5,0xe0,0xaa,0xc9,0x85,
+  0x72,0x41,0x7e,0xac,0x25,0x97,0x0c,0x0f,0xcc,0x44,0xab,0xc3,0xdc,0xdf,0x8d,0xb9,
+  0x78,0x64,0x25,0x13,0x55,0x15,0x63,0x00,0x26,0xa5,0x3c,0xd8,0xfa,0xa9,0x56,0x1b,
+  0xa9,0x9f,0x6c,0x15,0xb2,0xe2,0xfc,0x4c,0xa5,0xfb,0x06,0xce,0x35,0xe1,0x16,0x7c,
+  0x8b,0xa3,0xcd,0xe8,0xae,0xd5,0xcd,0x4d,0x12,0x4c,0xd5,0xe2,0x67,0x81,0x28,0xa6,
+  0xb2,0x93,0xc3,0x22,0x9b,0x40,0x4a,0x4e,0xf1,0x48,0x54,0x15,0x1a,0x18,0x39,0xe8,
+  0x90,0x9e,0x53,0x82,0xb2,0xb5,0xcb,0x56,0x0c,0x8d,0xf5,0x95,0xc6,0xfa,0xf7,0x69,
+  0xac,0x6f,0x6e,0xac,0x62,0x59,0x18,0xa5,0x9e,0x71,0xfa,0x7e,0x13,0xa9,0xa7,0xec,
+  0xf1,0xa4,0x53,0x80,0x4b,0xbf,0x21,0x5c,0xf2,0xd0,0xed,0xf1,0xed,0x9e,0x08,0x25,
+  0x02,0x56,0x7c,0x0e,0x5f,0x21,0x81,0x16,0x19,0x74,0xa3,0x35,0x85,0x6b,0x4e,0x5b,
+  0x0e,0x8a,0x4c,0xde,0x2a,0x04,0x29,0xd5,0x00,0x82,0x88,0xd4,0xba,0x57,0x0d,0xaa,
+  0x8a,0x4e,0x5e,0x05,0x62,0x65,0x6a,0x2a,0xc0,0xd8,0x01,0xe4,0x94,0x47,0x62,0x60,
+  0x30,0xab,0x7a,0x2d,0xd0,0x82,0x86,0x5e,0xc0,0xf8,0xfc,0xe2,0xfd,0xac,0x0a,0x3b,
+  0x0a,0xb3,0x3c,0x8b,0xbe,0xcc,0xec,0x66,0x9d,0xbd,0x31,0xbf,0x38,0x79,0xce,0x3f,
+  0xf2,0xf5,0x5a,0x44,0x06,0x83,0x55,0x84,0x5f,0x67,0x11,0x87,0xf0,0x40,0x3d,0x48,
+  0x7e,0x8c,0x56,0x6f,0xe3,0x68,0x45,0xe7,0x94,0xc7,0x73,0x0e,0x1b,0xe5,0x85,0x20,
+  0x36,0xed,0xb7,0xda,0xca,0xac,0x1e,0x61,0x79,0x04,0xca,0xda,0x28,0xac,0xda,0x4f,
+  0xc1,0xd2,0x47,0x2c,0x78,0x56,0x0e,0xd7,0x69,0x02,0x6b,0xc4,0xe2,0xe8,0x3f,0x79,
+  0x19,0x85,0xf3,0xb7,0x31,0x0f,0xfe,0x96,0x67,0xe4,0x34,0xf6,0x0c,0xed,0xa4,0xd1,
+  0x7a,0xba,0xc0,0x5d,0x70,0xcb,0x29,0x52,0xd4,0x84,0x26,0x6f,0x0b,0x37,0xee,0x25,
+  0x8e,0xd4,0x2b,0x71,0x61,0xa7,0xeb,0x55,0xe4,0xd6,0xa3,0x4e,0x87,0xa7,0x8f,0x1e,
+  0x75,0x3a,0xcb,0x84,0x04,0x11,0x38,0x4b,0xa0,0x12,0x1a,0xa6,0x75,0x7d,0x65,0xa1,
+  0x57,0xea,0x29,0xc6,0x52,0xcb,0x9e,0xe4,0x3d,0x14,0xb1,0xea,0x75,0xd8,0x60,0x21,
+  0x7e,0x19,0x74,0x72,0xc2,0xca,0x5c,0xf9,0x40,0xa1,0x09,0xba,0x54,0x8b,0xe4,0x40,
+  0xb4,0xc2,0x0f,0x54,0x46,0x7c,0xc9,0x6e,0xbc,0x68,0x03,0x37,0x71,0x01,0xca,0x6c,
+  0xd7,0x80,0x89,0x9b,0x5c,0x0a,0x9e,0xc4,0x71,0xb4,0x79,0x07,0x5e,0x9b,0x16,0xe6,
+  0xfa,0x97,0x59,0x5c,0x98,0x49,0x90,0xb4,0x91,0xc9,0xd1,0x22,0x82,0x97,0x6c,0x56,
+  0x5d,0x9f,0x1b,0x50,0x55,0xf5,0x49,0x0b,0x76,0xcf,0xcc,0xcd,0x2e,0x8f,0x68,0xe1,
+  0x05,0xcc,0x95,0xd8,0x0a,0x14,0x20,0x9c,0x02,0xda,0xb1,0xb4,0x90,0x9d,0xf9,0xa2,
+  0xff,0xd2,0x96,0xcf,0x5d,0xf4,0x96,0x49,0xbb,0xe7,0x18,0xee,0xa1,0x93,0x76,0x20,
+  0x6a,0x94,0xad,0x1d,0x4d,0x29,0xab,0xca,0xe4,0x37,0x20,0x45,0x85,0x0a,0xd3,0x6c,
+  0x94,0x84,0xa5,0x10,0x4d,0x85,0xed,0x17,0x0c,0xfd,0x92,0xb6,0xbb,0xd5,0xa7,0xb2,
+  0x28,0xe6,0xa5,0x9f,0x3b,0x0b,0xe4,0xac,0xdf,0xe5,0xe9,0x64,0xb8,0x0f,0xb2,0xd2,
+  0xfe,0x2f,0xc3,0x04,0x61,0xae,0xef,0x23,0xe5,0x68,0x0a,0x2f,0xa3,0xf9,0xf2,0x2a,
+  0xbb,0x2a,0x2a,0xaa,0x26,0x22,0xaa,0xf6,0xac,0x2f,0x3b,0x63,0x2a,0x07,0x4d,0x95,
+  0x03,0xa6,0x2a,0x8c,0xbd,0xca,0x16,0x8a,0x07,0xb5,0x3b,0x00,0xf3,0x13,0x59,0xb3,
+  0xb5,0x54,0x63,0x18,0x95,0x27,0x71,0x68,0x60,0xaa,0xaa,0x53,0x3c,0x91,0x83,0xb1,
+  0x64,0x49,0x42,0xe7,0x6c,0xc4,0x46,0x63,0x4c,0xed,0x78,0x60,0x31,0x17,0xbc,0xec,
+  0xc4,0x0f,0x93,0x14,0x02,0xbb,0xa2,0x19,0x39,0xc9,0x2f,0x3d,0xb0,0x8b,0x5e,0xb4,
+  0xc9,0xa8,0x90,0xe4,0xc1,0xab,0xdb,0x0e,0xf1,0x46,0x5b,0x74,0xce,0x5b,0x93,0xf3,
+  0xce,0xc5,0x68,0x34,0x7a,0xf3,0xd6,0xe5,0xd9,0x2a,0x5f,0x7f,0x3d,0x11,0xdb,0xe5,
+  0xd1,0x68,0xd4,0xb3,0xb7,0x0d,0xcf,0xcd,0xd2,0x3b,0x46,0x0f,0x1e,0x58,0x93,0xf3,
+  0xee,0xc5,0xd7,0x90,0xa3,0xe6,0x89,0xb8,0xc8,0xfe,0x69,0xe9,0x75,0x0f,0x5f,0xe7,
+  0x31,0x84,0x65,0x08,0xf8,0x1e,0xd5,0xad,0x10,0x2d,0x4a,0x17,0x78,0x42,0x8c,0xa1,
+  0x0b,0x7c,0x21,0x8f,0x44,0xc2,0xcc,0x39,0xe0,0xb8,0xf8,0xe5,0x17,0x9e,0x34,0x23,
+  0x30,0x6d,0x35,0x9f,0x9d,0xa5,0x74,0xfb,0xc1,0x68,0x94,0x7b,0x92,0xb6,0x85,0x97,
+  0x36,0x2e,0x2d,0x48,0x05,0xe2,0x4b,0x01,0x8c,0xa8,0x51,0x2b,0xba,0xcc,0xd1,0x1a,
+  0x5e,0x4f,0xa8,0xd7,0x2a,0x4b,0x04,0xd1,0xae,0x61,0xdc,0x85,0x1e,0x68,0x69,0x34,
+  0x4a,0x34,0x6f,0xd6,0x29,0xf0,0x44,0x1a,0x11,0xd9,0xd9,0xe8,0x38,0x45,0x4c,0x43,
+  0xe3,0x6f,0xbe,0xfe,0x5a,0x81,0xe1,0x84,0xb2,0xf9,0xa9,0xb1,0xe8,0xb2,0x7c,0x5d,
+  0x92,0x03,0x7c,0x83,0xb7,0x4b,0x08,0xa8,0xfb,0xfb,0x8c,0x54,0xbf,0x89,0x1f,0x44,
+  0x0c,0x18,0x84,0xc3,0x09,0x77,0x1e,0x6d,0x1b,0xc9,0xc6,0x07,0x87,0x93,0x56,0x8a,
+  0x5e,0xb2,0x84,0x09,0x2f,0xd2,0x20,0xb3,0x07,0xc4,0xa5,0x43,0xfc,0x1d,0xba,0x44,
+  0x06,0x99,0xae,0xd7,0xde,0x89,0x5c,0x82,0x41,0x49,0x77,0x0b,0xa8,0x5b,0x6e,0x1c,
+  0xab,0x39,0x41,0x3b,0xac,0x7f,0x8c,0x4c,0xaf,0x32,0xff,0x8d,0x00,0x22,0xe3,0x4e,
+  0xc6,0xd3,0xdf,0x47,0x6d,0xdc,0x03,0x57,0xb5,0xd6,0x80,0x4e,0x99,0x0e,0xc7,0xc4,
+  0x61,0x9a,0xf9,0xdc,0xec,0x8e,0x19,0x4b,0x2d,0x71,0xf5,0x06,0xde,0x45,0x5a,0x8c,
+  0x5f,0xbe,0x13,0x16,0x11,0xb3,0x6c,0x44,0xa4,0xc6,0x33,0xdf,0x0d,0x59,0xbf,0x06,
+  0x59,0xff,0x4e,0xc8,0x8a,0x1b,0x6b,0x05,0x57,0x79,0x67,0x5e,0x48,0x36,0xb8,0xcf,
+  0xd4,0x56,0xcd,0x48,0x25,0xc6,0xea,0x09,0xc6,0xdb,0x41,0x2a,0xf0,0x89,0xd4,0x72,
+  0xb6,0x11,0x01,0xe5,0x59,0x74,0xd0,0x3d,0x27,0x38,0xcf,0x52,0x67,0x1b,0x31,0x2d,
+  0xf7,0xc4,0x56,0x98,0x68,0x0d,0x61,0xff,0x93,0x10,0xf6,0x2b,0x11,0x6a,0xd1,0xeb,
+  0xbb,0x71,0x56,0xcd,0xb9,0xad,0xce,0xb0,0x12,0x95,0x2f,0xc8,0xa9,0xbe,0x2d,0x84,
+  0xde,0xe7,0x54,0xd2,0x80,0xfa,0x25,0xa0,0xbe,0x00,0x32,0x44,0xdd,0x6b,0xe3,0xe0,
+  0x6e,0x1c,0xf3,0x5a,0xad,0x48,0xcf,0x14,0xbd,0x74,0x94,0xce,0x38,0x4a,0x9b,0xc2,
+  0xa8,0xd9,0x7d,0x6c,0x5e,0xd1,0x6e,0x65,0x54,0x43,0x99,0x64,0x2d,0x53,0xae,0xe8,
+  0x5d,0xc2,0x2e,0xcc,0xf4,0x6d,0x55,0xa5,0x99,0xde,0x13,0x65,0xbf,0x0a,0x65,0xff,
+  0x7e,0x28,0x4b,0xec,0x53,0x76,0xcf,0xe9,0x68,0x14,0xea,0x56,0x49,0x60,0x3d,0x7a,
+  0x49,0xf0,0x9d,0x39,0x8c,0xcb,0x40,0xef,0x42,0xbc,0x62,0xb6,0x5e,0x77,0x21,0xd0,
+  0xa8,0x5c,0x40,0xd2,0xbf,0x33,0x92,0x7e,0x25,0x12,0x8d,0xbf,0xcd,0x78,0xca,0x6b,
+  0x51,0x09,0x4d,0x43,0x3a,0xc0,0x31,0xa2,0xbc,0xc5,0xc6,0xb8,0x3c,0xf5,0x08,0xc8,
+  0x57,0xf2,0x1a,0xc7,0x3c,0x7c,0x52,0xd0,0xc3,0x8c,0xa8,0xb0,0x92,0x0b,0xe1,0x94,
+  0x3d,0xb9,0x76,0x54,0x7c,0xfd,0x5a,0x7c,0xfd,0x3a,0x7c,0x7d,0x03,0x3e,0x85,0x4a,
+  0x2a,0x4a,0x83,0x88,0x28,0x8c,0x54,0xf7,0x06,0x17,0x37,0xc2,0xc2,0xbe,0xf9,0x56,
+  0xcd,0xfe,0xd6,0xe6,0x40,0xe4,0xf6,0x0f,0x1b,0xc5,0x1b,0x03,0xc4,0x59,0xa0,0xb8,
+  0x66,0x01,0xee,0x53,0x35,0x1c,0xbd,0x63,0xa5,0x2c,0x88,0x0c,0xaf,0x95,0xc8,0x4f,
+  0xdf,0xab,0x03,0xe5,0x2f,0xee,0xb6,0x2b,0xac,0x4f,0xf6,0xa9,0x4f,0xf4,0xb9,0xff,
+  0x76,0xb6,0x32,0x9b,0xc9,0x98,0xc9,0x94,0xe5,0x2c,0x55,0x6d,0x5d,0xcd,0x99,0x5d,
+  0x8d,0x9a,0xc4,0xad,0x46,0x4d,0xb6,0x56,0xc3,0x98,0xa1,0xf5,0x7f,0x34,0xb4,0xb7,
+  0x62,0x93,0x2c,0xd3,0xc9,0x5d,0xdc,0x2f,0x7c,0xf7,0xfe,0xd5,0x4b,0x79,0xe5,0x7d,
+  0x9e,0xa0,0x5e,0x6d,0xd1,0x98,0xb7,0xd2,0x86,0xc8,0xcf,0x0a,0xcb,0x18,0x83,0x5f,
+  0x95,0x4c,0x5e,0x93,0x21,0xbf,0x80,0x8b,0xf3,0x32,0xff,0x34,0x5e,0x72,0x81,0x5b,
+  0x74,0xbb,0x14,0xec,0x52,0x84,0xb0,0xd0,0x1b,0x98,0xcb,0xe5,0x99,0x48,0xca,0x57,
+  0x6f,0x91,0xbc,0xc2,0xbb,0xed,0x21,0x11,0x27,0xc5,0xd0,0xcf,0x44,0xc8,0x2e,0xfc,
+  0x5d,0x11,0x1b,0x53,0xbd,0x2c,0xee,0x49,0xcd,0xb2,0xc5,0xc9,0xa3,0x6a,0x78,0x40,
+  0x4d,0x71,0x49,0xdf,0x39,0xa2,0xa6,0x76,0x59,0xa3,0x2a,0xcb,0x33,0x3d,0x30,0x7b,
+  0x22,0x9a,0x71,0xa8,0xcc,0x8f,0x8c,0xc3,0x77,0x21,0x61,0x85,0x7b,0x1a,0xf3,0x9c,
+  0x15,0x99,0x68,0x01,0x71,0x4b,0x78,0x99,0xd7,0x8f,0x7e,0xba,0xb0,0x5a,0x3c,0xc6,
+  0x16,0xcf,0x2b,0xa9,0x87,0xe3,0x7c,0x1f,0xc1,0x10,0xad,0x0c,0xd8,0x21,0xad,0xd7,
+  0x51,0x0a,0xdf,0x70,0x85,0xaf,0x3b,0x60,0x5f,0x84,0xa6,0x11,0x39,0x19,0xb7,0x5a,
+  0x04,0x30,0x7e,0x2a,0x63,0x64,0xcc,0xac,0xc1,0x94,0x0a,0xf5,0x42,0x42,0x88,0x9f,
+  0x21,0x63,0x1e,0xb6,0xad,0xc7,0xbe,0x89,0x0c,0x87,0xbc,0xc7,0xf2,0xb2,0x66,0xde,
+  0xe1,0xc2,0x05,0xce,0x7f,0xd8,0x9b,0x3b,0xe0,0x62,0x56,0xef,0x74,0x9e,0xfc,0xb4,
+  0x81,0xd2,0x00,0x64,0x68,0xe0,0xa6,0xd1,0x0f,0xab,0x95,0x72,0x4b,0xbf,0x29,0x90,
+  0xbc,0x94,0x50,0x92,0x93,0xa0,0x10,0x52,0xfc,0x5a,0x89,0x28,0xc6,0x4f,0x8a,0x80,
+  0x6f,0xba,0x92,0x7c,0xf2,0x9a,0x4e,0x1c,0xee,0x6d,0x16,0x2e,0x95,0x7c,0x70,0x48,
+  0x4b,0x5c,0xc0,0xd3,0xc2,0x8b,0xc9,0xd5,0xeb,0x71,0x94,0xfa,0x48,0xb6,0x3b,0xa9,
+  0x05,0x40,0xa1,0xb1,0x8f,0xa6,0x14,0xb2,0x58,0x8f,0xba,0x89,0xce,0xbb,0xa7,0xcd,
+  0xf6,0xed,0x7d,0x83,0xc2,0x4e,0xcf,0xfe,0x56,0x65,0xdd,0xea,0x26,0xb1,0x5a,0xb1,
+  0xad,0x5d,0xc1,0xfe,0x82,0x67,0xbe,0x44,0x10,0x7f,0x21,0x9e,0xbd,0xa0,0xcc,0xcb,
+  0xfd,0xe6,0xdd,0x16,0x9e,0x45,0x0c,0x66,0x4d,0xd7,0x49,0xce,0xc0,0x81,0xaf,0xe6,
+  0x22,0xf3,0x8e,0x88,0xfd,0x0f,0xd8,0x6d,0xe8,0x34,0xf5,0x73,0x5f,0x18,0x5e,0x15,
+  0x0d,0x18,0xb0,0x58,0x15,0x3e,0x1f,0xbe,0xda,0xca,0xe6,0x4c,0xcc,0x8f,0x17,0xbe,
+  0x8a,0x5e,0xdc,0x7e,0x50,0x04,0x18,0x5d,0xc1,0x85,0x9c,0xa7,0x0b,0x3f,0xf0,0xac,
+  0xc0,0x2f,0x7b,0x27,0xca,0xf4,0x52,0xc2,0xa3,0x64,0x61,0xad,0xa8,0x53,0xee,0x02,
+  0xa9,0x56,0x30,0xc5,0x7b,0x5b,0x6a,0x31,0x6a,0x2e,0xa1,0x15,0x05,0x43,0x41,0xd0,
+  0xac,0xb6,0x9a,0xf1,0x42,0x97,0xbb,0xfa,0x05,0x80,0x16,0xdf,0xe7,0x23,0xd9,0x45,
+  0x86,0xc2,0xf0,0xcc,0x34,0x28,0x37,0x58,0x43,0x86,0x02,0xc6,0x3b,0xd1,0xa0,0x50,
+  0x67,0x17,0x01,0xaa,0xdd,0x18,0xe6,0x15,0x92,0xc7,0x4b,0x4b,0x85,0x32,0xad,0xce,
+  0xb3,0x51,0xef,0x93,0xd1,0x39,0xb7,0xfa,0xfb,0xd2,0xf2,0x13,0x8e,0xf0,0x65,0xea,
+  0x36,0xff,0x9e,0x08,0x7c,0xac,0x68,0x0f,0x3e,0x33,0x52,0xf5,0xa5,0xc9,0xd7,0x11,
+  0x04,0x51,0xfa,0xfc,0x2b,0xe2,0xdc,0x12,0xe0,0x4a,0xd9,0x25,0x6f,0xe1,0x9b,0x16,
+  0x8c,0x88,0xaf,0x7f,0xe5,0xef,0x37,0x7e,0xba,0x20,0x85,0xa4,0x54,0xc8,0x48,0x5e,
+  0xd2,0xd4,0x95,0xdf,0x92,0xfa,0xa0,0x06,0xa9,0xc2,0x91,0x38,0xff,0x00,0x55,0xa2,
+  0xe8,0x7e,0x33,0x01,0x44,0x4c,0x20,0x5f,0xee,0x69,0x94,0xd2,0x40,0xcd,0x27,0x57,
+  0xe0,0x63,0xe6,0xad,0xa7,0xcc,0xb2,0x92,0xf5,0x12,0xc3,0x80,0xf1,0x64,0x36,0x59,
+  0x2f,0xc9,0x23,0x78,0x52,0xc2,0xd0,0x79,0x18,0xbe,0xda,0xfe,0xa3,0x3a,0x2a,0x12,
+  0x11,0xd6,0xdc,0xa6,0x41,0x50,0x4f,0x51,0xc8,0x05,0x98,0xa3,0xa1,0x3c,0xc0,0xaf,
+  0xf9,0xd0,0xb8,0x0d,0x37,0xe2,0xf9,0x20,0x8c,0xba,0x47,0x1d,0x8f,0xcd,0x1d,0x12,
+  0xcf,0x27,0xd4,0xea,0x1e,0x1c,0x38,0xbd,0xde,0x01,0xdc,0x92,0xe5,0xb8,0x3d,0xb8,
+  0xf5,0xb2,0x5c,0xdc,0x3d,0xb0,0xc1,0x97,0x1b,0x41,0x82,0x58,0x5b,0x9b,0x2b,0xf8,
+  0x58,0x7b,0x98,0xb6,0x7b,0xfc,0xc3,0xa0,0xd0,0x6b,0xd1,0x29,0xfc,0x32,0x27,0xbf,
+  0xd2,0xb4,0x7b,0x04,0x1f,0x13,0xe5,0x1f,0x1c,0x6d,0x4f,0xa2,0x34,0x8d,0x96,0x03,
+  0xb2,0xbf,0xba,0x1e,0xc2,0x77,0xe2,0xff,0xfe,0xbf,0x93,0x53,0x3e,0x26,0xfc,0xf0,
+  0xe5,0xa9,0xf2,0x31,0xd1,0xfc,0x3b,0x66,0x06,0x9c,0xbd,0xea,0x0f,0x94,0x7e,0xb5,
+  0xd5,0xa7,0xe6,0x96,0x4f,0x55,0xae,0xde,0xf0,0xfb,0x30,0xe4,0xab,0x6d,0x69,0x82,
+  0x6f,0xb5,0x8f,0x99,0xaa,0x9f,0x1f,0xfb,0x80,0xc1,0x33,0xfa,0x34,0x15,0x53,0x0c,
+  0x94,0x34,0xa5,0xba,0x75,0x00,0xc7,0x48,0x6d,0x29,0xdf,0x47,0xcd,0xac,0x1b,0x79,
+  0x1a,0xd3,0xed,0x27,0xd1,0x52,0x41,0x84,0x48,0x3e,0x87,0x80,0x7a,0x26,0x6e,0xd1,
+  0x7a,0x29,0x90,0x46,0x26,0x6a,0xa3,0x69,0x58,0x25,0x19,0x14,0xda,0x15,0xa0,0xb4,
+  0x0b,0x44,0x4e,0x82,0x00,0x54,0x9d,0x42,0xb0,0x96,0x9d,0x85,0x46,0xc3,0x02,0xc0,
+  0x08,0x87,0x49,0x1a,0xd6,0x1c,0x1f,0x58,0x4a,0x1c,0x04,0x40,0x9a,0x82,0xf5,0x94,
+  0x75,0xc4,0x23,0xf6,0x40,0xae,0x08,0x46,0xf4,0x94,0x93,0xdf,0xa9,0x96,0xf4,0x97,
+  0x85,0x14,0x67,0x66,0xb8,0xfc,0x04,0x47,0x1a,0xe2,0xf1,0x60,0x22,0x76,0x24,0x21,
+  0xe6,0xc2,0x22,0x4e,0x31,0x14,0x4b,0xcd,0xa7,0xe6,0xb9,0xc5,0x65,0x0f,0x95,0x04,
+  0xc6,0xe8,0xb1,0xa9,0xf2,0xe0,0x10,0x3f,0x91,0xbd,0x93,0x1b,0x5e,0x29,0xa7,0xf3,
+  0x37,0x3c,0x5e,0x59,0xdc,0xb9,0x55,0xd8,0x71,0x7e,0x78,0xe5,0x5f,0x43,0x32,0x53,
+  0x3e,0xb7,0xa8,0x6d,0x8a,0x8c,0xab,0xe7,0x38,0x88,0x89,0x75,0x48,0xcb,0x06,0x43,
+  0xa3,0xbc,0xc1,0xcf,0xd3,0x2c,0x86,0x8d,0x52,0xde,0x8f,0xe8,0xb9,0x76,0x89,0xa8,
+  0x48,0x3b,0x92,0x84,0xac,0xea,0xad,0xd6,0x47,0x4e,0xcc,0x72,0xe3,0x1a,0x50,0x4e,
+  0xf5,0xbc,0x1f,0xe7,0x2a,0xc4,0x85,0xb9,0x27,0x8d,0x92,0x31,0x30,0x94,0x51,0xce,
+  0x98,0x73,0x51,0x11,0xd7,0x57,0x31,0x71,0xf9,0x2c,0x97,0xb6,0x35,0xe6,0xcc,0x48,
+  0xfc,0x42,0x18,0x10,0x4c,0x10,0x3f,0x4f,0x86,0x04,0x65,0xab,0xf0,0x0c,0x6e,0xf1,
+  0xd4,0x90,0x79,0x1a,0xb0,0x38,0xb5,0x5a,0x19,0x3d,0xe0,0x43,0xc7,0x33,0x90,0xf7,
+  0x2d,0x2d,0x07,0xa3,0x92,0xad,0x0c,0x83,0xa8,0x65,0x7f,0xb9,0x46,0x0c,0xb8,0x30,
+  0xc1,0x4b,0x50,0x8b,0x2b,0x54,0xe8,0x34,0x84,0xd6,0x69,0x61,0x67,0x4a,0xac,0x9d,
+  0xf2,0x91,0x95,0xcc,0x28,0x63,0xe9,0x7a,0xc5,0xbd,0x49,0xaf,0x45,0x6d,0xf4,0xe3,
+  0x8a,0x4b,0x0c,0x02,0x9a,0xa4,0xef,0xe9,0x2a,0xbf,0xec,0x25,0xa5,0x2b,0x81,0x5d,
+  0xf5,0xc8,0xdc,0x23,0x2c,0xac,0x14,0x12,0xa8,0x65,0xa6,0x3c,0x8b,0xc2,0x16,0x7e,
+  0x4f,0x3b,0xda,0x10,0xc6,0xfb,0x42,0xbc,0x35,0x6e,0xb1,0x12,0xfe,0x81,0x5f,0xb2,
+  0x5a,0xd0,0x84,0xc9,0x59,0xe6,0xdc,0x09,0x3d,0x12,0x2e,0xad,0x67,0xe8,0xac,0x01,
+  0x87,0x2b,0x14,0x5a,0x99,0x83,0x36,0xa5,0xab,0x97,0xc2,0x9c,0xd2,0x6a,0xb5,0xe5,
+  0x10,0xf9,0x5c,0xe7,0x60,0xc7,0xe4,0xa0,0x83,0x9f,0x34,0xc9,0x8b,0xc4,0x1e,0xc8,
+  0x14,0xad,0x88,0xdc,0xaf,0x50,0xda,0x52,0xa8,0xe3,0xa8,0x71,0x4c,0xca,0x2a,0x94,
+  0xa4,0x34,0xc7,0xec,0xdd,0x3a,0xd0,0x01,0x3e,0xb5,0xd9,0x24,0x28,0x3d,0xe7,0x92,
+  0x4c,0x99,0xa3,0x7e,0x79,0x92,0xfa,0xba,0x33,0xec,0x5f,0xc0,0x2c,0xf5,0x7f,0x93,
+  0x69,0xea,0xeb,0xd3,0xd4,0x37,0x4e,0x53,0xff,0xae,0xf3,0xd4,0x37,0x4d,0x54,0xfd,
+  0x6a,0xf1,0x26,0x41,0x75,0xa8,0xe2,0x17,0x98,0x87,0xcf,0x65,0x59,0x7b,0x17,0x23,
+  0xfd,0x5f,0x34,0x00,0xe3,0x64,0x1a,0x72,0x65,0xd5,0x9a,0x28,0x38,0xf9,0xde,0xcf,
+  0x21,0x1e,0x6f,0x42,0x06,0x27,0x73,0x65,0xaf,0x45,0x2c,0x67,0x61,0xf6,0x05,0xe1,
+  0xca,0x23,0x6b,0x15,0x64,0xc5,0x9d,0xa1,0x18,0xa3,0x72,0x41,0x1e,0xe7,0x13,0x51,
+  0x5f,0xad,0xa9,0x68,0xe6,0xec,0x13,0x97,0xc5,0x1b,0x1c,0x0b,0xce,0x0e,0x7c,0x8f,
+  0x27,0x4a,0xe8,0x20,0xe6,0x3e,0x49,0xee,0x91,0x6c,0xc9,0x42,0x79,0xda,0xaf,0x34,
+  0x2c,0x5f,0xa1,0xb5,0xea,0x4e,0x93,0x44,0x1c,0x32,0x7c,0x68,0xa8,0xbb,0x19,0xbc,
+  0x71,0x9b,0xef,0x92,0x87,0x0d,0xbe,0x27,0x19,0xe0,0xb7,0x14,0xf1,0x0b,0x6e,0xb9,
+  0x39,0xeb,0x87,0x97,0x78,0x8f,0x7b,0x98,0xb6,0x37,0x0c,0x76,0xcb,0x03,0x72,0xd8,
+  0xe9,0x88,0x12,0x61,0x04,0x1f,0xae,0xae,0x87,0x0d,0xe8,0x56,0x9b,0x06,0xfe,0x3c,
+  0x1c,0x10,0xd8,0xcd,0x60,0x2e,0x80,0xef,0xa5,0x8b,0x01,0xe9,0x76,0x3a,0xbf,0x1b,
+  0x36,0xa2,0x75,0x0a,0x5b,0x28,0xd9,0x0a,0x22,0x98,0xd1,0xa5,0x1f,0xdc,0x0c,0x88,
+  0x1f,0x2e,0x58,0xec,0xa7,0xc3,0x46,0x7b,0xc3,0x26,0x97,0x7e,0xda,0x5e,0x27,0x2c,
+  0x16,0xdf,0x99,0x1e,0x90,0x94,0x3b,0xf7,0xcb,0x45,0xdc,0x82,0xc7,0x3c,0xac,0x15,
+  0xf5,0xc0,0x6d,0x86,0xbf,0x27,0xd1,0x35,0x74,0x0d,0x1f,0xc5,0x76,0x6b,0x12,0x5d,
+  0x0f,0x61,0xfb,0xa1,0x4e,0x49,0xd1,0x53,0xad,0xbe,0x53,0x9d,0x40,0x48,0x4e,0xdb,
+  0x98,0x1b,0xc0,0x29,0x3d,0x8b,0xa6,0x6b,0xf4,0x52,0x0b,0xc2,0x73,0x17,0x7c,0xf6,
+  0x8c,0x2b,0x49,0x66,0x10,0xa0,0x6c,0xc9,0x38,0x77,0xe6,0x87,0x7e,0xb2,0x50,0xb5,
+  0x74,0x16,0x15,0x20,0x78,0x48,0x99,0x66,0xf9,0xa5,0xb9,0x5f,0x7e,0x51,0x79,0x5a,
+  0xef,0xb7,0x6e,0x00,0x0a,0x34,0x55,0x3c,0x2c,0xbd,0x2d,0x0a,0x1b,0x57,0xd8,0x17,
+  0xb0,0x68,0x14,0x1c,0x68,0x56,0xad,0xd4,0xeb,0x70,0xb6,0x86,0x33,0xaf,0xac,0x75,
+  0x25,0x88,0xd7,0x8c,0xa4,0xaf,0x23,0xe9,0x1b,0x91,0x54,0x99,0x90,0x7e,0xc5,0xf1,
+  0xc9,0x24,0x58,0x83,0x5b,0x54,0x23,0x71,0x36,0x27,0x75,0x21,0xe0,0x65,0x89,0xa7,
+  0x84,0x61,0x3f,0xe7,0xb7,0xd0,0xe2,0xed,0x4f,0xda,0xdc,0x69,0xc3,0x54,0x2b,0x24,
+  0x53,0xba,0xc2,0x30,0xed,0x9a,0x89,0xd2,0x96,0xef,0xe7,0x4e,0x96,0x48,0x3c,0xad,
+  0x18,0x27,0x97,0x2a,0xc5,0x51,0x72,0x89,0x9a,0xdf,0xde,0x5a,0x97,0x2d,0x61,0x08,
+  0x2e,0xe5,0x02,0x50,0x5e,0xdf,0x5a,0x53,0xb9,0x18,0x14,0x8c,0x9b,0xdd,0xec,0x06,
+  0xd6,0x1d,0xad,0x9a,0xa2,0xd9,0xd4,0x2b,0x58,0x6b,0xaa,0x9b,0xce,0x94,0x35,0xff,
+  0x9f,0x72,0x6b,0xea,0x8e,0x98,0xba,0x72,0x00,0x44,0x36,0x88,0xfc,0xd5,0x8e,0x91,
+  0x98,0x71,0x14,0x2f,0x4c,0xad,0x41,0x52,0x11,0x45,0x95,0x63,0xe1,0x01,0x59,0xf7,
+  0x49,0xa1,0x60,0xe2,0x30,0x50,0x7c,0xa1,0x2f,0xc7,0x22,0xe3,0xb6,0x4d,0x11,0xc5,
+  0xb7,0xe2,0xdb,0x1c,0x59,0x8c,0xdf,0x27,0xb7,0x98,0xe3,0x90,0xed,0x55,0x9c,0x9a,
+  0xde,0xda,0xe5,0x50,0xb6,0x4f,0x6e,0xb5,0x80,0x48,0x36,0x5d,0x15,0x67,0x74,0xab,
+  0x06,0x1b,0x7e,0xba,0x0c,0xc9,0x45,0x02,0xdf,0x90,0x9a,0x43,0xeb,0x73,0x3f,0x8b,
+  0xf4,0x40,0xd7,0xce,0x44,0x2e,0x7d,0x1e,0x18,0x63,0x2e,0xab,0xd1,0x99,0x09,0xad,
+  0xe0,0xab,0x8e,0xf3,0xab,0x46,0x5a,0x49,0x42,0x3d,0x0f,0xa5,0x74,0x6b,0xd3,0x34,
+  0xbb,0xd0,0x49,0xde,0x39,0x9c,0x39,0x6c,0xf8,0xab,0xfc,0x8e,0x09,0xfd,0x8a,0x8a,
+  0xa1,0xe9,0x76,0xbf,0xac,0xf6,0x13,0xe3,0x8d,0x4a,0x83,0x0a,0x6f,0x82,0xbc,0x66,
+  0xc9,0xe8,0x4f,0x28,0x74,0xc3,0x1e,0xd6,0x3b,0xfa,0xb3,0x88,0xf8,0xb2,0xeb,0x45,
+  0x47,0x34,0xac,0x76,0xe4,0x88,0x51,0x34,0x9e,0x94,0x3d,0x50,0x26,0xc7,0x69,0x8d,
+  0xff,0xa9,0x31,0x50,0x08,0x74,0xde,0xb9,0x70,0x8b,0xee,0x1e,0xd5,0x1b,0x21,0x3a,
+  0xc8,0x6f,0x9d,0x11,0x0f,0xfc,0x86,0x8b,0x9d,0xfe,0x9e,0xdb,0xba,0x75,0xf2,0xec,
+  0xcd,0x2b,0x31,0xb8,0x97,0x78,0x10,0xa1,0x2e,0x18,0x5c,0x15,0xd9,0x1d,0x3a,0xc3,
+  0x86,0x9e,0x9e,0x8d,0x56,0x98,0xd1,0xc3,0xc1,0x77,0x05,0xca,0x57,0x3e,0xf6,0xe0,
+  0xb3,0xd4,0xe3,0xe3,0xbd,0x45,0xba,0x0c,0xc6,0xff,0x1b,0x20,0xe7,0x3e,0xac,0xce,
+  0xc8,0x00,0x00
+};
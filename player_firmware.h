@@ -0,0 +1,969 @@
+// Player firmware shared by Player1.ino and Player2.ino. Each sketch only
+// defines PLAYER_ID (1..ESPNOW_MAX_PLAYERS) and includes this file; another
+// board is one more two-line sketch.
+//
+// The Arduino builder generates prototypes for .ino files only, so functions
+// used before their definition are declared under "Prototypes" below.
+#pragma once
+
+#ifndef PLAYER_ID
+#error "Define PLAYER_ID (1..ESPNOW_MAX_PLAYERS) before including player_firmware.h"
+#endif
+
+#define PLAYER_STR_(x) #x
+#define PLAYER_STR(x) PLAYER_STR_(x)
+#define PLAYER_NAME "Player " PLAYER_STR(PLAYER_ID)
+
+#include <WiFi.h>
+#include <esp_now.h>
+#include <esp_timer.h>
+#include <atomic>
+#include <freertos/semphr.h>
+
+#define LED_PIN 2
+
+// Capture backend: 1 = MCPWM hardware capture (APB-clock edge timestamps),
+// 0 = legacy attachInterrupt() + micros() ISR path
+#define USE_MCPWM_CAPTURE 1
+
+#if USE_MCPWM_CAPTURE
+#include "driver/mcpwm_cap.h"
+#endif
+
+// TDoA solver: 1 = single-precision closed-form seeded solver (fast path),
+// 0 = double-precision reference solver
+#define USE_FAST_TDOA 1
+
+// TDoA lookup grid (built at boot): 0 = off, 1 = 2-sensor hits only (instead
+// of the nearest-sensor guess), 2 = all hits (fixed-cost solve, no iteration)
+#define USE_TDOA_GRID 1
+
+#include "tdoa_solver.h"
+#include "espnow_protocol.h"
+#include "telemetry.h"
+
+static_assert(PLAYER_ID >= 1 && PLAYER_ID <= ESPNOW_MAX_PLAYERS, "PLAYER_ID out of range");
+
+// ===================== USER CONFIG =====================
+static const int SENSOR_COUNT = 4;
+// Index order: 0=Top (GPIO35), 1=Bottom (GPIO33), 2=Right (GPIO34), 3=Left (GPIO32)
+static const uint8_t SENSOR_PINS[SENSOR_COUNT] = {35, 33, 34, 32};
+
+// Catch both polarities while debugging; later change to RISING or FALLING
+static const int EDGE_MODE = CHANGE;
+
+// Board coordinates: top-left origin (0,0) to (0.4,0.4) meters
+// Sensor positions in METERS matching index order above
+static const float SX[SENSOR_COUNT] = {0.200f, 0.200f, 0.300f, 0.100f};
+static const float SY[SENSOR_COUNT] = {0.100f, 0.300f, 0.200f, 0.200f};
+
+// Board bounds (meters) used to keep solutions on the board
+static const float BOARD_SIZE_M = 0.4f;
+static const float BOARD_MIN_X = 0.0f;
+static const float BOARD_MAX_X = BOARD_SIZE_M;
+static const float BOARD_MIN_Y = 0.0f;
+static const float BOARD_MAX_Y = BOARD_SIZE_M;
+// Solver acceptance threshold (meters RMS residual). Tune based on noise.
+static const float SOLVER_RMS_THRESH_M = 0.02f; // 20 mm
+// Lookup grid resolution: cells per side (40 -> 10 mm cells, ~13 KB of RAM)
+static const int TDOA_GRID_SIZE = 40;
+
+// Estimated plate wave speed (tune this)
+static float V_SOUND = 3000.0f; // m/s
+
+// Timing
+static const unsigned long CAPTURE_WINDOW_US     = 8000; // wide for debugging
+static const unsigned long DEADTIME_US           = 120000; // µs quiet before re‑arm
+
+// Tasks: capture shares the loop() core (away from Wi-Fi), solver/report runs
+// on the Wi-Fi core at low priority so it never delays a hit packet
+static const BaseType_t CAPTURE_TASK_CORE = 1;
+static const BaseType_t SOLVER_TASK_CORE  = 0;
+static const UBaseType_t CAPTURE_TASK_PRIO = 5;
+static const UBaseType_t SOLVER_TASK_PRIO  = 1;
+static const size_t CAPTURE_RING_SIZE = 8; // raw capture records in flight to the solver
+static const int ESPNOW_TX_QUEUE_LEN = 4;  // reliable packets (hits, locations) awaiting an ACK
+// =======================================================
+
+// ===================== ESP-NOW Configuration =====================
+// Bridge MAC address (hardcoded for reliability)
+uint8_t bridgeAddress[] = {0x80, 0xF3, 0xDA, 0x4A, 0x2F, 0x98}; // Bridge STA MAC
+
+// Packet format, types and payloads: espnow_protocol.h
+// Packets go out from several tasks (loop, solver, Wi-Fi callbacks), so the
+// sequence counter and retransmit queue are guarded by g_txLock
+SemaphoreHandle_t g_txLock = nullptr;
+uint16_t g_txSeq = 0;                 // EspNowHeader.seq, random start per boot
+uint16_t g_bootId = 0;                // EspNowHeader.boot, random per boot
+EspNowTxQueue<ESPNOW_TX_QUEUE_LEN> g_tx = {};
+esp_timer_handle_t g_retryTimer = nullptr;
+EspNowSeqStats g_bridgeSeq = {};      // loss accounting + duplicate suppression for the Bridge
+EspNowSeqStats g_bridgeBcastSeq = {}; // same for the Bridge's broadcasts (own counter)
+volatile unsigned long g_lastTxMs = 0; // any packet to the Bridge doubles as a heartbeat
+
+// Trace points (telemetry.h), reported to the Bridge every TELEMETRY_REPORT_MS.
+// Send callbacks arrive in send order, so counting both sides under g_txLock
+// pairs the hit's esp_now_send() with its callback.
+Telemetry g_telem = {};
+uint32_t g_rawSends = 0;       // esp_now_send() calls accepted by the driver
+uint32_t g_sendCbs = 0;        // send callbacks seen
+uint32_t g_hitSendOrdinal = 0; // g_rawSends of the latest hit still waiting for its callback (0 = none)
+uint32_t g_hitSendUs = 0;
+unsigned long g_lastTelemMs = 0;
+
+// Connection tracking
+bool bridgeConnected = false;
+unsigned long lastHeartbeat = 0;
+const unsigned long heartbeatTimeout = 2000; // 2 seconds
+bool bridgeMacLearned = false;
+
+// Clock synchronization (client only responds; host paces requests)
+bool clockSynced = false;
+int64_t clockOffset = 0; // Bridge time - player time
+int64_t lastSyncTime = 0;
+// =======================================================
+
+// ===================== Game State =====================
+volatile unsigned long g_firstTime[SENSOR_COUNT]; // first arrival micros() per sensor
+volatile uint32_t      g_hitMask = 0;             // bit i set when sensor i latched first arrival
+volatile bool          g_armed = true;            // ready for new hit
+volatile bool          g_capturing = false;       // capture window open
+volatile unsigned long g_t0 = 0;                  // first edge time (µs)
+
+// ISR-light start handoff
+volatile bool          g_startPending = false;    // main loop should start capture
+volatile int           g_firstIndex   = -1;       // who triggered first (for debug)
+
+// Edge debug counters (for UI table)
+volatile uint16_t g_edgeCount[SENSOR_COUNT]      = {0,0,0,0};
+volatile unsigned long g_lastEdgeUs[SENSOR_COUNT]= {0,0,0,0};
+
+// Capture pipeline, advanced by the capture task without blocking:
+// ARMED -> CAPTURING -> SOLVING -> DEADTIME -> ARMED
+enum CaptureState : uint8_t {
+  CAP_ARMED = 0,   // waiting for the ISR to report a first edge
+  CAP_CAPTURING,   // window open, ISRs latching first arrivals
+  CAP_SOLVING,     // window closed, hit sent, record handed to the solver task
+  CAP_DEADTIME     // board settling, edges ignored until re-arm
+};
+CaptureState g_capState = CAP_ARMED;
+unsigned long g_deadtimeStartUs = 0;
+
+// Snapshot of one closed capture window (copied out of the ISR state)
+struct CaptureRecord {
+  int64_t       t0Wide; // t0 on the 64-bit esp_timer timebase (what goes on the air)
+  unsigned long t0;
+  unsigned long closeUs; // when the window closed (trace point)
+  uint32_t      mask;
+  unsigned long t[SENSOR_COUNT];
+  unsigned long lastEdge[SENSOR_COUNT];
+  uint16_t      cnt[SENSOR_COUNT];
+} g_capture;
+
+// Lock-free single-producer/single-consumer ring of capture records.
+// Producer: capture task. Consumer: solver task.
+template <typename T, size_t N>
+struct SpscRing {
+  T buf[N];
+  std::atomic<uint32_t> head{0}; // next slot to write (producer only)
+  std::atomic<uint32_t> tail{0}; // next slot to read (consumer only)
+
+  bool push(const T &v) {
+    uint32_t h = head.load(std::memory_order_relaxed);
+    if (h - tail.load(std::memory_order_acquire) >= N) return false; // full
+    buf[h % N] = v;
+    head.store(h + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool pop(T &v) {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    if (t == head.load(std::memory_order_acquire)) return false; // empty
+    v = buf[t % N];
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+  }
+};
+
+SpscRing<CaptureRecord, CAPTURE_RING_SIZE> g_captureRing;
+volatile uint32_t g_ringDrops = 0; // records lost because the solver fell behind
+
+TaskHandle_t g_captureTask = nullptr;
+TaskHandle_t g_solverTask  = nullptr;
+
+// True once the MCPWM capture backend is running (otherwise GPIO ISRs are used)
+bool g_hwCapture = false;
+
+struct HitResult {
+  bool   valid = false;
+  float  x = 0, y = 0;  // meters in same top-left frame
+  int    haveTimes = 0;
+  String mode = "none";
+  int64_t  hitTime = 0;   // esp_timer_get_time() of the first edge
+  uint16_t hitStrength = 0;
+} g_lastHit;
+
+// Game state
+bool gameActive = false;
+String winner = "none";
+int64_t bridgeHitTime = 0;
+int64_t myHitTime = 0;
+// Current round from MSG_ROUND_CONTROL: edges before roundStartUs are not hits
+int32_t roundId = -1;        // -1 = none received yet (or the Bridge rebooted)
+std::atomic<int64_t> roundStartUs{0}; // written by the Wi-Fi task, read by the capture task
+// =======================================================
+
+// ===================== Math: TDoA solver =====================
+// Solvers live in tdoa_solver.h (shared with the host bench in bench/)
+static const TdoaLimits TDOA_LIMITS = {
+  BOARD_MIN_X, BOARD_MAX_X, BOARD_MIN_Y, BOARD_MAX_Y, SOLVER_RMS_THRESH_M
+};
+
+static const TdoaConfig TDOA_CONFIG = {USE_FAST_TDOA != 0, USE_TDOA_GRID};
+typedef TdoaGrid<SENSOR_COUNT, TDOA_GRID_SIZE> PlayerTdoaGrid;
+#if USE_TDOA_GRID
+static PlayerTdoaGrid g_tdoaGrid; // built in setup() from SX/SY/V_SOUND
+static const PlayerTdoaGrid *const TDOA_GRID = &g_tdoaGrid;
+#else
+static const PlayerTdoaGrid *const TDOA_GRID = nullptr;
+#endif
+
+// ===================== ISRs (ultra-minimal) =====================
+// Returns true if the capture task was woken and a context switch is due
+static inline bool IRAM_ATTR latch_time_at(int i, unsigned long now) {
+  BaseType_t woken = pdFALSE;
+
+  // count every edge for debug
+  g_edgeCount[i]++;
+  g_lastEdgeUs[i] = now;
+
+  // First edge -> ask main loop to start capture
+  if (g_armed && !g_capturing && !g_startPending) {
+    g_t0 = now;
+    g_firstIndex = i;
+    g_startPending = true; // capture task will open window & light LED
+    if (g_captureTask) vTaskNotifyGiveFromISR(g_captureTask, &woken);
+  }
+
+  // If capture already open (or about to open), latch first time for this sensor
+  if (g_capturing || g_startPending) {
+    if (!(g_hitMask & (1u << i))) {
+      g_hitMask |= (1u << i);
+      g_firstTime[i] = now;
+    }
+  }
+  return woken == pdTRUE;
+}
+
+static inline void IRAM_ATTR latch_time_min(int i) {
+  if (latch_time_at(i, micros())) portYIELD_FROM_ISR(); // micros() safe on ESP32 core
+}
+
+void IRAM_ATTR edgeISR0(){ latch_time_min(0); }
+void IRAM_ATTR edgeISR1(){ latch_time_min(1); }
+void IRAM_ATTR edgeISR2(){ latch_time_min(2); }
+void IRAM_ATTR edgeISR3(){ latch_time_min(3); }
+void (*ISR_FUN[SENSOR_COUNT])() = { edgeISR0, edgeISR1, edgeISR2, edgeISR3 };
+
+// ===================== MCPWM hardware capture =====================
+#if USE_MCPWM_CAPTURE
+// Each MCPWM group has 3 capture channels, so sensors 0-2 sit on group 0 and
+// sensor 3 on group 1. Both capture timers count APB ticks; the constant
+// offset between them is measured once at boot with a pair of soft catches.
+static const int MCPWM_CHANNELS_PER_GROUP = 3;
+static const int MCPWM_GROUPS = (SENSOR_COUNT + MCPWM_CHANNELS_PER_GROUP - 1) / MCPWM_CHANNELS_PER_GROUP;
+
+static mcpwm_cap_timer_handle_t   s_capTimer[MCPWM_GROUPS];
+static mcpwm_cap_channel_handle_t s_capChan[SENSOR_COUNT];
+static int32_t           s_capTicksPerUs   = 80; // APB 80 MHz, refreshed from driver
+static volatile uint32_t s_capGroupOffset  = 0;  // group 1 ticks - group 0 ticks
+static volatile uint32_t s_capT0Ticks      = 0;  // group-0 tick count latched with g_t0
+static volatile int      s_capCalibPending = 0;  // soft catches still outstanding
+static volatile uint32_t s_capCalibTicks[MCPWM_GROUPS];
+
+// Signed tick delta -> rounded microseconds
+static inline long IRAM_ATTR capTicksToUs(int32_t dticks) {
+  if (dticks >= 0) return (long)((dticks + s_capTicksPerUs / 2) / s_capTicksPerUs);
+  return -(long)((-dticks + s_capTicksPerUs / 2) / s_capTicksPerUs);
+}
+
+static bool IRAM_ATTR onSensorCapture(mcpwm_cap_channel_handle_t chan,
+                                      const mcpwm_capture_event_data_t *edata,
+                                      void *user) {
+  const int i = (int)(intptr_t)user;
+  const int group = i / MCPWM_CHANNELS_PER_GROUP;
+
+  // Boot-time group offset calibration (soft catch, raw ticks)
+  if (s_capCalibPending > 0) {
+    s_capCalibTicks[group] = edata->cap_value;
+    s_capCalibPending--;
+    return false;
+  }
+
+  // Bring the tick count into the group-0 timebase
+  uint32_t ticks = edata->cap_value;
+  if (group > 0) ticks -= s_capGroupOffset;
+
+  // The first edge anchors the window to micros(); every later edge is placed
+  // relative to it from hardware ticks, so arrival differences carry no ISR jitter.
+  unsigned long now;
+  if (g_armed && !g_capturing && !g_startPending) {
+    s_capT0Ticks = ticks;
+    now = micros();
+  } else {
+    now = g_t0 + capTicksToUs((int32_t)(ticks - s_capT0Ticks));
+  }
+  return latch_time_at(i, now);
+}
+
+// Both capture timers run from the same APB clock, so their offset never
+// drifts. Repeat until two consecutive measurements agree.
+static bool calibrateCaptureGroups() {
+  if (MCPWM_GROUPS < 2) return true;
+  const int probeChan = MCPWM_CHANNELS_PER_GROUP; // first channel on group 1
+  int32_t prev = 0;
+  for (int attempt = 0; attempt < 5; attempt++) {
+    s_capCalibPending = 2;
+    noInterrupts();
+    mcpwm_capture_channel_trigger_soft_catch(s_capChan[0]);
+    mcpwm_capture_channel_trigger_soft_catch(s_capChan[probeChan]);
+    interrupts();
+
+    unsigned long start = millis();
+    while (s_capCalibPending > 0 && millis() - start < 10) { delay(1); }
+    if (s_capCalibPending > 0) { s_capCalibPending = 0; continue; }
+
+    int32_t offset = (int32_t)(s_capCalibTicks[1] - s_capCalibTicks[0]);
+    if (attempt > 0 && abs(offset - prev) <= 16) { // within 0.2 us
+      s_capGroupOffset = (uint32_t)offset;
+      Serial.printf("MCPWM group offset: %ld ticks\r\n", (long)offset);
+      return true;
+    }
+    prev = offset;
+  }
+  Serial.println(F("MCPWM group offset calibration failed"));
+  return false;
+}
+
+// Undo a partial or failed init so the GPIO interrupt fallback is the only
+// thing latching edges. Channels are enabled as soon as they are created;
+// timers are only stopped if they were started.
+static void teardownMcpwmCapture(bool timersStarted) {
+  for (int i = 0; i < SENSOR_COUNT; i++) {
+    if (!s_capChan[i]) continue;
+    mcpwm_capture_channel_disable(s_capChan[i]);
+    mcpwm_del_capture_channel(s_capChan[i]);
+    s_capChan[i] = nullptr;
+  }
+  for (int g = 0; g < MCPWM_GROUPS; g++) {
+    if (!s_capTimer[g]) continue;
+    if (timersStarted) {
+      mcpwm_capture_timer_stop(s_capTimer[g]);
+      mcpwm_capture_timer_disable(s_capTimer[g]);
+    }
+    mcpwm_del_capture_timer(s_capTimer[g]);
+    s_capTimer[g] = nullptr;
+  }
+  s_capCalibPending = 0;
+  s_capGroupOffset = 0;
+}
+
+static bool initMcpwmCapture() {
+  for (int g = 0; g < MCPWM_GROUPS; g++) {
+    mcpwm_capture_timer_config_t tcfg = {};
+    tcfg.group_id = g;
+    tcfg.clk_src = MCPWM_CAPTURE_CLK_SRC_DEFAULT;
+    if (mcpwm_new_capture_timer(&tcfg, &s_capTimer[g]) != ESP_OK) {
+      Serial.printf("MCPWM capture timer %d init failed\r\n", g);
+      s_capTimer[g] = nullptr;
+      teardownMcpwmCapture(false);
+      return false;
+    }
+  }
+
+  for (int i = 0; i < SENSOR_COUNT; i++) {
+    mcpwm_capture_channel_config_t ccfg = {};
+    ccfg.gpio_num = SENSOR_PINS[i];
+    ccfg.prescale = 1;
+    ccfg.flags.pos_edge = (EDGE_MODE != FALLING);
+    ccfg.flags.neg_edge = (EDGE_MODE != RISING);
+    if (mcpwm_new_capture_channel(s_capTimer[i / MCPWM_CHANNELS_PER_GROUP], &ccfg, &s_capChan[i]) != ESP_OK) {
+      Serial.printf("MCPWM capture channel for GPIO%d init failed\r\n", SENSOR_PINS[i]);
+      s_capChan[i] = nullptr;
+      teardownMcpwmCapture(false);
+      return false;
+    }
+    mcpwm_capture_event_callbacks_t cbs = {};
+    cbs.on_cap = onSensorCapture;
+    mcpwm_capture_channel_register_event_callbacks(s_capChan[i], &cbs, (void*)(intptr_t)i);
+    mcpwm_capture_channel_enable(s_capChan[i]);
+  }
+
+  for (int g = 0; g < MCPWM_GROUPS; g++) {
+    mcpwm_capture_timer_enable(s_capTimer[g]);
+    mcpwm_capture_timer_start(s_capTimer[g]);
+  }
+
+  uint32_t resHz = 0;
+  if (mcpwm_capture_timer_get_resolution(s_capTimer[0], &resHz) == ESP_OK && resHz >= 1000000) {
+    s_capTicksPerUs = (int32_t)(resHz / 1000000);
+  }
+  Serial.printf("MCPWM capture: %d groups, %ld ticks/us\r\n", MCPWM_GROUPS, (long)s_capTicksPerUs);
+
+  if (!calibrateCaptureGroups()) {
+    teardownMcpwmCapture(true);
+    return false;
+  }
+  return true;
+}
+#endif
+
+// ===================== Prototypes =====================
+void resetGame();
+void determineWinner();
+
+// ===================== ESP-NOW Callbacks =====================
+// Called with g_txLock held (from g_tx)
+bool espNowRawSend(const uint8_t *mac, const uint8_t *pkt, uint8_t len) {
+  if (esp_now_send(mac, pkt, len) != ESP_OK) return false;
+  g_rawSends++;
+  return true;
+}
+
+// Call with g_txLock held
+void armRetryTimer() {
+  int64_t due = g_tx.nextDueUs();
+  esp_timer_stop(g_retryTimer); // ignore result (not running)
+  if (!due) return;
+  int64_t wait = due - esp_timer_get_time();
+  esp_timer_start_once(g_retryTimer, wait > 50 ? (uint64_t)wait : 50);
+}
+
+// esp_timer task: retransmit whatever has gone unacknowledged
+void onRetryTimer(void *arg) {
+  xSemaphoreTake(g_txLock, portMAX_DELAY);
+  g_tx.poll(espNowRawSend, esp_timer_get_time());
+  armRetryTimer();
+  xSemaphoreGive(g_txLock);
+}
+
+void OnDataSent(const wifi_tx_info_t *info, esp_now_send_status_t status) {
+  const int64_t now = esp_timer_get_time();
+  xSemaphoreTake(g_txLock, portMAX_DELAY);
+  if (status != ESP_NOW_SEND_SUCCESS) g_telem.sendFailed++;
+  if (++g_sendCbs == g_hitSendOrdinal) {
+    g_telem.span(TELEM_SENT, g_hitSendUs, (uint32_t)now);
+    g_hitSendOrdinal = 0;
+  }
+  g_tx.sendStatus(status == ESP_NOW_SEND_SUCCESS, now);
+  armRetryTimer();
+  xSemaphoreGive(g_txLock);
+  // Debug: Serial.println(status == ESP_NOW_SEND_SUCCESS ? "Send Status: Success" : "Send Status: Fail");
+}
+
+// Header + payload to the Bridge (safe from any task); hits and locations are
+// retransmitted until the Bridge acks them
+void sendToBridge(uint8_t type, const void *payload, uint8_t len) {
+  uint8_t pkt[ESPNOW_MAX_PACKET];
+  xSemaphoreTake(g_txLock, portMAX_DELAY);
+  uint16_t seq = g_txSeq++;
+  uint8_t n = espNowBuild(pkt, type, PLAYER_ID, g_bootId, seq, payload, len);
+  g_lastTxMs = millis();
+  bool reliable = espNowIsReliable(type);
+  const int64_t now = esp_timer_get_time();
+  const uint32_t sends = g_rawSends;
+  g_tx.send(espNowRawSend, bridgeAddress, pkt, n, reliable, seq, now);
+  if (type == MSG_HIT && g_rawSends != sends) {
+    g_hitSendOrdinal = g_rawSends;
+    g_hitSendUs = (uint32_t)now;
+  }
+  if (reliable) armRetryTimer();
+  xSemaphoreGive(g_txLock);
+}
+
+// Stage summaries and counters to the Bridge. Fire-and-forget, and only
+// between hits with nothing reliable in flight, so a report never delays one
+void sendTelemetry() {
+  MsgTelemetryCounters c;
+  xSemaphoreTake(g_txLock, portMAX_DELAY);
+  bool busy = g_tx.nextDueUs() != 0;
+  c.sendFailed = g_telem.sendFailed;
+  c.retries = g_tx.stats.retries;
+  c.gaveUp = g_tx.stats.failed;
+  xSemaphoreGive(g_txLock);
+  if (busy) return;
+  c.freeHeap = ESP.getFreeHeap();
+  c.minFreeHeap = ESP.getMinFreeHeap();
+  telemetryReport(g_telem, c, sendToBridge);
+}
+
+void onBridgeHeartbeat(const uint8_t *payload, int64_t rxUs) {
+  // Heartbeat - just update connection status
+  Serial.println("Bridge heartbeat received");
+}
+
+void onBridgeReset(const uint8_t *payload, int64_t rxUs) {
+  // Reset request from Bridge
+  resetGame();
+}
+
+void onBridgeRoundControl(const uint8_t *payload, int64_t rxUs) {
+  // Broadcast to every board at once; the Bridge sends it twice, so a round
+  // we already have is ignored
+  MsgRoundControl m;
+  memcpy(&m, payload, sizeof(m));
+  if ((int32_t)m.roundId == roundId) return;
+  roundId = m.roundId;
+  roundStartUs = rxUs + (m.startUs - m.sentUs);
+  resetGame();
+  Serial.printf("Round %u armed, starts in %lld us\n", m.roundId, (long long)(m.startUs - m.sentUs));
+}
+
+void onBridgeClockSync(const uint8_t *payload, int64_t rxUs) {
+  // Clock synchronization request: echo t1, add our receive (t2) and send (t3) times
+  MsgClockSync m;
+  memcpy(&m, payload, sizeof(m));
+  m.t2 = rxUs;
+  m.t3 = esp_timer_get_time();
+  sendToBridge(MSG_CLOCK_SYNC, &m, sizeof(m));
+
+  Serial.printf("Clock sync response sent, turnaround=%lld us\n", (long long)(m.t3 - m.t2));
+}
+
+// Bridge messages by EspNowMsgType (nullptr = not handled by players)
+typedef void (*BridgeMsgHandler)(const uint8_t *payload, int64_t rxUs);
+static const BridgeMsgHandler BRIDGE_HANDLERS[MSG_TYPE_COUNT] = {
+  nullptr,            // 0x00
+  onBridgeHeartbeat,  // MSG_HEARTBEAT
+  nullptr,            // MSG_HIT
+  onBridgeReset,      // MSG_RESET_REQUEST
+  onBridgeClockSync,  // MSG_CLOCK_SYNC
+  nullptr,            // MSG_HIT_LOCATION
+  nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, // MSG_LB_* (lightboard only)
+  nullptr,            // MSG_ACK (handled in OnDataRecv)
+  onBridgeRoundControl // MSG_ROUND_CONTROL
+};
+
+void OnDataRecv(const esp_now_recv_info_t *info, const uint8_t *data, int len) {
+  const int64_t rxUs = esp_timer_get_time();
+  EspNowHeader hdr;
+  if (!espNowParse(data, len, hdr) || hdr.sender != ESPNOW_ID_BRIDGE) return;
+  const bool broadcast = info && info->des_addr && memcmp(info->des_addr, ESPNOW_BROADCAST_ADDR, 6) == 0;
+
+  // Learn Bridge MAC dynamically (from unicast only: that's the address we reply to)
+  if (info && !broadcast && !bridgeMacLearned) {
+    memcpy(bridgeAddress, info->src_addr, 6);
+    char macStr[18];
+    sprintf(macStr, "%02X:%02X:%02X:%02X:%02X:%02X", bridgeAddress[0],bridgeAddress[1],bridgeAddress[2],bridgeAddress[3],bridgeAddress[4],bridgeAddress[5]);
+    Serial.printf("Discovered Bridge MAC: %s\r\n", macStr);
+    esp_now_del_peer(bridgeAddress);
+    esp_now_peer_info_t p = {};
+    memcpy(p.peer_addr, bridgeAddress, 6);
+    p.channel = 0;
+    p.encrypt = false;
+    if (esp_now_add_peer(&p) == ESP_OK) {
+      bridgeMacLearned = true;
+      Serial.println("Bridge peer added after discovery");
+    } else {
+      Serial.println("Failed to add discovered Bridge peer");
+    }
+  }
+  bridgeConnected = true;
+  lastHeartbeat = millis();
+
+  // Acknowledge every copy: the Bridge retransmits until one ACK gets through
+  if (espNowIsReliable(hdr.type)) {
+    MsgAck ack = {hdr.seq};
+    sendToBridge(MSG_ACK, &ack, sizeof(ack));
+  }
+  EspNowSeqStats &seq = broadcast ? g_bridgeBcastSeq : g_bridgeSeq;
+  const uint32_t restarts = seq.restarts;
+  if (!espNowTrackSeq(seq, hdr.boot, hdr.seq)) return; // duplicate
+  // A rebooted Bridge numbers its rounds from 0 again, so its next round can
+  // carry the id we last saw
+  if (seq.restarts != restarts) roundId = -1;
+
+  if (hdr.type == MSG_ACK) {
+    MsgAck ack;
+    memcpy(&ack, data + sizeof(EspNowHeader), sizeof(ack));
+    xSemaphoreTake(g_txLock, portMAX_DELAY);
+    g_tx.ack(info ? info->src_addr : bridgeAddress, ack.seq);
+    armRetryTimer();
+    xSemaphoreGive(g_txLock);
+    return;
+  }
+  BridgeMsgHandler h = BRIDGE_HANDLERS[hdr.type];
+  if (h) h(data + sizeof(EspNowHeader), rxUs);
+}
+
+// ===================== Game Logic =====================
+void determineWinner() {
+  if (bridgeHitTime > 0 && myHitTime > 0) {
+    // Calculate time difference in microseconds
+    int64_t timeDiff = bridgeHitTime - myHitTime;
+    
+    if (timeDiff < -100) { // we hit first (with 100us tolerance)
+      winner = PLAYER_NAME;
+      Serial.printf(PLAYER_NAME " wins! Time diff: %lld us\n", (long long)-timeDiff);
+    } else if (timeDiff > 100) { // Bridge hit first (with 100us tolerance)
+      winner = "Bridge";
+      Serial.printf("Bridge wins! Time diff: %lld us\n", (long long)timeDiff);
+    } else {
+      winner = "Tie";
+      Serial.printf("It's a tie! Time diff: %lld us\n", (long long)timeDiff);
+    }
+  }
+}
+
+void resetGame() {
+  winner = "none";
+  bridgeHitTime = 0;
+  myHitTime = 0;
+  gameActive = true;
+  
+  Serial.println("Game reset");
+}
+
+// ===================== Capture Pipeline =====================
+void openCaptureWindow() {
+  noInterrupts();
+  g_capturing = true;
+  g_armed = false;
+  // clear edge counters for this window
+  for (int k=0;k<SENSOR_COUNT;k++){ g_edgeCount[k]=0; g_lastEdgeUs[k]=0; }
+  // ensure the very first sensor time exists
+  if (g_firstIndex >= 0 && !(g_hitMask & (1u << g_firstIndex))) {
+    g_hitMask |= (1u << g_firstIndex);
+    g_firstTime[g_firstIndex] = g_t0;
+  }
+  g_startPending = false;
+  interrupts();
+
+  digitalWrite(LED_PIN, HIGH);
+}
+
+// micros() is the low 32 bits of esp_timer_get_time(); recover the high bits
+// for a timestamp taken in the recent past (less than ~71 minutes ago)
+static inline int64_t widenMicros(uint32_t t) {
+  int64_t now = esp_timer_get_time();
+  return now - (int64_t)(uint32_t)((uint32_t)now - t);
+}
+
+void closeCaptureWindow() {
+  // Copy volatile data atomically
+  noInterrupts();
+  g_capture.mask = g_hitMask;
+  g_capture.t0 = g_t0;
+  g_capture.t0Wide = widenMicros(g_t0);
+  for (int i=0;i<SENSOR_COUNT;i++){
+    g_capture.t[i]        = g_firstTime[i];
+    g_capture.lastEdge[i] = g_lastEdgeUs[i];
+    g_capture.cnt[i]      = g_edgeCount[i];
+  }
+  // end capture
+  g_capturing = false;
+  interrupts();
+  g_capture.closeUs = micros();
+  g_telem.span(TELEM_CAPTURE, g_capture.t0, g_capture.closeUs);
+}
+
+// Runs on the capture task the moment the window closes: the hit goes to the
+// Bridge straight away and the raw record is queued for the solver.
+void publishCapture() {
+  const CaptureRecord &c = g_capture;
+
+  // Edges before the round's scheduled start are early hits, not hits
+  if (gameActive && c.mask && c.t0Wide >= roundStartUs) {
+    MsgHit hit;
+    hit.hitTime = c.t0Wide;
+    hit.strength = __builtin_popcount(c.mask); // Use number of sensors as strength indicator
+    sendToBridge(MSG_HIT, &hit, sizeof(hit));
+    g_telem.span(TELEM_SEND, c.closeUs, micros());
+    myHitTime = c.t0Wide;
+  }
+
+  if (g_captureRing.push(c)) {
+    if (g_solverTask) xTaskNotifyGive(g_solverTask);
+  } else {
+    g_ringDrops++;
+  }
+}
+
+// Runs on the solver task: debug dump, TDoA solve, location report
+void solveCapture(const CaptureRecord &c) {
+  // ============ SERIAL DEBUG ============
+  Serial.println(F("---- Capture ----"));
+  Serial.print(F("t0=")); Serial.println(c.t0);
+  Serial.print(F("mask=0b")); Serial.println(c.mask, BIN);
+  for (int i=0;i<SENSOR_COUNT;i++){
+    Serial.print(F("S")); Serial.print(i); Serial.print(F(": "));
+    if (c.t[i]) {
+      long dt = (long)(c.t[i] - c.t0);
+      Serial.print(dt); Serial.print(F(" us"));
+    } else {
+      Serial.print(F("-"));
+    }
+    Serial.print(F("  | last="));
+    if (c.lastEdge[i]) Serial.print((long)(c.lastEdge[i]-c.t0));
+    else Serial.print(F("-"));
+    Serial.print(F(" us, cnt=")); Serial.println(c.cnt[i]);
+  }
+
+  // Count timestamps
+  int have=0; for(int i=0;i<SENSOR_COUNT;i++) if (c.t[i]) have++;
+
+  HitResult r;
+  r.haveTimes = have;
+  r.hitTime = c.t0Wide;
+  r.hitStrength = have; // Use number of sensors as strength indicator
+  float x = 0, y = 0;
+  uint8_t modeCode = tdoaLocate(SX,SY,c.t,V_SOUND,TDOA_LIMITS,TDOA_CONFIG,TDOA_GRID,x,y);
+  if (modeCode != TDOA_MODE_NONE){
+    r.valid = true; r.x = x; r.y = y; r.mode = TDOA_MODE_NAMES[modeCode];
+  }
+  g_telem.span(TELEM_SOLVE, c.closeUs, micros());
+
+  // Report our hit location (the hit itself already went out)
+  if (r.valid && gameActive) {
+    Serial.printf(PLAYER_NAME " hit detected at %lld with strength %d (%s x=%.3f y=%.3f)\n",
+                  (long long)r.hitTime, r.hitStrength, r.mode.c_str(), r.x, r.y);
+    
+    MsgHitLocation loc;
+    loc.hitTime = r.hitTime;
+    loc.xMm = (int16_t)lroundf(r.x * 1000.0f);
+    loc.yMm = (int16_t)lroundf(r.y * 1000.0f);
+    loc.mode = modeCode;
+    loc.sensors = (uint8_t)have;
+    sendToBridge(MSG_HIT_LOCATION, &loc, sizeof(loc));
+    
+    // Determine winner if we have both hits
+    if (bridgeHitTime > 0) {
+      determineWinner();
+    }
+  }
+
+  // Store for reference
+  if (r.valid) { g_lastHit = r; }
+  else { g_lastHit.valid = false; }
+}
+
+void rearmCapture() {
+  noInterrupts();
+  g_armed = true;
+  g_hitMask = 0;
+  g_firstIndex = -1;
+  for(int i=0;i<SENSOR_COUNT;i++){
+    g_firstTime[i]=0; g_edgeCount[i]=0; g_lastEdgeUs[i]=0;
+  }
+  interrupts();
+  digitalWrite(LED_PIN, LOW);
+}
+
+// Coarse-sleep on the RTOS tick, then spin the last stretch so windows close
+// within a few µs of their deadline
+static void waitUntilUs(unsigned long deadlineUs) {
+  long rem = (long)(deadlineUs - micros());
+  if (rem > 2000) vTaskDelay(pdMS_TO_TICKS((rem - 1000) / 1000));
+  else if (rem > 0) delayMicroseconds(rem);
+}
+
+void captureTask(void *arg) {
+  for (;;) {
+    const unsigned long nowUs = micros();
+
+    switch (g_capState) {
+      case CAP_ARMED:
+        // If ISR asked us to start, open the capture window here (NOT inside ISR)
+        if (g_startPending) {
+          openCaptureWindow();
+          g_capState = CAP_CAPTURING;
+        } else {
+          ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(10));
+        }
+        break;
+
+      case CAP_CAPTURING:
+        // Close window after CAPTURE_WINDOW_US; deadtime counts from here
+        if ((nowUs - g_t0) >= CAPTURE_WINDOW_US) {
+          closeCaptureWindow();
+          g_deadtimeStartUs = nowUs;
+          g_capState = CAP_SOLVING;
+        } else {
+          waitUntilUs(g_t0 + CAPTURE_WINDOW_US);
+        }
+        break;
+
+      case CAP_SOLVING:
+        publishCapture();
+        g_capState = CAP_DEADTIME;
+        break;
+
+      case CAP_DEADTIME:
+        if ((nowUs - g_deadtimeStartUs) >= DEADTIME_US) {
+          rearmCapture();
+          g_capState = CAP_ARMED;
+        } else {
+          waitUntilUs(g_deadtimeStartUs + DEADTIME_US);
+        }
+        break;
+    }
+  }
+}
+
+void solverTask(void *arg) {
+  uint32_t reportedDrops = 0;
+  CaptureRecord rec;
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    while (g_captureRing.pop(rec)) {
+      solveCapture(rec);
+    }
+    if (g_ringDrops != reportedDrops) {
+      reportedDrops = g_ringDrops;
+      Serial.printf("Solver fell behind: %lu capture records dropped\n", (unsigned long)reportedDrops);
+    }
+  }
+}
+
+
+// ===================== Setup =====================
+void setup(){
+  Serial.begin(115200);
+  delay(50);
+  Serial.println();
+  Serial.println(F("=== Two Player Impact Game - " PLAYER_NAME " (Client) - SYNC VERSION ==="));
+  Serial.printf("GPIOs: [%d, %d, %d, %d]\r\n", SENSOR_PINS[0],SENSOR_PINS[1],SENSOR_PINS[2],SENSOR_PINS[3]);
+
+  pinMode(LED_PIN, OUTPUT);
+  digitalWrite(LED_PIN, LOW);
+
+  for(int i=0;i<SENSOR_COUNT;i++){
+    pinMode(SENSOR_PINS[i], INPUT);
+  }
+
+  // Wi-Fi setup for ESP-NOW
+  WiFi.mode(WIFI_STA);
+  WiFi.disconnect(); // Ensure clean state
+  Serial.printf("STA MAC: %s\r\n", WiFi.macAddress().c_str());
+  Serial.println("=== " PLAYER_NAME " MAC Addresses ===");
+  Serial.printf("STA MAC: %s\r\n", WiFi.macAddress().c_str());
+  Serial.println("===============================");
+
+  // Reliable-send state must exist before the first send or send callback
+  g_txLock = xSemaphoreCreateMutex();
+  g_txSeq = (uint16_t)esp_random();
+  g_bootId = (uint16_t)esp_random(); // the Bridge must not mistake a reboot for retransmits
+  const esp_timer_create_args_t retryArgs = {
+    .callback = &onRetryTimer,
+    .arg = nullptr,
+    .dispatch_method = ESP_TIMER_TASK,
+    .name = "espnow_retry"
+  };
+  esp_timer_create(&retryArgs, &g_retryTimer);
+
+  // ESP-NOW setup
+  if (esp_now_init() != ESP_OK) {
+    Serial.println("Error initializing ESP-NOW");
+    while(true);
+  }
+  
+  // Clear any existing peers to ensure clean state
+  esp_now_del_peer(ESPNOW_BROADCAST_ADDR);
+  Serial.println("Cleared existing ESP-NOW peers");
+  
+  esp_now_register_send_cb(OnDataSent);
+  esp_now_register_recv_cb(OnDataRecv);
+
+  // Add Bridge peer with known MAC address
+  esp_now_peer_info_t peerInfo = {};
+  memcpy(peerInfo.peer_addr, bridgeAddress, 6);
+  peerInfo.channel = 0; // follow current channel
+  peerInfo.encrypt = false;
+  if (esp_now_add_peer(&peerInfo) == ESP_OK) {
+    Serial.println("Bridge peer added successfully");
+  } else {
+    Serial.println("Failed to add Bridge peer");
+  }
+
+#if USE_TDOA_GRID
+  g_tdoaGrid.build(SX, SY, V_SOUND, TDOA_LIMITS);
+  Serial.printf("TDoA grid ready: %dx%d cells\n", TDOA_GRID_SIZE, TDOA_GRID_SIZE);
+#endif
+
+  // Hardware edge capture, falling back to GPIO interrupts if MCPWM is unavailable
+#if USE_MCPWM_CAPTURE
+  g_hwCapture = initMcpwmCapture();
+  if (g_hwCapture) {
+    Serial.println(F("MCPWM capture running. Waiting for hits..."));
+  } else {
+    Serial.println(F("MCPWM capture unavailable - falling back to GPIO interrupts"));
+  }
+#endif
+  if (!g_hwCapture) {
+    for(int i=0;i<SENSOR_COUNT;i++){
+      pinMode(SENSOR_PINS[i], INPUT); // a torn-down capture channel may have released the pad
+      attachInterrupt(digitalPinToInterrupt(SENSOR_PINS[i]), ISR_FUN[i], EDGE_MODE);
+    }
+    Serial.println(F("Interrupts attached. Waiting for hits..."));
+  }
+
+  // Arm
+  g_capState = CAP_ARMED;
+  g_armed = true;
+  g_capturing = false;
+  g_startPending = false;
+  g_firstIndex = -1;
+  g_hitMask = 0;
+  for(int i=0;i<SENSOR_COUNT;i++){
+    g_firstTime[i]=0; g_edgeCount[i]=0; g_lastEdgeUs[i]=0;
+  }
+
+  // Initialize game state
+  gameActive = true;
+  winner = "none";
+  bridgeHitTime = 0;
+  myHitTime = 0;
+  clockSynced = false;
+  clockOffset = 0;
+
+  // Solver first so the capture task always has somewhere to hand records
+  xTaskCreatePinnedToCore(solverTask, "solver", 6144, nullptr, SOLVER_TASK_PRIO, &g_solverTask, SOLVER_TASK_CORE);
+  xTaskCreatePinnedToCore(captureTask, "capture", 4096, nullptr, CAPTURE_TASK_PRIO, &g_captureTask, CAPTURE_TASK_CORE);
+  
+  Serial.println(PLAYER_NAME " ready - waiting for Bridge connection");
+}
+
+// ===================== Loop =====================
+void loop(){
+  // Capture and solving run on their own tasks; loop() only does housekeeping
+  // Loop time is entry to entry, so it includes whatever the core ran in between
+  static uint32_t lastLoopUs = 0;
+  const uint32_t loopUs = micros();
+  if (lastLoopUs) g_telem.span(TELEM_LOOP, lastLoopUs, loopUs);
+  lastLoopUs = loopUs;
+
+  // Check for connection timeout
+  if (bridgeConnected && (millis() - lastHeartbeat > heartbeatTimeout)) {
+    bridgeConnected = false;
+    clockSynced = false; // Reset sync when connection lost
+    bridgeMacLearned = false; // Reset MAC learning to force rediscovery
+    Serial.println("Bridge connection lost - resetting discovery");
+  }
+
+  // Send heartbeat to Bridge, unless a sync reply or other packet already
+  // told it we are alive
+  if (millis() - g_lastTxMs >= 1000) {
+    sendToBridge(MSG_HEARTBEAT, nullptr, 0);
+    Serial.println("Sent heartbeat to Bridge");
+  }
+
+  // Trace report, only while waiting for a hit
+  if (bridgeConnected && g_capState == CAP_ARMED && millis() - g_lastTelemMs >= TELEMETRY_REPORT_MS) {
+    g_lastTelemMs = millis();
+    sendTelemetry();
+  }
+
+  // Update LED based on connection status
+  digitalWrite(LED_PIN, bridgeConnected ? HIGH : LOW);
+}
+
@@ -0,0 +1,304 @@
+// Indexed CSV question banks, shared by the Pi UI (script.js) and the
+// standalone master page (oldmaster.html, inlined by tools/build_oldmaster_ui.js).
+//
+// indexQuizBank() streams a Question,Answer,Audio,Badge CSV once, chunk by
+// chunk, and keeps only where each question's row starts and ends (byte
+// offsets) and which badge it has. A question is read back from its byte range
+// (an HTTP Range request, or Blob.slice() for an uploaded file) when the quiz
+// reaches it. The index costs about 10 bytes per question, so it is what gets
+// persisted instead of the questions.
+
+const QUIZ_ROW_CACHE = 64;      // parsed rows kept per bank
+const QUIZ_ROW_BITS = 20;       // deck refs pack (bank << 20) | row
+const QUIZ_MAX_ROWS = 1 << QUIZ_ROW_BITS;
+
+// Header names per column (lower case); unnamed columns fall back to position
+const QUIZ_COLUMNS = {
+  q:     { names: ['question', 'q'], position: 0 },
+  a:     { names: ['answer', 'a'], position: 1 },
+  audio: { names: ['audio', 'audiofile', 'music', 'file'], position: 2 },
+  badge: { names: ['badge', 'icon', 'category', 'level'], position: 3 },
+};
+
+const quizDecoder = new TextDecoder('utf-8');
+
+// One CSV line into trimmed fields. Quotes toggle quoting and are dropped;
+// rows are lines, as they always were for these files.
+function parseQuizLine(line) {
+  const values = [];
+  let current = '';
+  let inQuotes = false;
+  for (let j = 0; j < line.length; j++) {
+    const char = line[j];
+    if (char === '"') {
+      inQuotes = !inQuotes;
+    } else if (char === ',' && !inQuotes) {
+      values.push(current.trim());
+      current = '';
+    } else {
+      current += char;
+    }
+  }
+  values.push(current.trim());
+  return values;
+}
+
+// A row as parseCSV() used to return it: { header: value }
+function parseQuizRow(headers, line) {
+  const values = parseQuizLine(line.replace(/\r?\n?$/, ''));
+  const row = {};
+  headers.forEach((header, index) => {
+    row[header] = values[index] !== undefined ? values[index] : '';
+  });
+  return row;
+}
+
+function quizColumn(headers, column) {
+  const named = (header, c) => c.names.includes(header.toLowerCase());
+  const i = headers.findIndex(h => named(h, column));
+  if (i >= 0) return i;
+  // By position, unless that header names another column (Question,Answer,Badge)
+  const header = headers[column.position];
+  if (header === undefined || Object.values(QUIZ_COLUMNS).some(c => named(header, c))) return -1;
+  return column.position;
+}
+
+function newQuizBank(fields) {
+  return Object.assign({
+    src: null,        // URL the rows are read back from
+    file: null,       // or the Blob they are sliced from
+    size: 0,
+    mtime: 0,
+    headers: [],
+    count: 0,
+    starts: new Uint32Array(0),
+    ends: new Uint32Array(0),
+    badges: [''],     // badge names; badgeOf[row] indexes this, 0 = none
+    badgeOf: new Uint16Array(0),
+    hasAudio: false,
+    cache: new Map(), // row -> Promise of the parsed row, least recently used first
+  }, fields);
+}
+
+// source: a URL or a Blob/File. meta (size, mtime) is kept so a cached index
+// can be checked against the file it came from.
+async function indexQuizBank(source, meta = {}) {
+  const isUrl = typeof source === 'string';
+  let stream;
+  if (isUrl) {
+    const response = await fetch(source);
+    if (!response.ok) throw new Error(`${source}: ${response.status}`);
+    stream = response.body;
+  } else {
+    stream = source.stream();
+  }
+
+  const starts = [], ends = [], badgeOf = [];
+  const badges = [''], badgeCodes = new Map([['', 0]]);
+  let headers = null, cols = null, hasAudio = false;
+
+  // Parser state, carried across chunks
+  let pos = 0, rowStart = 0, field = 0, inQuotes = false, filled = 0;
+  let header = [], badge = [];
+
+  const has = (col) => col >= 0 && ((filled >> col) & 1) === 1;
+  const endRow = (end) => {
+    if (!headers) {
+      if (header.length) {
+        headers = parseQuizLine(quizDecoder.decode(new Uint8Array(header)).replace(/^\uFEFF/, '').replace(/\r$/, ''));
+        cols = {};
+        for (const key in QUIZ_COLUMNS) cols[key] = quizColumn(headers, QUIZ_COLUMNS[key]);
+      }
+    } else if (has(cols.q) && has(cols.a) && starts.length < QUIZ_MAX_ROWS) {
+      const name = badge.length ? quizDecoder.decode(new Uint8Array(badge)).trim() : '';
+      let code = badgeCodes.get(name);
+      if (code === undefined) {
+        code = badges.length;
+        badges.push(name);
+        badgeCodes.set(name, code);
+      }
+      starts.push(rowStart);
+      ends.push(end);
+      badgeOf.push(code);
+      if (has(cols.audio)) hasAudio = true;
+    }
+    rowStart = end;
+    field = 0;
+    inQuotes = false;
+    filled = 0;
+    header = [];
+    badge = [];
+  };
+
+  const reader = stream.getReader();
+  for (;;) {
+    const { done, value } = await reader.read();
+    if (done) break;
+    for (let i = 0; i < value.length; i++) {
+      const c = value[i];
+      pos++;
+      if (c === 0x0A) { endRow(pos); continue; }             // \n
+      if (!headers) header.push(c);
+      if (c === 0x22) { inQuotes = !inQuotes; continue; }    // "
+      if (c === 0x2C && !inQuotes) { field++; continue; }    // ,
+      if (c !== 0x20 && c !== 0x09 && c !== 0x0D && field < 31) filled |= 1 << field;
+      if (headers && field === cols.badge) badge.push(c);
+    }
+  }
+  if (pos > rowStart) endRow(pos);
+
+  return newQuizBank({
+    src: isUrl ? source : null,
+    file: isUrl ? null : source,
+    size: meta.size !== undefined ? meta.size : pos,
+    mtime: meta.mtime || 0,
+    headers: headers || [],
+    count: starts.length,
+    starts: Uint32Array.from(starts),
+    ends: Uint32Array.from(ends),
+    badges,
+    badgeOf: Uint16Array.from(badgeOf),
+    hasAudio,
+  });
+}
+
+async function readQuizRange(bank, start, end) {
+  if (bank.file) return new Uint8Array(await bank.file.slice(start, end).arrayBuffer());
+  const response = await fetch(bank.src, { headers: { Range: `bytes=${start}-${end - 1}` } });
+  if (!response.ok) throw new Error(`${bank.src}: ${response.status}`);
+  const bytes = new Uint8Array(await response.arrayBuffer());
+  return response.status === 206 ? bytes : bytes.subarray(start, end); // range ignored
+}
+
+// Row `row` of the bank as { header: value }, read on first use
+function readQuizRow(bank, row) {
+  let pending = bank.cache.get(row);
+  if (pending) {
+    bank.cache.delete(row);
+    bank.cache.set(row, pending);
+    return pending;
+  }
+  pending = readQuizRange(bank, bank.starts[row], bank.ends[row])
+    .then(bytes => parseQuizRow(bank.headers, quizDecoder.decode(bytes)));
+  pending.catch(() => bank.cache.delete(row));
+  bank.cache.set(row, pending);
+  if (bank.cache.size > QUIZ_ROW_CACHE) bank.cache.delete(bank.cache.keys().next().value);
+  return pending;
+}
+
+// ---- Persistence: the index only, typed arrays as base64 ----
+function quizToBase64(array) {
+  const bytes = new Uint8Array(array.buffer, array.byteOffset, array.byteLength);
+  let s = '';
+  for (let i = 0; i < bytes.length; i += 0x8000) {
+    s += String.fromCharCode.apply(null, bytes.subarray(i, i + 0x8000));
+  }
+  return btoa(s);
+}
+
+function quizFromBase64(text, Type) {
+  const s = atob(text);
+  const bytes = new Uint8Array(s.length);
+  for (let i = 0; i < s.length; i++) bytes[i] = s.charCodeAt(i);
+  return new Type(bytes.buffer);
+}
+
+function quizBankToJSON(bank) {
+  return {
+    src: bank.src,
+    size: bank.size,
+    mtime: bank.mtime,
+    headers: bank.headers,
+    count: bank.count,
+    starts: quizToBase64(bank.starts),
+    ends: quizToBase64(bank.ends),
+    badges: bank.badges,
+    badgeOf: quizToBase64(bank.badgeOf),
+    hasAudio: bank.hasAudio,
+  };
+}
+
+function quizBankFromJSON(json, file = null) {
+  return newQuizBank({
+    src: json.src,
+    file,
+    size: json.size,
+    mtime: json.mtime,
+    headers: json.headers,
+    count: json.count,
+    starts: quizFromBase64(json.starts, Uint32Array),
+    ends: quizFromBase64(json.ends, Uint32Array),
+    badges: json.badges,
+    badgeOf: quizFromBase64(json.badgeOf, Uint16Array),
+    hasAudio: json.hasAudio,
+  });
+}
+
+// ---- Decks ----
+// A deck is the play order as refs, (bank << QUIZ_ROW_BITS) | row. It is
+// rebuilt from its seed, so a cursor is just { banks, counts, seed, idx }.
+function quizRandom(seed) {
+  let t = seed >>> 0;
+  return () => {
+    t = (t + 0x6D2B79F5) >>> 0;
+    let r = Math.imul(t ^ (t >>> 15), 1 | t);
+    r = (r + Math.imul(r ^ (r >>> 7), 61 | r)) ^ r;
+    return ((r ^ (r >>> 14)) >>> 0) / 4294967296;
+  };
+}
+
+function quizShuffle(arr, rand) {
+  for (let i = arr.length - 1; i > 0; i--) {
+    const j = Math.floor(rand() * (i + 1));
+    [arr[i], arr[j]] = [arr[j], arr[i]];
+  }
+  return arr;
+}
+
+// counts[i] questions picked at random from banks[i], then all shuffled together
+function buildQuizDeck(banks, counts, seed) {
+  const rand = quizRandom(seed);
+  const refs = [];
+  banks.forEach((bank, b) => {
+    const rows = quizShuffle([...Array(bank.count).keys()], rand);
+    const n = Math.min(counts[b], rows.length);
+    for (let i = 0; i < n; i++) refs.push((b << QUIZ_ROW_BITS) | rows[i]);
+  });
+  return Uint32Array.from(quizShuffle(refs, rand));
+}
+
+function quizDeckBank(ref) { return ref >>> QUIZ_ROW_BITS; }
+function quizDeckRow(ref) { return ref & (QUIZ_MAX_ROWS - 1); }
+
+function newQuizSeed() { return (Math.random() * 4294967296) >>> 0; }
+
+// ---- Uploaded files ----
+// Kept whole in IndexedDB, not localStorage, so a file-backed bank can still
+// slice its rows after a reload
+function quizFileStore(mode) {
+  return new Promise((resolve, reject) => {
+    const open = indexedDB.open('quizFiles', 1);
+    open.onupgradeneeded = () => open.result.createObjectStore('files');
+    open.onsuccess = () => resolve(open.result.transaction('files', mode).objectStore('files'));
+    open.onerror = () => reject(open.error);
+  });
+}
+
+function quizFileRequest(request) {
+  return new Promise((resolve, reject) => {
+    request.onsuccess = () => resolve(request.result);
+    request.onerror = () => reject(request.error);
+  });
+}
+
+async function storeQuizFile(name, blob) {
+  return quizFileRequest((await quizFileStore('readwrite')).put(blob, name));
+}
+
+async function loadQuizFile(name) {
+  return quizFileRequest((await quizFileStore('readonly')).get(name));
+}
+
+async function clearQuizFiles() {
+  return quizFileRequest((await quizFileStore('readwrite')).clear());
+}
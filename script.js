@@ -231,8 +231,86 @@ function isAudioFile(value) {
   return audioExtensions.some(ext => lowerValue.endsWith(ext));
 }
 
+// === CSV ROW TO QUESTION ===
+// row is { header: value } as read back by readQuizRow(); quizItem is the
+// /api/quiz-files entry it came from, or null for an uploaded file
+function quizRowToQuestion(row, quizItem) {
+  const rowValues = Object.values(row);
+  const question = row.Question || row.question || row.Q || row.q || rowValues[0];
+  const answer = row.Answer || row.answer || row.A || row.a || rowValues[1];
+  
+  const questionObj = { q: question, a: answer };
+  
+  // Column 3 (index 2): always for audio files (if it exists)
+  // Support multiple header names: Audio, Music, File, etc.
+  let audioColumn = row.Audio || row.audio || row.AudioFile || row.audioFile || row.Music || row.music || row.File || row.file || '';
+  // Column 4 (index 3): always for badge category/level (if it exists)
+  // Support multiple header names: Badge, Icon, Category, Level, etc.
+  let badgeColumn = row.Badge || row.badge || row.Icon || row.icon || row.Category || row.category || row.Level || row.level || '';
+  if (!quizItem) {
+    // Uploaded CSVs may have other header names - fall back to position
+    audioColumn = audioColumn || (rowValues.length > 2 ? rowValues[2] : '') || '';
+    badgeColumn = badgeColumn || (rowValues.length > 3 ? rowValues[3] : '') || '';
+  }
+  
+  // Set audio file from column 3 (only if it exists and is not empty)
+  if (audioColumn && audioColumn.trim() !== '') {
+    questionObj.audioFile = audioColumn.trim();
+  }
+  
+  // Set badge/image from column 4 (only if it exists and is not empty)
+  if (badgeColumn && badgeColumn.trim() !== '') {
+    questionObj.level = badgeColumn.trim();
+    questionObj.iconPath = badgeIconPath(questionObj.level, quizItem);
+  }
+  
+  return questionObj;
+}
+
+// Column 4 is either a direct image path or a badge name
+function badgeIconPath(badge, quizItem) {
+  const imageExtensions = ['.png', '.svg', '.webp', '.jpg', '.jpeg', '.gif'];
+  if (!imageExtensions.some(ext => badge.toLowerCase().endsWith(ext))) {
+    // Badge name - try standard icon path
+    return getIconPath(badge);
+  }
+  
+  let imagePath = badge;
+  
+  // Remove Images/ prefix if present (images now go in quiz folder)
+  if (imagePath.startsWith('Images/')) {
+    imagePath = imagePath.replace('Images/', '');
+  }
+  
+  // Extract just the filename (remove any path)
+  const imageFilename = imagePath.split('/').pop();
+  
+  // Determine if quiz is in folder structure (music quiz or has folder)
+  const isInFolder = quizItem && (quizItem.type === 'music' || 
+    (quizItem.path && quizItem.path.split('/').length > 2)); // Path like Quizes/QuizName/QuizName.csv
+  
+  if (isInFolder) {
+    // Quiz is in folder structure - images are in the quiz folder
+    const quizFolderName = quizItem.path.split('/')[1]; // Quizes/QuizName/QuizName.csv -> QuizName
+    return `Quizes/${quizFolderName}/${imageFilename}`;
+  }
+  if (!imagePath.startsWith('http') && !imagePath.startsWith('/') && (quizItem || !imagePath.includes('/'))) {
+    // Old quizzes (flat files and uploads) keep their images in Images/
+    return `Images/${imageFilename}`;
+  }
+  // Has a path - use as-is (could be Quizes/QuizName/image.jpg)
+  return imagePath;
+}
+
 // === APP STATE ===
-let QA = [];
+// QA is the deck: refs into the banks of deckCategories (see quiz_bank.js).
+// Questions are read from their CSV row when the quiz reaches them.
+let QA = new Uint32Array(0);
+let deckCategories = [];
+let deckCounts = [];
+let deckMixed = false; // custom mix: label each question with its category
+let quizSeed = 0;
+let currentQA = null; // the question on screen
 let currentCategory = '';
 let availableCategories = [];
 let player1Score = 0;
@@ -336,7 +414,6 @@ const player2Tile = document.getElementById('player2Tile');
 const player1Name = document.querySelector('#player1Tile .player-name');
 const player2Name = document.querySelector('#player2Tile .player-name');
 
-let order = [];
 let idx = 0;
 
 // Lightboard settings
@@ -358,9 +435,8 @@ let player1NameText = 'Player 1';
 let player2NameText = 'Player 2';
 let isEditingName = false;
 
-// Quiz state persistence
-let currentQuestionIndex = 0;
-let savedOrder = null; // Store the shuffled order to restore exactly
+// Drops a render overtaken by navigation while its row was being read
+let renderSeq = 0;
 
 // Scoring system
 let roundComplete = false;
@@ -382,7 +458,7 @@ const sampleQuestions = [
 // === FILE HANDLING ===
 fileInput.addEventListener('change', handleFileSelect);
 
-function handleFileSelect(event) {
+async function handleFileSelect(event) {
   const files = event.target.files;
   if (files.length === 0) return;
 
@@ -390,137 +466,45 @@ function handleFileSelect(event) {
   availableCategories = [];
   fileList.innerHTML = '';
   
-  let loadedCount = 0;
-  const totalFiles = files.length;
+  // Show the loaded files section
+  loadedFiles.classList.remove('hidden');
 
-  Array.from(files).forEach((file, index) => {
-    if (file.type === 'text/csv' || file.name.endsWith('.csv')) {
-      const reader = new FileReader();
-      
-      reader.onload = function(e) {
-        try {
-          const csvText = e.target.result;
-          const csvData = parseCSV(csvText);
-          
-          // Convert CSV data to the expected format
-          const questions = csvData.map(row => {
-            const question = row.Question || row.question || row.Q || row.q || Object.values(row)[0];
-            const answer = row.Answer || row.answer || row.A || row.a || Object.values(row)[1];
-            
-            const questionObj = { q: question, a: answer };
-            
-            // Get column values - handle CSVs with 2, 3, or 4 columns
-            const rowValues = Object.values(row);
-            // Column 3 (index 2): always for audio files (if it exists)
-            // Support multiple header names: Audio, Music, File, etc.
-            const audioColumn = row.Audio || row.audio || row.AudioFile || row.audioFile || row.Music || row.music || row.File || row.file || (rowValues.length > 2 ? rowValues[2] : '') || '';
-            // Column 4 (index 3): always for badge category/level (if it exists)
-            // IMPORTANT: Don't use row.Level as it's set to the wrong column by parseCSV
-            // Support multiple header names: Badge, Icon, Category, Level, etc.
-            const badgeColumn = row.Badge || row.badge || row.Icon || row.icon || row.Category || row.category || (rowValues.length > 3 ? rowValues[3] : '') || '';
-            
-            // Set audio file from column 3 (only if it exists and is not empty)
-            if (audioColumn && audioColumn.trim() !== '') {
-              questionObj.audioFile = audioColumn.trim();
-            }
-            
-            // Set badge/image from column 4 (only if it exists and is not empty)
-            if (badgeColumn && badgeColumn.trim() !== '') {
-              questionObj.level = badgeColumn.trim();
-              // Check if column 4 is a direct image path (has image extension)
-              const imageExtensions = ['.png', '.svg', '.webp', '.jpg', '.jpeg', '.gif'];
-              const isImagePath = imageExtensions.some(ext => 
-                badgeColumn.trim().toLowerCase().endsWith(ext)
-              );
-              
-              if (isImagePath) {
-                // Column 4 is a direct image path
-                let imagePath = badgeColumn.trim();
-                
-                // Remove Images/ prefix if present (images now go in quiz folder)
-                if (imagePath.startsWith('Images/')) {
-                  imagePath = imagePath.replace('Images/', '');
-                }
-                
-                // Extract just the filename (remove any path)
-                const imageFilename = imagePath.split('/').pop();
-                
-                // For backward compatibility with old quizzes, check if it's in Images folder
-                // New quizzes with images will be in folder structure
-                if (!imagePath.startsWith('http') && !imagePath.startsWith('/') && !imagePath.includes('/')) {
-                  // Just a filename - try Images/ for old quizzes, but new ones use quiz folder
-                  imagePath = `Images/${imageFilename}`;
-                } else if (!imagePath.startsWith('http') && !imagePath.startsWith('/')) {
-                  // Has a path - use as-is (could be Quizes/QuizName/image.jpg)
-                  imagePath = imagePath;
-                }
-                questionObj.iconPath = imagePath;
-              } else {
-                // Column 4 is a badge name - try standard icon path
-                questionObj.iconPath = getIconPath(badgeColumn.trim());
-              }
-            }
-            
-            return questionObj;
-          }).filter(qa => qa.q && qa.a);
-          
-          if (questions.length > 0) {
-            const categoryName = file.name.replace('.csv', '').replace(/_/g, ' ').replace(/\b\w/g, l => l.toUpperCase());
-            availableCategories.push({
-              filename: file.name,
-              name: categoryName,
-              questions: questions
-            });
-            
-            // Add success message to file list
-            addFileToList(file.name, `${questions.length} questions`, 'success');
-          } else {
-            addFileToList(file.name, 'No questions', 'error');
-          }
-        } catch (error) {
-          console.error('Error parsing CSV:', error);
-          addFileToList(file.name, 'Error', 'error');
-        }
-        
-        loadedCount++;
-        
-        // If all files are processed, show category selector
-        if (loadedCount === totalFiles) {
-          if (availableCategories.length > 0) {
-            showCategorySelector();
-            createCategoryButtons(availableCategories);
-          }
-        }
-      };
-      
-      reader.onerror = function() {
-        addFileToList(file.name, 'Read failed', 'error');
-        loadedCount++;
-        
-        if (loadedCount === totalFiles) {
-          if (availableCategories.length > 0) {
-            showCategorySelector();
-            createCategoryButtons(availableCategories);
-          }
-        }
-      };
-      
-      reader.readAsText(file);
-    } else {
+  for (const file of Array.from(files)) {
+    if (!(file.type === 'text/csv' || file.name.endsWith('.csv'))) {
       addFileToList(file.name, 'Not CSV', 'error');
-      loadedCount++;
+      continue;
+    }
+    
+    try {
+      // Index only - questions are sliced from the file as the quiz reaches them
+      const bank = await indexQuizBank(file);
       
-      if (loadedCount === totalFiles) {
-        if (availableCategories.length > 0) {
-          showCategorySelector();
-          createCategoryButtons(availableCategories);
-        }
+      if (bank.count > 0) {
+        const categoryName = file.name.replace('.csv', '').replace(/_/g, ' ').replace(/\b\w/g, l => l.toUpperCase());
+        availableCategories.push({
+          filename: file.name,
+          name: categoryName,
+          bank: bank,
+          quizItem: null,
+          toQuestion: row => quizRowToQuestion(row, null)
+        });
+        
+        // Add success message to file list
+        addFileToList(file.name, `${bank.count} questions`, 'success');
+      } else {
+        addFileToList(file.name, 'No questions', 'error');
       }
+    } catch (error) {
+      console.error('Error indexing CSV:', error);
+      addFileToList(file.name, 'Error', 'error');
     }
-  });
+  }
   
-  // Show the loaded files section
-  loadedFiles.classList.remove('hidden');
+  // All files are processed, show category selector
+  if (availableCategories.length > 0) {
+    showCategorySelector();
+    createCategoryButtons(availableCategories);
+  }
 }
 
 function addFileToList(filename, message, status) {
@@ -542,7 +526,7 @@ function showCategorySelector() {
   const quizEditorSection = document.getElementById('quizEditorSection');
   if (quizEditorSection) quizEditorSection.classList.remove('hidden');
   currentCategory = '';
-  QA = [];
+  QA = new Uint32Array(0);
   console.log('Category selector shown, file input visible');
 }
 
@@ -604,7 +588,7 @@ function createCategoryButtons(categories) {
         <div class="category-name-container">
           <span class="category-name-text">${category.name}</span>
         </div>
-        <div style="font-size: 12px; color: var(--muted);">${category.questions.length} questions</div>
+        <div style="font-size: 12px; color: var(--muted);">${category.bank.count} questions</div>
       </div>
     `;
   }).join('');
@@ -736,13 +720,16 @@ function createCategoryButtons(categories) {
 }
 
 // === IMAGE PRELOADING ===
-function preloadImages(questions) {
-  // Collect all unique icon paths
+function preloadImages(categories) {
+  // Collect all unique icon paths from the badges the index found
   const iconPaths = new Set();
-  questions.forEach(qa => {
-    if (qa.iconPath) {
-      iconPaths.add(qa.iconPath);
-    }
+  categories.forEach(category => {
+    category.bank.badges.forEach(badge => {
+      const iconPath = badge && badgeIconPath(badge, category.quizItem);
+      if (iconPath) {
+        iconPaths.add(iconPath);
+      }
+    });
   });
   
   // Preload each image
@@ -765,13 +752,13 @@ function loadCategory(filename) {
     return;
   }
 
-  QA = category.questions;
+  startDeck([category], [category.bank.count], newQuizSeed());
   currentCategory = category.name;
   currentQuizType = category.type || 'regular';
   quizTitle.textContent = currentCategory;
   
   // Preload all images for this category
-  preloadImages(QA);
+  preloadImages(deckCategories);
   
   // Music controls visibility will be handled per-question in render()
   // Initially hide them, they'll be shown if the first question has audio
@@ -782,7 +769,6 @@ function loadCategory(filename) {
   hideWinner();
   
   showQuizDisplay();
-  setOrder(true);
   render(true);
   enableControls();
 }
@@ -797,7 +783,7 @@ function createCategorySelectionItems(categories) {
       <input type="checkbox" class="category-checkbox" id="cat-${index}" data-index="${index}">
       <div class="category-info">
         <div class="category-name">${category.name}</div>
-        <div class="category-count">${category.questions.length} questions</div>
+        <div class="category-count">${category.bank.count} questions</div>
       </div>
       <div class="ratio-controls">
         <span class="ratio-label">Ratio:</span>
@@ -887,7 +873,7 @@ function updateTotalQuestions() {
       index: cat.index,
       ratio: cat.ratio,
       proportional: proportional,
-      available: category.questions.length
+      available: category.bank.count
     };
   });
   
@@ -936,7 +922,8 @@ function loadCustomQuiz() {
   }
   
   // Build the custom quiz
-  QA = [];
+  const categories = [];
+  const counts = [];
   const categoryNames = [];
   let hasMusicQuiz = false;
   
@@ -949,7 +936,7 @@ function loadCustomQuiz() {
       index: cat.index,
       ratio: cat.ratio,
       proportional: proportional,
-      available: category.questions.length,
+      available: category.bank.count,
       category: category
     };
   });
@@ -965,21 +952,10 @@ function loadCustomQuiz() {
     }
   });
   
-  // Calculate and load questions for each category
+  // Calculate the number of questions from each category
   proportionalAmounts.forEach(item => {
-    const questionsForCategory = Math.round(item.proportional * scaleFactor);
-    
-    // Shuffle the category questions and take the required number
-    const shuffledQuestions = shuffle([...item.category.questions]);
-    const selectedQuestions = shuffledQuestions.slice(0, questionsForCategory);
-    
-    // Add category information to each question
-    const questionsWithCategory = selectedQuestions.map(qa => ({
-      ...qa,
-      category: item.category.name
-    }));
-    
-    QA = QA.concat(questionsWithCategory);
+    categories.push(item.category);
+    counts.push(Math.round(item.proportional * scaleFactor));
     categoryNames.push(item.category.name);
     
     // Check if any category is a music quiz
@@ -988,8 +964,8 @@ function loadCustomQuiz() {
     }
   });
   
-  // Shuffle the final combined questions
-  QA = shuffle(QA);
+  // Picks the questions and shuffles them all together
+  startDeck(categories, counts, newQuizSeed(), 0, true);
   
   // Format category title - limit to 3 category names, otherwise show count
   let categoryTitle;
@@ -1004,7 +980,7 @@ function loadCustomQuiz() {
   quizTitle.textContent = currentCategory;
   
   // Preload all images for custom quiz
-  preloadImages(QA);
+  preloadImages(deckCategories);
   
   // Music controls visibility will be handled per-question in render()
   // Initially hide them, they'll be shown if the first question has audio
@@ -1015,7 +991,6 @@ function loadCustomQuiz() {
   hideWinner();
   
   showQuizDisplay();
-  setOrder(true);
   render(true);
   enableControls();
 }
@@ -1026,24 +1001,41 @@ function enableControls() {
   btnToggle.disabled = false;
 }
 
-function shuffle(arr){
-  for (let i = arr.length - 1; i > 0; i--) {
-    const j = Math.floor(Math.random() * (i + 1));
-    [arr[i], arr[j]] = [arr[j], arr[i]];
-  }
-  return arr;
+// The deck is rebuilt from its seed, so saveQuizCursor() can resume it after a reload
+function startDeck(categories, counts, seed, startIdx = 0, mixed = false) {
+  deckCategories = categories;
+  deckCounts = counts;
+  deckMixed = mixed;
+  quizSeed = seed;
+  QA = buildQuizDeck(categories.map(category => category.bank), counts, seed);
+  idx = startIdx < QA.length ? startIdx : 0;
 }
 
-function setOrder(randomize) {
-  order = [...Array(QA.length).keys()];
-  if (randomize) shuffle(order);
-  idx = 0;
+async function questionAt(i) {
+  const ref = QA[i];
+  const category = deckCategories[quizDeckBank(ref)];
+  const qa = category.toQuestion(await readQuizRow(category.bank, quizDeckRow(ref)));
+  qa.source = category;
+  if (deckMixed) qa.category = category.name;
+  return qa;
 }
 
-function render(hideAnswer = true) {
+async function render(hideAnswer = true) {
   if (QA.length === 0) return;
   
-  const qa = QA[ order[idx] ];
+  const seq = ++renderSeq;
+  const at = idx;
+  let qa;
+  try {
+    qa = await questionAt(at);
+  } catch (error) {
+    console.error('Error reading question:', error);
+    return;
+  }
+  if (seq !== renderSeq) return;
+  currentQA = qa;
+  saveQuizCursor();
+  
   qEl.textContent = qa.q;
   answerText.textContent = qa.a;
   
@@ -1099,11 +1091,17 @@ function render(hideAnswer = true) {
     aEl.classList.remove('show');
     btnToggle.textContent = 'Show Answer';
   }
-  counterEl.textContent = `${idx+1} / ${QA.length}`;
+  counterEl.textContent = `${at+1} / ${QA.length}`;
+  
+  // Read the neighbouring rows now so next/prev doesn't wait on them
+  if (QA.length > 1) {
+    questionAt((at + 1) % QA.length).catch(() => {});
+    questionAt((at + QA.length - 1) % QA.length).catch(() => {});
+  }
 }
 
 function next() {
-  if (idx < order.length - 1) { 
+  if (idx < QA.length - 1) { 
     idx++; 
     render(); 
   } else {
@@ -1122,7 +1120,7 @@ function prev() {
     idx--; 
     render(); 
   } else {
-    idx = order.length - 1; 
+    idx = QA.length - 1; 
     render(); 
   }
   // Reset game state when navigating to new question
@@ -1139,9 +1137,9 @@ function toggleAnswer() {
 
 // === MUSIC QUIZ FUNCTIONS ===
 function playMusic() {
-  if (QA.length === 0) return;
+  if (QA.length === 0 || !currentQA) return;
   
-  const currentQuestion = QA[order[idx]];
+  const currentQuestion = currentQA;
   if (!currentQuestion.audioFile) {
     musicStatus.textContent = '';
     return;
@@ -1150,19 +1148,8 @@ function playMusic() {
   // Stop any currently playing music
   stopMusic();
   
-  // Find the current category to get the folder path
-  // For custom mix quizzes, use the question's category property
-  // For regular quizzes, find by matching the QA array or category name
-  let currentCategoryData;
-  if (currentQuestion.category && currentCategory && currentCategory.startsWith('Custom Mix:')) {
-    // Custom mix quiz - find category by the question's category property
-    currentCategoryData = availableCategories.find(cat => cat.name === currentQuestion.category);
-  } else {
-    // Regular quiz - find by matching QA array or category name
-    currentCategoryData = availableCategories.find(cat => 
-      cat.questions === QA || cat.name === currentCategory
-    );
-  }
+  // The category the current question was read from has the folder path
+  const currentCategoryData = currentQuestion.source;
   
   if (!currentCategoryData) {
     console.warn('Could not find category data for audio file:', currentQuestion.audioFile);
@@ -1298,16 +1285,10 @@ function savePersistedData() {
     localStorage.setItem('lightboardP2ColorIndex', lightboardP2ColorIndex.toString());
     localStorage.setItem('damageMultiplierValue', damageMultiplierValue.toString());
     
-    // Save categories
-    localStorage.setItem('quizCategories', JSON.stringify(availableCategories));
-    
     // Save current quiz state
     if (currentCategory) {
       localStorage.setItem('currentCategory', currentCategory);
-      localStorage.setItem('currentQuestionIndex', currentQuestionIndex.toString());
-      if (order.length > 0) {
-        localStorage.setItem('savedOrder', JSON.stringify(order));
-      }
+      saveQuizCursor();
     }
   } catch (error) {
     console.error('Error saving persisted data:', error);
@@ -1339,11 +1320,10 @@ function loadPersistedData() {
     if (savedP2Color !== null) lightboardP2ColorIndex = parseInt(savedP2Color);
     if (savedMultiplier !== null) damageMultiplierValue = parseInt(savedMultiplier);
     
-    // Load categories
-    const savedCategories = localStorage.getItem('quizCategories');
-    if (savedCategories) {
-      availableCategories = JSON.parse(savedCategories);
-    }
+    // Questions are no longer stored whole; loadAllQuizzes() uses the 'quizIndex' cache instead
+    localStorage.removeItem('quizCategories');
+    localStorage.removeItem('savedOrder');
+    localStorage.removeItem('currentQuestionIndex');
     
     // Update UI
     player1Name.textContent = player1NameText;
@@ -1362,6 +1342,57 @@ function loadPersistedData() {
   }
 }
 
+// The deck as { files, counts, seed, idx }: enough to rebuild it after a reload
+function saveQuizCursor() {
+  try {
+    // Uploaded files are gone after a reload, so only server quizzes can resume
+    if (QA.length === 0 || deckCategories.some(category => !category.quizItem)) {
+      localStorage.removeItem('quizCursor');
+      return;
+    }
+    localStorage.setItem('quizCursor', JSON.stringify({
+      title: currentCategory,
+      type: currentQuizType,
+      files: deckCategories.map(category => category.quizItem.path),
+      counts: deckCounts,
+      mixed: deckMixed,
+      seed: quizSeed,
+      idx: idx
+    }));
+  } catch (error) {
+    console.error('Error saving quiz cursor:', error);
+  }
+}
+
+// Resume the quiz that was on screen before the page reloaded
+function restoreQuizCursor() {
+  let cursor = null;
+  try {
+    cursor = JSON.parse(localStorage.getItem('quizCursor'));
+  } catch (error) {
+    console.error('Error loading quiz cursor:', error);
+  }
+  if (!cursor || !Array.isArray(cursor.files) || cursor.files.length === 0) return;
+  
+  const categories = cursor.files.map(path =>
+    availableCategories.find(cat => cat.quizItem && cat.quizItem.path === path));
+  if (categories.some(category => !category)) return;
+  
+  startDeck(categories, cursor.counts, cursor.seed, cursor.idx, cursor.mixed);
+  currentCategory = cursor.title;
+  currentQuizType = cursor.type || 'regular';
+  quizTitle.textContent = currentCategory;
+  preloadImages(deckCategories);
+  
+  musicControls.classList.add('hidden');
+  stopMusic();
+  hideWinner();
+  showQuizDisplay();
+  render(true);
+  enableControls();
+  console.log(`Resumed ${currentCategory} at question ${idx + 1}`);
+}
+
 // === RESET FUNCTIONALITY ===
 resetAllData.addEventListener('click', () => {
   resetModal.classList.remove('hidden');
@@ -1376,16 +1407,15 @@ confirmReset.addEventListener('click', () => {
   localStorage.clear();
   
   // Reset all variables to default state
-  QA = [];
+  QA = new Uint32Array(0);
+  deckCategories = [];
+  currentQA = null;
   currentCategory = '';
   availableCategories = [];
   player1Score = 0;
   player2Score = 0;
   player1NameText = 'Player 1';
   player2NameText = 'Player 2';
-  currentQuestionIndex = 0;
-  savedOrder = null;
-  order = [];
   idx = 0;
   roundComplete = false;
   
@@ -1868,9 +1898,9 @@ function exitToCategories(keepNames = false, keepScores = false, keepLightboardS
   
   // Reset quiz progress
   removeScorableState();
-  currentQuestionIndex = 0;
-  savedOrder = null;
-  order = [];
+  QA = new Uint32Array(0);
+  deckCategories = [];
+  currentQA = null;
   idx = 0;
   roundComplete = false;
   
@@ -1926,6 +1956,7 @@ function exitToCategories(keepNames = false, keepScores = false, keepLightboardS
   
   // Save current state to localStorage
   savePersistedData();
+  localStorage.removeItem('quizCursor');
   
   // Return to category selector
   showCategorySelector();
@@ -2736,6 +2767,36 @@ async function getQuizFiles() {
   }
 }
 
+// Indexes of the server's quiz files by path, so a reload doesn't stream them all again
+function loadQuizIndex() {
+  try {
+    return JSON.parse(localStorage.getItem('quizIndex')) || {};
+  } catch (error) {
+    console.error('Error loading quiz index:', error);
+    return {};
+  }
+}
+
+function saveQuizIndex(quizIndex) {
+  try {
+    localStorage.setItem('quizIndex', JSON.stringify(quizIndex));
+  } catch (error) {
+    console.error('Error saving quiz index:', error);
+  }
+}
+
+// The cached index is reused while the file's size and mtime still match
+async function loadQuizBank(quizItem, quizIndex, nextIndex) {
+  const cached = quizIndex[quizItem.path];
+  if (cached && cached.src === quizItem.path && cached.size === quizItem.size && cached.mtime === quizItem.mtime) {
+    nextIndex[quizItem.path] = cached;
+    return quizBankFromJSON(cached);
+  }
+  const bank = await indexQuizBank(quizItem.path, { size: quizItem.size, mtime: quizItem.mtime });
+  nextIndex[quizItem.path] = quizBankToJSON(bank);
+  return bank;
+}
+
 // Preload all quiz files from Quizes folder
 async function loadAllQuizzes() {
   try {
@@ -2745,105 +2806,27 @@ async function loadAllQuizzes() {
     availableCategories = [];
     fileList.innerHTML = '';
     
+    const quizIndex = loadQuizIndex();
+    const nextIndex = {};
     let loadedCount = 0;
     const totalItems = quizItems.length;
     
     for (const quizItem of quizItems) {
       try {
-        const response = await fetch(quizItem.path);
-        if (!response.ok) {
-          console.warn(`Failed to load ${quizItem.path}: ${response.status}`);
-          addFileToList(quizItem.name, 'Not found', 'error');
-          loadedCount++;
-          continue;
-        }
-        
-        const csvText = await response.text();
-        const csvData = parseCSV(csvText);
-        
-        // Convert CSV data to the expected format
-        const questions = csvData.map(row => {
-          const question = row.Question || row.question || row.Q || row.q || Object.values(row)[0];
-          const answer = row.Answer || row.answer || row.A || row.a || Object.values(row)[1];
-          
-          const questionObj = { q: question, a: answer };
-          
-          // Get column values - handle CSVs with 2, 3, or 4 columns
-          // IMPORTANT: Object.values() doesn't guarantee order, so we need to access by header name
-          // Column 3 (index 2): always for audio files (if it exists)
-          // Support multiple header names: Audio, Music, File, etc.
-          const audioColumn = row.Audio || row.audio || row.AudioFile || row.audioFile || row.Music || row.music || row.File || row.file || '';
-          
-          // Column 4 (index 3): always for badge category/level (if it exists)
-          // IMPORTANT: Don't use row.Level as it's set to the wrong column by parseCSV
-          // Support multiple header names: Badge, Icon, Category, Level, etc.
-          const badgeColumn = row.Badge || row.badge || row.Icon || row.icon || row.Category || row.category || row.Level || row.level || '';
-          
-          // Set audio file from column 3 (only if it exists and is not empty)
-          if (audioColumn && audioColumn.trim() !== '') {
-            questionObj.audioFile = audioColumn.trim();
-          }
-          
-          // Set badge/image from column 4 (only if it exists and is not empty)
-          if (badgeColumn && badgeColumn.trim() !== '') {
-            questionObj.level = badgeColumn.trim();
-            // Check if column 4 is a direct image path (has image extension)
-            const imageExtensions = ['.png', '.svg', '.webp', '.jpg', '.jpeg', '.gif'];
-            const isImagePath = imageExtensions.some(ext => 
-              badgeColumn.trim().toLowerCase().endsWith(ext)
-            );
-            
-            if (isImagePath) {
-              // Column 4 is a direct image path - use it as-is
-              let imagePath = badgeColumn.trim();
-              
-              // Remove Images/ prefix if present (images now go in quiz folder)
-              if (imagePath.startsWith('Images/')) {
-                imagePath = imagePath.replace('Images/', '');
-              }
-              
-              // Extract just the filename (remove any path)
-              const imageFilename = imagePath.split('/').pop();
-              
-              // Determine if quiz is in folder structure (music quiz or has folder)
-              const isInFolder = quizItem.type === 'music' || 
-                (quizItem.path && quizItem.path.split('/').length > 2); // Path like Quizes/QuizName/QuizName.csv
-              
-              if (isInFolder) {
-                // Quiz is in folder structure - images are in the quiz folder
-                // Extract quiz folder name from path
-                const pathParts = quizItem.path.split('/');
-                const quizFolderName = pathParts[1]; // Quizes/QuizName/QuizName.csv -> QuizName
-                imagePath = `Quizes/${quizFolderName}/${imageFilename}`;
-              } else if (!imagePath.startsWith('http') && !imagePath.startsWith('/')) {
-                // Regular quiz (flat file) - check if it's an old image in Images/ folder
-                // For backward compatibility, try Images/ first, but new images go in quiz folder
-                // Since regular quizzes with images now create folders, this is mainly for old quizzes
-                imagePath = `Images/${imageFilename}`;
-              }
-              
-              questionObj.iconPath = imagePath;
-              console.log(`Set iconPath for question: ${imagePath} (from badge: ${badgeColumn.trim()})`);
-            } else {
-              // Column 4 is a badge name - try standard icon path
-              questionObj.iconPath = getIconPath(badgeColumn.trim());
-            }
-          }
-          
-          return questionObj;
-        }).filter(qa => qa.q && qa.a);
+        const bank = await loadQuizBank(quizItem, quizIndex, nextIndex);
         
-        if (questions.length > 0) {
+        if (bank.count > 0) {
           const categoryName = quizItem.name.replace('.csv', '').replace(/_/g, ' ').replace(/\b\w/g, l => l.toUpperCase());
           
           // Check if any questions have audio files - if so, it's a music quiz
-          const hasAudioFiles = questions.some(q => q.audioFile && q.audioFile.trim() !== '');
-          const quizType = hasAudioFiles ? 'music' : (quizItem.type || 'regular');
+          const quizType = bank.hasAudio ? 'music' : (quizItem.type || 'regular');
           
           const categoryData = {
             filename: quizItem.name,
             name: categoryName,
-            questions: questions,
+            bank: bank,
+            quizItem: quizItem,
+            toQuestion: row => quizRowToQuestion(row, quizItem),
             type: quizType
           };
           
@@ -2856,7 +2839,7 @@ async function loadAllQuizzes() {
           
           // Add success message to file list
           const typeIndicator = quizType === 'music' ? '🎵 ' : '';
-          addFileToList(quizItem.name, `${typeIndicator}${questions.length} questions`, 'success');
+          addFileToList(quizItem.name, `${typeIndicator}${bank.count} questions`, 'success');
         } else {
           addFileToList(quizItem.name, 'No questions', 'error');
         }
@@ -2868,6 +2851,9 @@ async function loadAllQuizzes() {
       loadedCount++;
     }
     
+    // Only files still on the server stay cached
+    saveQuizIndex(nextIndex);
+    
     // Show category selector when all files are processed
     // BUT only if we're not in the quiz editor
     if (availableCategories.length > 0) {
@@ -2896,12 +2882,17 @@ async function loadAllQuizzes() {
 }
 
 // Demo data for testing without CSV files (fallback)
-function loadDemoData() {
+async function loadDemoData() {
+  const csv = 'Question,Answer,Category\n' +
+    sampleQuestions.map(qa => `"${qa.q}","${qa.a}","${qa.category}"`).join('\n');
+  const bank = await indexQuizBank(new Blob([csv], { type: 'text/csv' }));
   const demoCategories = [
     {
       filename: 'demo.csv',
       name: 'Demo Quiz',
-      questions: sampleQuestions
+      bank: bank,
+      quizItem: null,
+      toQuestion: row => ({ q: row.Question, a: row.Answer, category: row.Category })
     }
   ];
   
@@ -2910,7 +2901,7 @@ function loadDemoData() {
   createCategoryButtons(availableCategories);
   
   // Add demo file to the list
-  addFileToList('demo.csv', '10 questions (demo)', 'success');
+  addFileToList('demo.csv', `${bank.count} questions (demo)`, 'success');
   loadedFiles.classList.remove('hidden');
 }
 
@@ -3295,8 +3286,8 @@ document.addEventListener('DOMContentLoaded', function() {
     });
   }
   
-  // Load all quiz files immediately
-  loadAllQuizzes();
+  // Load all quiz files immediately, then pick up a quiz left open by a reload
+  loadAllQuizzes().then(restoreQuizCursor);
 });
 
 // Cleanup on page unload
@@ -3,7 +3,6 @@ import http from "http";
 import { Server } from "socket.io";
 import cors from "cors";
 import { SerialPort } from "serialport";
-import { ReadlineParser } from "@serialport/parser-readline";
 import fs from "fs";
 import path from "path";
 import multer from "multer";
@@ -538,6 +537,14 @@ app.post("/api/delete-quiz", (req, res) => {
   }
 });
 
+// Size and mtime let the UI tell whether its cached quiz index is still current
+function withFileStat(quizItem) {
+  const stat = fs.statSync(path.join(process.cwd(), quizItem.path));
+  quizItem.size = stat.size;
+  quizItem.mtime = stat.mtimeMs;
+  return quizItem;
+}
+
 // Quiz files listing endpoint
 app.get("/api/quiz-files", (req, res) => {
   try {
@@ -556,11 +563,11 @@ app.get("/api/quiz-files", (req, res) => {
     for (const item of items) {
       if (item.isFile() && item.name.toLowerCase().endsWith('.csv')) {
         // Regular CSV quiz file
-        quizItems.push({
+        quizItems.push(withFileStat({
           type: 'regular',
           name: item.name,
           path: `Quizes/${item.name}`
-        });
+        }));
       } else if (item.isDirectory()) {
         // Check if it's a quiz folder (music quiz or quiz with images)
         const folderPath = path.join(quizesDir, item.name);
@@ -590,14 +597,14 @@ app.get("/api/quiz-files", (req, res) => {
             if (audioFiles.length > 0) {
               quizItem.audioFiles = audioFiles.map(file => `Quizes/${item.name}/${file}`);
             }
-            quizItems.push(quizItem);
+            quizItems.push(withFileStat(quizItem));
           } else {
             // Folder with CSV but no audio or image files - treat as regular quiz
-            quizItems.push({
+            quizItems.push(withFileStat({
               type: 'regular',
               name: `${item.name}.csv`,
               path: `Quizes/${item.name}/${item.name}.csv`
-            });
+            }));
           }
         }
       }
@@ -615,13 +622,262 @@ app.get("/api/quiz-files", (req, res) => {
 
 app.use(express.static(".")); // serve files from home directory (AFTER API routes)
 
+// Binary serial framing shared with Bridge.ino (see "Binary Framing" there):
+//   [0xA5][0x5A][type][len][payload][crc16 lo][crc16 hi]
+// Negotiated with {"cmd":"hello","proto":1}; JSON lines stay supported both ways.
+// Set BRIDGE_SERIAL_JSON=1 to stay in JSON mode for debugging.
+const FRAME_SOF1 = 0xA5;
+const FRAME_SOF2 = 0x5A;
+const FRAME_MAX_PAYLOAD = 32;
+const SERIAL_PROTO_VERSION = 3; // 3: N players (winner id, tie = 0xFF)
+const FRAME = {
+  // Bridge -> Pi
+  HIT: 0x01, WINNER: 0x02, STATUS: 0x03, RESET: 0x04,
+  HIT_LOCATION: 0x05, LB_STATE_REQ: 0x06, ERROR: 0x07, QUIZ_ACTION: 0x08,
+  LB_STATE: 0x09, TELEM_STAGE: 0x0A, TELEM_COUNTERS: 0x0B, PLAYER_STATUS: 0x0C,
+  // Pi -> Bridge
+  CMD_HEARTBEAT: 0x81, CMD_RESET: 0x82, CMD_AWARD: 0x83,
+  CMD_LB_SETTINGS: 0x84, CMD_LB_STATE: 0x85, CMD_QUIZ_ACTION: 0x86
+};
+const ERROR_MESSAGES = { 1: 'Player 1 disconnected', 2: 'Player 2 disconnected', 3: 'Lightboard disconnected', 4: 'Pi command too long' };
+const QUIZ_ACTIONS = ['', 'next', 'prev', 'toggle'];
+const LOCATION_MODES = ['none', 'tdoa', 'partial', 'nearest'];
+// TelemetryStage order in telemetry.h
+const TELEMETRY_STAGES = ['capture', 'send', 'sent', 'solve', 'dispatch', 'decide', 'piSend', 'show', 'loop'];
+const TELEMETRY_DEVICES = { 0: 'bridge', 240: 'lightboard' }; // others are player ids
+
+// CRC-16/CCITT-FALSE, same as crc16Update() on the bridge
+function crc16(bytes, crc = 0xFFFF) {
+  for (const b of bytes) {
+    crc ^= b << 8;
+    for (let i = 0; i < 8; i++) crc = (crc & 0x8000) ? ((crc << 1) ^ 0x1021) & 0xFFFF : (crc << 1) & 0xFFFF;
+  }
+  return crc;
+}
+
+function encodeFrame(type, payload = Buffer.alloc(0)) {
+  const frame = Buffer.alloc(6 + payload.length);
+  frame[0] = FRAME_SOF1;
+  frame[1] = FRAME_SOF2;
+  frame[2] = type;
+  frame[3] = payload.length;
+  payload.copy(frame, 4);
+  frame.writeUInt16LE(crc16(frame.subarray(2, 4 + payload.length)), 4 + payload.length);
+  return frame;
+}
+
+// Decode a bridge frame into the same object the JSON protocol produces
+function decodeBridgeFrame(type, p) {
+  switch (type) {
+    case FRAME.HIT:
+      if (p.length < 11) return null;
+      return { type: 'hit', player: p[0], time: Number(p.readBigInt64LE(1)), strength: p.readUInt16LE(9) };
+    case FRAME.WINNER:
+      if (p.length < 1) return null;
+      {
+        const msg = { type: 'winner', winner: p[0] === 0xFF ? 'Tie' : p[0] ? `Player ${p[0]}` : 'none' };
+        // Arbitration margin (absent from older bridges)
+        if (p.length >= 7) {
+          msg.marginUs = p.readUInt32LE(1);
+          msg.uncertaintyUs = p.readUInt16LE(5);
+        }
+        return msg;
+      }
+    case FRAME.STATUS:
+      if (p.length < 1) return null;
+      return {
+        type: 'status',
+        player1Connected: !!(p[0] & 0x01),
+        player2Connected: !!(p[0] & 0x02),
+        lightboardConnected: !!(p[0] & 0x04),
+        clockSynced: !!(p[0] & 0x08),
+        player2ClockSynced: !!(p[0] & 0x10),
+        // Sync quality per player (absent from older bridges)
+        ...(p.length >= 13 ? {
+          player1SyncRttUs: p.readUInt16LE(1),
+          player1SyncJitterUs: p.readUInt16LE(3) / 10,
+          player1DriftPpm: p.readInt16LE(5) / 100,
+          player2SyncRttUs: p.readUInt16LE(7),
+          player2SyncJitterUs: p.readUInt16LE(9) / 10,
+          player2DriftPpm: p.readInt16LE(11) / 100
+        } : {}),
+        // ESP-NOW traffic per peer: 16-bit wrapping counters
+        ...(p.length >= 31 ? {
+          player1TxPackets: p.readUInt16LE(13),
+          player1RxPackets: p.readUInt16LE(15),
+          player1AirtimeMs: p.readUInt16LE(17),
+          player2TxPackets: p.readUInt16LE(19),
+          player2RxPackets: p.readUInt16LE(21),
+          player2AirtimeMs: p.readUInt16LE(23),
+          lightboardTxPackets: p.readUInt16LE(25),
+          lightboardRxPackets: p.readUInt16LE(27),
+          lightboardAirtimeMs: p.readUInt16LE(29)
+        } : {})
+      };
+    case FRAME.PLAYER_STATUS:
+      // Players 3 and up (status carries 1 and 2)
+      if (p.length < 14) return null;
+      return {
+        type: 'playerStatus', player: p[0],
+        connected: !!(p[1] & 0x01), clockSynced: !!(p[1] & 0x02),
+        syncRttUs: p.readUInt16LE(2), syncJitterUs: p.readUInt16LE(4) / 10, driftPpm: p.readInt16LE(6) / 100,
+        txPackets: p.readUInt16LE(8), rxPackets: p.readUInt16LE(10), airtimeMs: p.readUInt16LE(12)
+      };
+    case FRAME.RESET:
+      return { type: 'reset' };
+    case FRAME.HIT_LOCATION:
+      if (p.length < 15) return null;
+      return {
+        type: 'hitLocation', player: p[0], time: Number(p.readBigInt64LE(3)),
+        x: p.readInt16LE(11), y: p.readInt16LE(13),
+        mode: LOCATION_MODES[p[1]] || 'none', sensors: p[2]
+      };
+    case FRAME.LB_STATE_REQ:
+      return { type: 'lightboardStateRequest' };
+    case FRAME.LB_STATE:
+      if (p.length < 21) return null;
+      {
+        // Score Order sequence: 2 bits per LED, LED 0 in the low bits of byte 11
+        const scoringSequence = [];
+        for (let i = 0; i < Math.min(p[5], 38); i++) scoringSequence.push((p[11 + (i >> 2)] >> ((i & 3) * 2)) & 0x03);
+        return {
+          type: 'lightboardState',
+          mode: p[0], p1ColorIndex: p[1], p2ColorIndex: p[2],
+          p1Pos: p.readInt8(3), p2Pos: p.readInt8(4), nextLedPos: p[5],
+          tugBoundary: p.readInt8(6), p1RacePos: p.readInt8(7), p2RacePos: p.readInt8(8),
+          celebrating: !!p[9], winner: p[10], scoringSequence
+        };
+      }
+    case FRAME.ERROR:
+      if (p.length < 1) return null;
+      if (p[0] === 5 && p.length >= 2) return { type: 'error', message: `Player ${p[1]} disconnected` };
+      return { type: 'error', message: ERROR_MESSAGES[p[0]] || `Bridge error ${p[0]}` };
+    case FRAME.QUIZ_ACTION:
+      if (p.length < 1 || !QUIZ_ACTIONS[p[0]]) return null;
+      return { type: 'quizAction', action: QUIZ_ACTIONS[p[0]] };
+    case FRAME.TELEM_STAGE:
+      if (p.length < 19 || !TELEMETRY_STAGES[p[1]]) return null;
+      return {
+        type: 'telemetry', device: p[0], stage: TELEMETRY_STAGES[p[1]], samples: p[2],
+        total: p.readUInt32LE(3), p50Us: p.readUInt32LE(7), p99Us: p.readUInt32LE(11), maxUs: p.readUInt32LE(15)
+      };
+    case FRAME.TELEM_COUNTERS:
+      if (p.length < 21) return null;
+      return {
+        type: 'telemetry', device: p[0], sendFailed: p.readUInt32LE(1), retries: p.readUInt32LE(5),
+        gaveUp: p.readUInt32LE(9), freeHeap: p.readUInt32LE(13), minFreeHeap: p.readUInt32LE(17)
+      };
+    default:
+      return null;
+  }
+}
+
+// Encode a Pi command as a frame, or null if it only exists in JSON form
+function encodeBridgeCommand(command) {
+  switch (command.cmd) {
+    case 'heartbeat':
+      return encodeFrame(FRAME.CMD_HEARTBEAT);
+    case 'reset':
+      return encodeFrame(FRAME.CMD_RESET);
+    case 'awardPoint':
+      return encodeFrame(FRAME.CMD_AWARD, Buffer.from([command.player & 0xFF, command.multiplier & 0xFF]));
+    case 'lightboardSettings':
+      return encodeFrame(FRAME.CMD_LB_SETTINGS, Buffer.from([command.mode & 0xFF, command.p1Color & 0xFF, command.p2Color & 0xFF]));
+    case 'lightboardState': {
+      const g = command.gameState || {};
+      const p = Buffer.alloc(21);
+      p[0] = g.mode & 0xFF;
+      p[1] = g.p1ColorIndex & 0xFF;
+      p[2] = g.p2ColorIndex & 0xFF;
+      p.writeInt8(g.p1Pos ?? -1, 3);
+      p.writeInt8(g.p2Pos ?? 38, 4);
+      p[5] = g.nextLedPos & 0xFF;
+      p.writeInt8(g.tugBoundary ?? 18, 6);
+      p.writeInt8(g.p1RacePos ?? -1, 7);
+      p.writeInt8(g.p2RacePos ?? -1, 8);
+      p[9] = g.celebrating ? 1 : 0;
+      p[10] = g.winner & 0xFF;
+      // Score Order sequence: 2 bits per LED, LED 0 in the low bits of byte 11
+      (g.scoringSequence || []).slice(0, 38).forEach((owner, i) => {
+        p[11 + (i >> 2)] |= (owner & 0x03) << ((i & 3) * 2);
+      });
+      return encodeFrame(FRAME.CMD_LB_STATE, p);
+    }
+    case 'quizAction': {
+      const action = QUIZ_ACTIONS.indexOf(command.action);
+      return action > 0 ? encodeFrame(FRAME.CMD_QUIZ_ACTION, Buffer.from([action])) : null;
+    }
+    default:
+      return null;
+  }
+}
+
+// Splits the bridge's serial stream into binary frames and text lines
+// (JSON messages and debug output)
+class BridgeStreamDecoder {
+  constructor(onFrame, onLine) {
+    this.onFrame = onFrame;
+    this.onLine = onLine;
+    this.line = [];
+    this.frame = null; // bytes of the frame being collected, from the type byte on
+    this.state = 'text';
+    this.crcErrors = 0;
+  }
+
+  push(chunk) {
+    for (const c of chunk) {
+      switch (this.state) {
+        case 'text':
+          if (c === FRAME_SOF1) {
+            this.state = 'sof2';
+          } else if (c === 0x0A) {
+            const text = Buffer.from(this.line).toString('utf8').trim();
+            this.line = [];
+            if (text.length > 0) this.onLine(text);
+          } else {
+            this.line.push(c);
+          }
+          break;
+        case 'sof2':
+          if (c === FRAME_SOF2) {
+            this.state = 'header';
+            this.frame = [];
+          } else if (c !== FRAME_SOF1) {
+            this.state = 'text';
+          }
+          break;
+        case 'header':
+          this.frame.push(c);
+          if (this.frame.length === 2) {
+            if (this.frame[1] > FRAME_MAX_PAYLOAD) { this.crcErrors++; this.state = 'text'; break; }
+            this.state = 'body';
+          }
+          break;
+        case 'body':
+          this.frame.push(c);
+          if (this.frame.length === 2 + this.frame[1] + 2) {
+            const bytes = Buffer.from(this.frame);
+            const len = bytes[1];
+            this.state = 'text';
+            if (crc16(bytes.subarray(0, 2 + len)) !== bytes.readUInt16LE(2 + len)) {
+              this.crcErrors++;
+              console.warn(`Dropped bridge frame with bad CRC (type 0x${bytes[0].toString(16)})`);
+              break;
+            }
+            this.onFrame(bytes[0], bytes.subarray(2, 2 + len));
+          }
+          break;
+      }
+    }
+  }
+}
+
 // ESP32 Serial Communication
 class ESP32Bridge {
   constructor(serialPort = '/dev/ttyUSB0', baudRate = 115200) {
     this.serialPort = serialPort;
     this.baudRate = baudRate;
     this.serialConnection = null;
-    this.parser = null;
     this.io = io;
     this.enabled = false; // Track if serial is enabled
     this.lightboardConnected = false; // Track if physical lightboard is connected via ESP-NOW
@@ -629,6 +885,11 @@ class ESP32Bridge {
     this.player2Connected = false; // Track if Player 2 is connected via ESP-NOW
     this.retryTimeout = null; // Track retry timeout for cleanup
     this.heartbeatInterval = null; // Track heartbeat interval timer
+    this.decoder = null; // Serial stream decoder (frames + text lines)
+    this.binaryProtocol = false; // Pi->Bridge commands go out as frames once negotiated
+    this.jsonOnly = process.env.BRIDGE_SERIAL_JSON === '1'; // compatibility/debug mode
+    this.telemetry = {}; // latest trace report per device name (GET /api/telemetry)
+    this.extraPlayers = {}; // latest playerStatus per player id, players 3 and up (GET /api/players)
     // Removed debounce variables - ESP32 handles awarding internally
   }
 
@@ -672,7 +933,10 @@ class ESP32Bridge {
         autoOpen: false
       });
 
-      this.parser = this.serialConnection.pipe(new ReadlineParser({ delimiter: '\n' }));
+      this.decoder = new BridgeStreamDecoder(
+        (type, payload) => this.handleSerialFrame(type, payload),
+        (line) => this.handleSerialMessage(line)
+      );
       
       this.serialConnection.on('open', () => {
         console.log(`Connected to ESP32 on ${this.serialPort}`);
@@ -685,6 +949,9 @@ class ESP32Bridge {
           player2Connected: this.player2Connected
         });
         
+        // Offer binary framing; older bridges ignore this and stay on JSON
+        this.negotiateProtocol();
+
         // Start sending periodic heartbeats to Bridge (every 2 seconds)
         // Bridge responds with status messages that include lightboard connection info
         this.startHeartbeat();
@@ -709,8 +976,8 @@ class ESP32Bridge {
         this.retryTimeout = setTimeout(() => this.startSerialCommunication(), 5000);
       });
 
-      this.parser.on('data', (data) => {
-        this.handleSerialMessage(data.trim());
+      this.serialConnection.on('data', (chunk) => {
+        this.decoder.push(chunk);
       });
 
       // Open the connection
@@ -742,10 +1009,90 @@ class ESP32Bridge {
     }
   }
 
+  negotiateProtocol() {
+    this.binaryProtocol = false;
+    this.sendToESP32({ cmd: 'hello', proto: this.jsonOnly ? 0 : SERIAL_PROTO_VERSION });
+  }
+
+  handleSerialFrame(type, payload) {
+    const data = decodeBridgeFrame(type, payload);
+    if (!data) {
+      console.warn(`Unknown or short bridge frame type 0x${type.toString(16)} (${payload.length} bytes)`);
+      return;
+    }
+    this.handleBridgeData(data);
+  }
+
   handleSerialMessage(message) {
+    let data;
     try {
       // Parse JSON message from ESP32
-      const data = JSON.parse(message);
+      data = JSON.parse(message);
+    } catch (error) {
+      // Handle non-JSON messages (like debug output)
+      console.log('Non-JSON message from ESP32:', message);
+
+      // Forward important status messages to frontend
+      if (message.includes('heartbeat') || 
+          message.includes('Clock sync') || 
+          message.includes('lightboard') ||
+          message.includes('Player') ||
+          message.includes('Status')) {
+        
+        // Send status message to frontend
+        this.io.emit('esp32_status_message', {
+          type: 'status',
+          message: message,
+          timestamp: new Date().toISOString()
+        });
+      }
+      return;
+    }
+
+    if (data.type === 'hello') {
+      this.binaryProtocol = !this.jsonOnly && data.proto === SERIAL_PROTO_VERSION;
+      console.log(`Bridge serial protocol: ${this.binaryProtocol ? 'binary' : 'json'}`);
+      return;
+    }
+
+    // A JSON status while binary was negotiated means the bridge restarted
+    if (data.type === 'status' && this.binaryProtocol) {
+      this.negotiateProtocol();
+    }
+
+    this.handleBridgeData(data);
+  }
+
+  // One stage or counters line from a device's report, merged into its entry
+  handleTelemetry(data) {
+    const { type, device, stage, ...fields } = data;
+    const name = TELEMETRY_DEVICES[device] || `player${device}`;
+    const entry = this.telemetry[name] || (this.telemetry[name] = { device, stages: {}, counters: null });
+    if (stage) entry.stages[stage] = fields;
+    else entry.counters = fields;
+    entry.updated = new Date().toISOString();
+    this.io.emit('esp32_telemetry', { name, ...data });
+  }
+
+  handleBridgeData(data) {
+    try {
+      // Every few seconds per device: too chatty for the log and the game UI
+      if (data.type === 'telemetry') {
+        this.handleTelemetry(data);
+        return;
+      }
+      // Sent with every status, one per player beyond the two-player UI
+      if (data.type === 'playerStatus') {
+        const { type, ...fields } = data;
+        const was = this.extraPlayers[data.player];
+        if (!was || was.connected !== data.connected) {
+          console.log(`Player ${data.player} connection status: ${data.connected ? 'connected' : 'disconnected'}`);
+        }
+        this.extraPlayers[data.player] = { ...fields, updated: new Date().toISOString() };
+        this.io.emit('esp32_player_status', fields);
+        return;
+      }
+
       console.log('Received from ESP32:', data);
       
       // Check if this is a status message with connection info
@@ -805,46 +1152,18 @@ class ESP32Bridge {
         return; // Don't forward this request to clients
       }
       
-      // Update state when receiving point awards from ESP32
-      if (data.type === 'winner' && data.winner) {
-        // Extract player number from winner string (e.g., "Player 1" -> 1)
-        const playerMatch = data.winner.match(/Player (\d+)/);
-        if (playerMatch) {
-          const player = parseInt(playerMatch[1]);
-          if (player === 1 || player === 2) {
-            lightboardState.awardPoint(player, 1);
-            console.log(`Updated lightboard state: Player ${player} scored`);
-          }
-        }
-      }
-      
-      // Update state when receiving reset from ESP32
-      if (data.type === 'reset') {
-        lightboardState.resetGame();
-        console.log('Reset lightboard state from ESP32');
+      // The bridge owns the board and reports it after every change (points,
+      // resets, settings); our copy only follows, so it never drifts
+      if (data.type === 'lightboardState') {
+        const { type, ...gameState } = data;
+        lightboardState.updateState({ gameState });
       }
       
       // Forward to all Socket.IO clients
       this.io.emit('esp32_data', data);
       
     } catch (error) {
-      // Handle non-JSON messages (like debug output)
-      console.log('Non-JSON message from ESP32:', message);
-
-      // Forward important status messages to frontend
-      if (message.includes('heartbeat') || 
-          message.includes('Clock sync') || 
-          message.includes('lightboard') ||
-          message.includes('Player') ||
-          message.includes('Status')) {
-        
-        // Send status message to frontend
-        this.io.emit('esp32_status_message', {
-          type: 'status',
-          message: message,
-          timestamp: new Date().toISOString()
-        });
-      }
+      console.error('Error handling message from ESP32:', error);
     }
   }
 
@@ -855,8 +1174,8 @@ class ESP32Bridge {
     }
     
     try {
-      const message = JSON.stringify(command) + '\n';
-      this.serialConnection.write(message);
+      const frame = this.binaryProtocol ? encodeBridgeCommand(command) : null;
+      this.serialConnection.write(frame || (JSON.stringify(command) + '\n'));
       console.log('Sent to ESP32:', command);
       // Surface to clients for debugging
       this.io.emit('esp32_status_message', {
@@ -895,7 +1214,7 @@ class ESP32Bridge {
     }
     
     try {
-      const message = JSON.stringify({ cmd: 'heartbeat' }) + '\n';
+      const message = this.binaryProtocol ? encodeFrame(FRAME.CMD_HEARTBEAT) : JSON.stringify({ cmd: 'heartbeat' }) + '\n';
       this.serialConnection.write(message);
     } catch (error) {
       console.error('Error sending heartbeat to Bridge:', error);
@@ -912,11 +1231,9 @@ class ESP32Bridge {
       this.retryTimeout = null;
     }
 
-    // Remove parser event listeners
-    if (this.parser) {
-      this.parser.removeAllListeners();
-      this.parser = null;
-    }
+    // Drop any partial frame/line and fall back to JSON until renegotiated
+    this.decoder = null;
+    this.binaryProtocol = false;
 
     // Close and cleanup serial connection
     if (this.serialConnection) {
@@ -1016,11 +1333,11 @@ app.get("/api/quiz-files", (req, res) => {
     for (const item of items) {
       if (item.isFile() && item.name.toLowerCase().endsWith('.csv')) {
         // Regular CSV quiz file
-        quizItems.push({
+        quizItems.push(withFileStat({
           type: 'regular',
           name: item.name,
           path: `Quizes/${item.name}`
-        });
+        }));
       } else if (item.isDirectory()) {
         // Check if it's a quiz folder (music quiz or quiz with images)
         const folderPath = path.join(quizesDir, item.name);
@@ -1050,14 +1367,14 @@ app.get("/api/quiz-files", (req, res) => {
             if (audioFiles.length > 0) {
               quizItem.audioFiles = audioFiles.map(file => `Quizes/${item.name}/${file}`);
             }
-            quizItems.push(quizItem);
+            quizItems.push(withFileStat(quizItem));
           } else {
             // Folder with CSV but no audio or image files - treat as regular quiz
-            quizItems.push({
+            quizItems.push(withFileStat({
               type: 'regular',
               name: `${item.name}.csv`,
               path: `Quizes/${item.name}/${item.name}.csv`
-            });
+            }));
           }
         }
       }
@@ -1113,6 +1430,15 @@ app.post("/api/delete-quiz", (req, res) => {
   }
 });
 
+// Latency trace points and link counters, as last reported by each device
+app.get("/api/telemetry", (req, res) => {
+  res.json(esp32Bridge.telemetry);
+});
+
+app.get("/api/players", (req, res) => {
+  res.json(esp32Bridge.extraPlayers);
+});
+
 // Health check endpoint
 app.get("/health", (req, res) => {
   const memUsage = process.memoryUsage();
@@ -0,0 +1,528 @@
+// TDoA impact localisation used by the player firmware (player_firmware.h).
+// Plain C++ with no Arduino dependencies so bench/ can build it on the host.
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+
+// Board limits applied to every solution
+struct TdoaLimits {
+  float minX, maxX;   // board bounds (meters) used to keep solutions on the board
+  float minY, maxY;
+  float rmsThreshM;   // solver acceptance threshold (meters RMS residual)
+};
+
+// ===================== Reference solver (double) =====================
+// Levenberg-damped Gauss-Newton seeded from the sensor centroid.
+template <int N>
+static bool tdoaSolve(const float *sx, const float *sy,
+                      const unsigned long *t, float vs, const TdoaLimits &lim,
+                      float &x, float &y, int &nUsed, int *iterations = nullptr)
+{
+  // Count available timestamps
+  int have = 0;
+  for (int i = 0; i < N; i++) if (t[i] != 0) have++;
+  nUsed = have;
+  if (have < 3) return false;
+
+  // Choose reference as earliest arrival
+  int ref = 0; unsigned long tref = ~0ul;
+  for (int i = 0; i < N; i++) {
+    if (t[i] && t[i] < tref) { tref = t[i]; ref = i; }
+  }
+
+  // Precompute TDoA (meters) relative to reference for used sensors
+  double dd[N];
+  bool use[N];
+  int rows = 0;
+  for (int i = 0; i < N; i++) {
+    if (i == ref || t[i] == 0) { use[i] = false; continue; }
+    double dt_us = double(t[i]) - double(tref);
+    dd[i] = double(vs) * dt_us * 1e-6; // meters
+    use[i] = true;
+    rows++;
+  }
+  if (rows < 2) return false;
+
+  // Initial guess: board center (or mean of sensor positions)
+  double xg = 0.0, yg = 0.0; int npos = 0;
+  for (int i = 0; i < N; i++) { xg += sx[i]; yg += sy[i]; npos++; }
+  xg /= (npos > 0 ? npos : 1);
+  yg /= (npos > 0 ? npos : 1);
+
+  // Keep iterations stable
+  const double eps = 1e-9;
+  const int maxIter = 15;
+  const double damping = 1e-6; // Levenberg damping
+
+  bool brokeSingular = false;
+  int it = 0;
+  for (; it < maxIter; it++) {
+    // Distances to reference and Jacobian accumulation
+    double dxr = xg - sx[ref];
+    double dyr = yg - sy[ref];
+    double Dr = sqrt(dxr*dxr + dyr*dyr); if (Dr < eps) Dr = eps;
+
+    double ATA00 = 0.0, ATA01 = 0.0, ATA11 = 0.0;
+    double ATb0 = 0.0, ATb1 = 0.0;
+
+    for (int i = 0; i < N; i++) {
+      if (!use[i]) continue;
+      double dxi = xg - sx[i];
+      double dyi = yg - sy[i];
+      double Di = sqrt(dxi*dxi + dyi*dyi); if (Di < eps) Di = eps;
+
+      // Residual: (Di - Dr) - dd[i] = 0
+      double ri = (Di - Dr) - dd[i];
+
+      // Jacobian wrt x and y
+      double dFdx = (dxi/Di) - (dxr/Dr);
+      double dFdy = (dyi/Di) - (dyr/Dr);
+
+      // Accumulate normal equations
+      ATA00 += dFdx * dFdx;
+      ATA01 += dFdx * dFdy;
+      ATA11 += dFdy * dFdy;
+      ATb0  += dFdx * ri;
+      ATb1  += dFdy * ri;
+    }
+
+    // Solve (J^T J + lambda I) delta = -J^T r
+    ATA00 += damping; ATA11 += damping;
+    double det = ATA00 * ATA11 - ATA01 * ATA01;
+    if (fabs(det) < 1e-12) { brokeSingular = true; break; }
+
+    double inv00 =  ATA11 / det;
+    double inv01 = -ATA01 / det;
+    double inv11 =  ATA00 / det;
+
+    double dx = -(inv00 * ATb0 + inv01 * ATb1);
+    double dy = -(inv01 * ATb0 + inv11 * ATb1);
+
+    // Limit step size to keep stable
+    double stepNorm = sqrt(dx*dx + dy*dy);
+    const double maxStep = 0.05; // meters per iteration
+    if (stepNorm > maxStep) {
+      dx *= (maxStep / stepNorm);
+      dy *= (maxStep / stepNorm);
+    }
+
+    xg += dx; yg += dy;
+
+    if (sqrt(dx*dx + dy*dy) < 1e-4) { it++; break; } // ~0.1 mm
+  }
+  if (iterations) *iterations = it;
+
+  if (brokeSingular) return false;
+
+  // Compute RMS residual to assess fit quality
+  {
+    double dxr = xg - sx[ref];
+    double dyr = yg - sy[ref];
+    double Dr = sqrt(dxr*dxr + dyr*dyr);
+    if (Dr < 1e-9) Dr = 1e-9;
+    double rss = 0.0; int m = 0;
+    for (int i = 0; i < N; i++) {
+      if (!use[i]) continue;
+      double dxi = xg - sx[i];
+      double dyi = yg - sy[i];
+      double Di = sqrt(dxi*dxi + dyi*dyi); if (Di < 1e-9) Di = 1e-9;
+      double ri = (Di - Dr) - dd[i];
+      rss += ri * ri;
+      m++;
+    }
+    if (m >= 2) {
+      double rms = sqrt(rss / m);
+      if (rms > lim.rmsThreshM) return false;
+    }
+  }
+
+  // Clamp to board bounds to avoid off-board estimates due to noise
+  if (xg < lim.minX) xg = lim.minX; else if (xg > lim.maxX) xg = lim.maxX;
+  if (yg < lim.minY) yg = lim.minY; else if (yg > lim.maxY) yg = lim.maxY;
+
+  x = float(xg);
+  y = float(yg);
+  return true;
+}
+
+// ===================== Fast solver (float) =====================
+// Single precision throughout (the ESP32 FPU has no double support) and
+// fixed-size loops over N that the compiler unrolls. Gauss-Newton is seeded
+// from a closed-form linearised solution, so it normally settles in 2-3 steps.
+
+// Closed-form seed (Chan/Fang style). With D_i = D_r + d_i, subtracting the
+// squared range equations of sensor i and the reference r gives a system that
+// is linear in (x, y) for a given reference range D_r:
+//   (xi-xr) x + (yi-yr) y = (Ki - Kr - d_i^2)/2 - d_i D_r,   K = x^2 + y^2
+// Least squares gives (x, y) = p + q D_r; substituting back into
+// D_r^2 = (x-xr)^2 + (y-yr)^2 leaves a quadratic in D_r.
+template <int N>
+static bool tdoaSeedF(const float *sx, const float *sy, const float *d,
+                      const bool *use, int ref, const TdoaLimits &lim,
+                      float &x0, float &y0)
+{
+  const float xr = sx[ref], yr = sy[ref];
+  const float Kr = xr*xr + yr*yr;
+
+  // Normal equations for [x y] with two right-hand sides (constant, D_r term)
+  float M00 = 0.0f, M01 = 0.0f, M11 = 0.0f;
+  float u0 = 0.0f, u1 = 0.0f; // A^T b
+  float v0 = 0.0f, v1 = 0.0f; // A^T d
+  for (int i = 0; i < N; i++) {
+    if (!use[i]) continue;
+    const float ax = sx[i] - xr, ay = sy[i] - yr;
+    const float b = 0.5f * ((sx[i]*sx[i] + sy[i]*sy[i]) - Kr - d[i]*d[i]);
+    M00 += ax*ax; M01 += ax*ay; M11 += ay*ay;
+    u0 += ax*b;   u1 += ay*b;
+    v0 += ax*d[i]; v1 += ay*d[i];
+  }
+  const float det = M00*M11 - M01*M01;
+  if (fabsf(det) < 1e-10f) return false; // sensors collinear with reference
+  const float i00 = M11/det, i01 = -M01/det, i11 = M00/det;
+  const float px = i00*u0 + i01*u1, py = i01*u0 + i11*u1;
+  const float qx = -(i00*v0 + i01*v1), qy = -(i01*v0 + i11*v1);
+
+  // (|q|^2 - 1) D^2 + 2 q.(p - r) D + |p - r|^2 = 0
+  const float ex = px - xr, ey = py - yr;
+  const float a = qx*qx + qy*qy - 1.0f;
+  const float bq = 2.0f * (qx*ex + qy*ey);
+  const float c = ex*ex + ey*ey;
+
+  float roots[2]; int nRoots = 0;
+  if (fabsf(a) < 1e-6f) {
+    if (fabsf(bq) > 1e-9f) roots[nRoots++] = -c / bq;
+  } else {
+    float disc = bq*bq - 4.0f*a*c;
+    if (disc < 0.0f) disc = 0.0f; // noise pushed the roots apart; take the vertex
+    const float sq = sqrtf(disc);
+    roots[nRoots++] = (-bq + sq) / (2.0f*a);
+    roots[nRoots++] = (-bq - sq) / (2.0f*a);
+  }
+
+  // Keep the non-negative root whose point best satisfies the range equations,
+  // preferring points on the board
+  bool found = false; float bestScore = 0.0f;
+  for (int k = 0; k < nRoots; k++) {
+    const float Dr = roots[k];
+    if (Dr < 0.0f) continue;
+    const float cx = px + qx*Dr, cy = py + qy*Dr;
+    float score = 0.0f;
+    for (int i = 0; i < N; i++) {
+      if (!use[i]) continue;
+      const float dxi = cx - sx[i], dyi = cy - sy[i];
+      const float ri = sqrtf(dxi*dxi + dyi*dyi) - Dr - d[i];
+      score += ri*ri;
+    }
+    if (cx < lim.minX || cx > lim.maxX || cy < lim.minY || cy > lim.maxY) score += 1.0f;
+    if (!found || score < bestScore) { found = true; bestScore = score; x0 = cx; y0 = cy; }
+  }
+  return found;
+}
+
+template <int N>
+static bool tdoaSolveF(const float *sx, const float *sy,
+                       const unsigned long *t, float vs, const TdoaLimits &lim,
+                       float &x, float &y, int &nUsed, int *iterations = nullptr)
+{
+  int have = 0;
+  for (int i = 0; i < N; i++) if (t[i] != 0) have++;
+  nUsed = have;
+  if (have < 3) return false;
+
+  int ref = 0; unsigned long tref = ~0ul;
+  for (int i = 0; i < N; i++) {
+    if (t[i] && t[i] < tref) { tref = t[i]; ref = i; }
+  }
+
+  // Differences are taken in integer µs first: raw micros() values do not
+  // fit in a float mantissa
+  float dd[N];
+  bool use[N];
+  int rows = 0;
+  const float mPerUs = vs * 1e-6f;
+  for (int i = 0; i < N; i++) {
+    use[i] = (i != ref && t[i] != 0);
+    dd[i] = use[i] ? mPerUs * (float)(long)(t[i] - tref) : 0.0f;
+    if (use[i]) rows++;
+  }
+  if (rows < 2) return false;
+
+  float xg = 0.0f, yg = 0.0f;
+  if (!tdoaSeedF<N>(sx, sy, dd, use, ref, lim, xg, yg)) {
+    for (int i = 0; i < N; i++) { xg += sx[i]; yg += sy[i]; }
+    xg *= 1.0f / N; yg *= 1.0f / N;
+  }
+
+  const float eps = 1e-6f;
+  const int maxIter = 6;
+  const float damping = 1e-6f;
+
+  float rss = 0.0f;
+  int it = 0;
+  for (; it < maxIter; it++) {
+    const float dxr = xg - sx[ref], dyr = yg - sy[ref];
+    float Dr = sqrtf(dxr*dxr + dyr*dyr); if (Dr < eps) Dr = eps;
+    const float invDr = 1.0f / Dr;
+
+    float ATA00 = damping, ATA01 = 0.0f, ATA11 = damping;
+    float ATb0 = 0.0f, ATb1 = 0.0f;
+    rss = 0.0f;
+    for (int i = 0; i < N; i++) {
+      if (!use[i]) continue;
+      const float dxi = xg - sx[i], dyi = yg - sy[i];
+      float Di = sqrtf(dxi*dxi + dyi*dyi); if (Di < eps) Di = eps;
+      const float invDi = 1.0f / Di;
+      const float ri = (Di - Dr) - dd[i];
+      const float jx = dxi*invDi - dxr*invDr;
+      const float jy = dyi*invDi - dyr*invDr;
+      ATA00 += jx*jx; ATA01 += jx*jy; ATA11 += jy*jy;
+      ATb0 += jx*ri;  ATb1 += jy*ri;
+      rss += ri*ri;
+    }
+
+    const float det = ATA00*ATA11 - ATA01*ATA01;
+    if (fabsf(det) < 1e-12f) return false;
+    const float invDet = 1.0f / det;
+    float dx = -( ATA11*ATb0 - ATA01*ATb1) * invDet;
+    float dy = -(-ATA01*ATb0 + ATA00*ATb1) * invDet;
+
+    const float step2 = dx*dx + dy*dy;
+    const float maxStep = 0.05f; // meters per iteration
+    if (step2 > maxStep*maxStep) {
+      const float k = maxStep / sqrtf(step2);
+      dx *= k; dy *= k;
+    }
+    xg += dx; yg += dy;
+    if (step2 < 1e-8f) { it++; break; } // ~0.1 mm
+  }
+  if (iterations) *iterations = it;
+
+  // rss is from the last linearisation point; within 0.1 mm of the final one
+  if (rss > lim.rmsThreshM * lim.rmsThreshM * rows) return false;
+
+  if (xg < lim.minX) xg = lim.minX; else if (xg > lim.maxX) xg = lim.maxX;
+  if (yg < lim.minY) yg = lim.minY; else if (yg > lim.maxY) yg = lim.maxY;
+
+  x = xg;
+  y = yg;
+  return true;
+}
+
+// ===================== Lookup grid (constant time) =====================
+// Propagation time from every cell centre to every sensor, tabulated once at
+// boot (V_SOUND is tunable at runtime, so this is not constexpr). A solve is
+// an integer scan of every COARSE-th cell, then of the full-resolution
+// neighbourhood of the two best coarse cells, followed by one Gauss-Newton
+// step from the best cell centre: the same work for every hit. For G = 40
+// that is 100 + 2 * 49 cells instead of 1600.
+//
+// The unknown emission time is removed per cell by taking the mean residual,
+// so cells are scored on sum((e_i - mean(e))^2) with e_i = t_i - T_i(cell).
+// That also works with only two sensors, where the cells along the hyperbola
+// all score ~0; ties are broken towards the first sensor to fire.
+template <int N, int G>
+struct TdoaGrid {
+  static const int TICKS_PER_US = 16;      // table resolution (1/16 µs)
+  static const int32_t PAIR_PRIOR = 64;    // 2-sensor tie-break weight per cell^2
+  static const int COARSE = 4;             // coarse pass stride, cells
+  static const int FINE_RADIUS = COARSE - 1; // fine pass: +-cells around a coarse candidate
+
+  uint16_t tt[G*G][N];   // cell -> sensor propagation time, ticks
+  float sx[N], sy[N];
+  float vs;
+  float x0, y0, step;    // centre of cell 0 and cell pitch (meters)
+  int32_t maxDt;         // largest usable arrival difference, ticks
+  TdoaLimits lim;
+  bool built = false;
+  bool exhaustive = false; // scan every cell (bench reference for the coarse pass)
+
+  void build(const float *sx_, const float *sy_, float vs_, const TdoaLimits &lim_) {
+    lim = lim_;
+    vs = vs_;
+    for (int i = 0; i < N; i++) { sx[i] = sx_[i]; sy[i] = sy_[i]; }
+    step = (lim.maxX - lim.minX) / G;
+    if ((lim.maxY - lim.minY) / G > step) step = (lim.maxY - lim.minY) / G;
+    x0 = lim.minX + 0.5f * step;
+    y0 = lim.minY + 0.5f * step;
+    const float ticksPerM = 1e6f * TICKS_PER_US / vs;
+    uint16_t tmax = 0;
+    for (int c = 0; c < G*G; c++) {
+      const float cx = x0 + (c % G) * step, cy = y0 + (c / G) * step;
+      for (int i = 0; i < N; i++) {
+        const float d = sqrtf((cx-sx[i])*(cx-sx[i]) + (cy-sy[i])*(cy-sy[i]));
+        tt[c][i] = (uint16_t)lroundf(d * ticksPerM);
+        if (tt[c][i] > tmax) tmax = tt[c][i];
+      }
+    }
+    // Clamp so the integer scan below cannot overflow on garbage timestamps
+    maxDt = 2 * (int32_t)tmax;
+    built = true;
+  }
+
+  // have^2 * variance of the residuals at cell c, plus the 2-sensor prior
+  int32_t cellCost(int c, const int32_t *dt, const bool *use, int have, int rix, int riy) const {
+    int32_t se = 0, se2 = 0;
+    for (int i = 0; i < N; i++) {
+      if (!use[i]) continue;
+      const int32_t e = dt[i] - (int32_t)tt[c][i];
+      se += e; se2 += e * e;
+    }
+    int32_t cost = have * se2 - se * se;
+    if (have == 2) {
+      const int32_t ix = c % G - rix, iy = c / G - riy;
+      cost += PAIR_PRIOR * (ix*ix + iy*iy);
+    }
+    return cost;
+  }
+
+  bool solve(const unsigned long *t, float &x, float &y, int &nUsed) const {
+    int have = 0;
+    for (int i = 0; i < N; i++) if (t[i] != 0) have++;
+    nUsed = have;
+    if (!built || have < 2) return false;
+
+    int ref = 0; unsigned long tref = ~0ul;
+    for (int i = 0; i < N; i++) {
+      if (t[i] && t[i] < tref) { tref = t[i]; ref = i; }
+    }
+
+    int32_t dt[N];
+    bool use[N];
+    for (int i = 0; i < N; i++) {
+      use[i] = (t[i] != 0);
+      int32_t d = use[i] ? (int32_t)(t[i] - tref) * TICKS_PER_US : 0;
+      dt[i] = d > maxDt ? maxDt : d;
+    }
+
+    // Cell of the first sensor to fire (only used for the 2-sensor prior)
+    const int rix = (int)((sx[ref] - lim.minX) / step);
+    const int riy = (int)((sy[ref] - lim.minY) / step);
+
+    int best = 0; int32_t bestCost = INT32_MAX;
+    if (exhaustive || G < 2 * COARSE) {
+      for (int c = 0; c < G*G; c++) {
+        const int32_t cost = cellCost(c, dt, use, have, rix, riy);
+        if (cost < bestCost) { bestCost = cost; best = c; }
+      }
+    } else {
+      // Coarse cells sit mid-block, so every cell is within COARSE/2 of one
+      int cand[2] = {0, 0}; int32_t candCost[2] = {INT32_MAX, INT32_MAX};
+      for (int cy = COARSE / 2; cy < G; cy += COARSE) {
+        for (int cx = COARSE / 2; cx < G; cx += COARSE) {
+          const int c = cy * G + cx;
+          const int32_t cost = cellCost(c, dt, use, have, rix, riy);
+          if (cost < candCost[0]) {
+            cand[1] = cand[0]; candCost[1] = candCost[0];
+            cand[0] = c; candCost[0] = cost;
+          } else if (cost < candCost[1]) {
+            cand[1] = c; candCost[1] = cost;
+          }
+        }
+      }
+      for (int k = 0; k < 2; k++) {
+        if (candCost[k] == INT32_MAX) continue;
+        const int cx = cand[k] % G, cy = cand[k] / G;
+        const int xa = cx > FINE_RADIUS ? cx - FINE_RADIUS : 0, xb = cx + FINE_RADIUS < G ? cx + FINE_RADIUS : G - 1;
+        const int ya = cy > FINE_RADIUS ? cy - FINE_RADIUS : 0, yb = cy + FINE_RADIUS < G ? cy + FINE_RADIUS : G - 1;
+        for (int y = ya; y <= yb; y++) {
+          for (int x = xa; x <= xb; x++) {
+            const int32_t cost = cellCost(y * G + x, dt, use, have, rix, riy);
+            if (cost < bestCost) { bestCost = cost; best = y * G + x; }
+          }
+        }
+      }
+    }
+
+    // One Gauss-Newton step on the range-difference residuals from the cell
+    // centre, limited to one cell so it stays a local correction
+    float xg = x0 + (best % G) * step, yg = y0 + (best / G) * step;
+    const float mPerTick = vs * 1e-6f / TICKS_PER_US;
+    const float eps = 1e-6f;
+    {
+      const float dxr = xg - sx[ref], dyr = yg - sy[ref];
+      float Dr = sqrtf(dxr*dxr + dyr*dyr); if (Dr < eps) Dr = eps;
+      float A00 = 0.0f, A01 = 0.0f, A11 = 0.0f, b0 = 0.0f, b1 = 0.0f;
+      for (int i = 0; i < N; i++) {
+        if (!use[i] || i == ref) continue;
+        const float dxi = xg - sx[i], dyi = yg - sy[i];
+        float Di = sqrtf(dxi*dxi + dyi*dyi); if (Di < eps) Di = eps;
+        const float ri = (Di - Dr) - dt[i] * mPerTick;
+        const float jx = dxi/Di - dxr/Dr, jy = dyi/Di - dyr/Dr;
+        A00 += jx*jx; A01 += jx*jy; A11 += jy*jy;
+        b0 += jx*ri;  b1 += jy*ri;
+      }
+      float dx = 0.0f, dy = 0.0f;
+      const float det = A00*A11 - A01*A01;
+      if (have >= 3 && fabsf(det) > 1e-9f) {
+        dx = -( A11*b0 - A01*b1) / det;
+        dy = -(-A01*b0 + A00*b1) / det;
+      } else if (A00 + A11 > 1e-9f) {
+        // Single residual: minimum-norm step back onto the hyperbola
+        dx = -b0 / (A00 + A11);
+        dy = -b1 / (A00 + A11);
+      }
+      const float s2 = dx*dx + dy*dy;
+      if (s2 > step*step) { const float k = step / sqrtf(s2); dx *= k; dy *= k; }
+      xg += dx; yg += dy;
+    }
+
+    if (have >= 3) {
+      const float dxr = xg - sx[ref], dyr = yg - sy[ref];
+      const float Dr = sqrtf(dxr*dxr + dyr*dyr);
+      float rss = 0.0f;
+      for (int i = 0; i < N; i++) {
+        if (!use[i] || i == ref) continue;
+        const float dxi = xg - sx[i], dyi = yg - sy[i];
+        const float ri = (sqrtf(dxi*dxi + dyi*dyi) - Dr) - dt[i] * mPerTick;
+        rss += ri*ri;
+      }
+      if (rss > lim.rmsThreshM * lim.rmsThreshM * (have - 1)) return false;
+    }
+
+    if (xg < lim.minX) xg = lim.minX; else if (xg > lim.maxX) xg = lim.maxX;
+    if (yg < lim.minY) yg = lim.minY; else if (yg > lim.maxY) yg = lim.maxY;
+
+    x = xg;
+    y = yg;
+    return true;
+  }
+};
+
+// ===================== Localisation chain =====================
+// What the player does with one capture: a full solve with 3+ sensors, the
+// grid for a 2-sensor hit, otherwise a guess near the first sensor to fire.
+// Returns the MsgHitLocation mode (0 = no sensor fired).
+enum TdoaMode : uint8_t { TDOA_MODE_NONE = 0, TDOA_MODE_TDOA, TDOA_MODE_PARTIAL, TDOA_MODE_NEAREST };
+static const char *const TDOA_MODE_NAMES[] = {"none", "tdoa", "partial", "nearest"};
+
+struct TdoaConfig {
+  bool fast;    // single-precision solver instead of the double reference
+  int  gridUse; // 0 = no grid, 1 = 2-sensor hits only, 2 = all hits
+};
+
+template <int N, int G>
+static uint8_t tdoaLocate(const float *sx, const float *sy, const unsigned long *t, float vs,
+                          const TdoaLimits &lim, const TdoaConfig &cfg, const TdoaGrid<N, G> *grid,
+                          float &x, float &y)
+{
+  int have = 0;
+  for (int i = 0; i < N; i++) if (t[i] != 0) have++;
+  int nUsed;
+
+  if (have >= 3) {
+    bool solved = (cfg.gridUse >= 2 && grid) ? grid->solve(t, x, y, nUsed)
+                : cfg.fast ? tdoaSolveF<N>(sx, sy, t, vs, lim, x, y, nUsed)
+                : tdoaSolve<N>(sx, sy, t, vs, lim, x, y, nUsed);
+    if (solved) return TDOA_MODE_TDOA;
+  }
+  // One hyperbola only: best grid cell near the first sensor to fire
+  if (have == 2 && cfg.gridUse >= 1 && grid && grid->solve(t, x, y, nUsed)) return TDOA_MODE_PARTIAL;
+
+  // Fallback: earliest sensor heuristic (cheap & dirty)
+  int first = -1; unsigned long tf = ~0ul;
+  for (int i = 0; i < N; i++) if (t[i] && t[i] < tf) { tf = t[i]; first = i; }
+  if (first < 0) return TDOA_MODE_NONE;
+  x = sx[first] * 0.8f; y = sy[first] * 0.8f;
+  return have >= 2 ? TDOA_MODE_PARTIAL : TDOA_MODE_NEAREST;
+}
@@ -0,0 +1,86 @@
+// Latency trace points shared by the players, the lightboard and the Bridge.
+// Plain C++ with no Arduino dependencies, on top of espnow_protocol.h.
+//
+// Each stage keeps its last TELEMETRY_WINDOW durations (µs) in a ring and is
+// summarised as p50/p99/max over that window when it is reported. A stage
+// has a single writer (the task that closes its span); the reporter reads
+// the rings without a lock, so a summary may miss the sample being written.
+#pragma once
+
+#include "espnow_protocol.h"
+
+enum TelemetryStage : uint8_t {
+  TELEM_CAPTURE,   // player: first sensor edge -> capture window closed
+  TELEM_SEND,      // player: window closed -> esp_now_send() of the hit returned
+  TELEM_SENT,      // player: hit handed to the radio -> its send callback
+  TELEM_SOLVE,     // player: window closed -> location solved
+  TELEM_DISPATCH,  // bridge: packet received -> handler finished
+  TELEM_DECIDE,    // bridge: first hit of the round received -> winner decided
+  TELEM_PI_SEND,   // bridge: winner decided -> written to the Pi
+  TELEM_SHOW,      // lightboard: board change received -> frame pushed to the strip
+  TELEM_LOOP,      // any: one loop() pass (one dispatched event on the Bridge)
+  TELEM_STAGE_COUNT
+};
+
+// JSON names, indexed by TelemetryStage
+static const char *const TELEMETRY_STAGE_NAMES[TELEM_STAGE_COUNT] = {
+  "capture", "send", "sent", "solve", "dispatch", "decide", "piSend", "show", "loop"
+};
+
+static const uint8_t TELEMETRY_WINDOW = 64;
+static const uint32_t TELEMETRY_REPORT_MS = 5000;
+
+struct TelemetryRing {
+  uint32_t us[TELEMETRY_WINDOW];
+  uint32_t total;                  // samples recorded since boot
+
+  void record(uint32_t durUs) {
+    us[total % TELEMETRY_WINDOW] = durUs;
+    total++;
+  }
+};
+
+struct Telemetry {
+  TelemetryRing stage[TELEM_STAGE_COUNT];
+  uint32_t sendFailed;             // send callbacks reporting failure
+
+  // Timestamps are the low 32 bits of esp_timer_get_time()/micros(); the
+  // unsigned difference is right across a wrap
+  void span(TelemetryStage s, uint32_t startUs, uint32_t endUs) {
+    stage[s].record(endUs - startUs);
+  }
+};
+
+// Nearest-rank percentiles and max of one stage's window; false if empty
+static inline bool telemetrySummary(const TelemetryRing &r, uint8_t stage, MsgTelemetryStage &out) {
+  uint32_t total = r.total;
+  if (total == 0) return false;
+  uint8_t n = total < TELEMETRY_WINDOW ? (uint8_t)total : TELEMETRY_WINDOW;
+
+  // Insertion sort of a copy: 64 entries, every few seconds
+  uint32_t v[TELEMETRY_WINDOW];
+  for (uint8_t i = 0; i < n; i++) {
+    uint32_t x = r.us[i];
+    int j = i - 1;
+    while (j >= 0 && v[j] > x) { v[j + 1] = v[j]; j--; }
+    v[j + 1] = x;
+  }
+
+  out.stage = stage;
+  out.samples = n;
+  out.total = total;
+  out.p50Us = v[(n * 50 + 99) / 100 - 1];
+  out.p99Us = v[(n * 99 + 99) / 100 - 1];
+  out.maxUs = v[n - 1];
+  return true;
+}
+
+// One MSG_TELEMETRY_STAGE per stage that has samples, then the counters
+static inline void telemetryReport(const Telemetry &t, const MsgTelemetryCounters &counters,
+                                   void (*send)(uint8_t type, const void *payload, uint8_t len)) {
+  for (uint8_t s = 0; s < TELEM_STAGE_COUNT; s++) {
+    MsgTelemetryStage m;
+    if (telemetrySummary(t.stage[s], s, m)) send(MSG_TELEMETRY_STAGE, &m, sizeof(m));
+  }
+  send(MSG_TELEMETRY_COUNTERS, &counters, sizeof(counters));
+}
@@ -0,0 +1,65 @@
+#!/usr/bin/env node
+// Builds oldmaster_ui.h from oldmaster.html: the standalone master's web page,
+// with its local scripts inlined, minified and gzipped into a flash byte array
+// with an ETag.
+//
+//   npm run build:oldmaster-ui
+//
+// Re-run after every edit to oldmaster.html or a script it includes and commit
+// the header too; the Arduino build only sees the generated header.
+import { readFileSync, writeFileSync } from 'fs';
+import { gzipSync } from 'zlib';
+import { createHash } from 'crypto';
+import { dirname, join } from 'path';
+import { fileURLToPath } from 'url';
+
+const root = join(dirname(fileURLToPath(import.meta.url)), '..');
+const SRC = join(root, 'oldmaster.html');
+const OUT = join(root, 'oldmaster_ui.h');
+
+// Line-based on purpose: indentation, blank lines and comments go, but every
+// line break stays, so JS that relies on automatic semicolons keeps working.
+function minify(html) {
+  return html
+    .replace(/<!--[\s\S]*?-->/g, '')
+    .replace(/\/\*[\s\S]*?\*\//g, '')
+    .split('\n')
+    .map(line => line.trim())
+    .filter(line => line && !line.startsWith('//'))
+    .join('\n');
+}
+
+// The master serves a single page, so <script src="x.js"> (repo root) goes inline
+function inlineScripts(html) {
+  return html.replace(/<script src="([\w.]+\.js)"><\/script>/g,
+    (tag, name) => `<script>\n${readFileSync(join(root, name), 'utf8')}</script>`);
+}
+
+const html = inlineScripts(readFileSync(SRC, 'utf8'));
+const min = minify(html);
+// mtime 0 and a fixed OS byte keep the output identical across machines
+const gz = gzipSync(Buffer.from(min, 'utf8'), { level: 9 });
+gz.writeUInt32LE(0, 4);
+gz[9] = 0xff;
+const etag = '"' + createHash('sha1').update(gz).digest('hex').slice(0, 16) + '"';
+
+const rows = [];
+for (let i = 0; i < gz.length; i += 16) {
+  rows.push('  ' + Array.from(gz.subarray(i, i + 16), b => '0x' + b.toString(16).padStart(2, '0')).join(','));
+}
+
+writeFileSync(OUT, `// Generated by tools/build_oldmaster_ui.js from oldmaster.html - do not edit.
+// ${html.length} bytes -> ${min.length} minified -> ${gz.length} gzipped
+#pragma once
+
+#include <pgmspace.h>
+
+#define OLDMASTER_UI_ETAG "${etag.replace(/"/g, '\\"')}"
+
+static const size_t OLDMASTER_UI_GZ_LEN = ${gz.length};
+static const uint8_t OLDMASTER_UI_GZ[] PROGMEM = {
+${rows.join(',\n')}
+};
+`);
+
+console.log(`oldmaster_ui.h: ${html.length} -> ${min.length} -> ${gz.length} bytes, ETag ${etag}`);